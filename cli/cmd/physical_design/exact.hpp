@@ -45,6 +45,12 @@ class exact_command : public command
         add_option("--fixed_size,-f", ps.fixed_size,
                    "Execute only one iteration with the given number of upper bound tiles");
         add_option("--timeout,-t", ps.timeout, "Timeout in seconds");
+        add_option("--memory_limit", ps.memory_limit, "Memory limit in MiB for the solving process");
+        add_flag("--best_effort", ps.best_effort,
+                 "Fall back to an orthogonal layout if no exact result can be found within the given time and memory "
+                 "limits (Cartesian 2DDWave only)");
+        add_flag("--smt_profiling", ps.smt_profiling,
+                 "Profile the SMT instance generation per constraint family (reported in the log)");
         add_option("--async,-a", ps.num_threads, "Number of layout dimensions to examine in parallel (beta feature)");
 
         add_flag("--async_max,",
@@ -155,6 +161,9 @@ class exact_command : public command
             {"runtime in seconds", mockturtle::to_seconds(st.time_total)},
             {"number of gates", st.num_gates},
             {"number of wires", st.num_wires},
+            {"proven optimal", st.is_optimal},
+            {"heuristic fallback", st.is_fallback},
+            {"SMT profile", st.smt_profile()},
             {"layout", {{"x-size", st.x_size}, {"y-size", st.y_size}, {"area", st.x_size * st.y_size}}}};
     }
 
@@ -199,12 +208,16 @@ class exact_command : public command
         ps_dest.crossings                = ps_src.crossings;
         ps_dest.io_pins                  = ps_src.io_pins;
         ps_dest.border_io                = ps_src.border_io;
+        ps_dest.directional_border_io    = ps_src.directional_border_io;
         ps_dest.synchronization_elements = ps_src.synchronization_elements;
         ps_dest.straight_inverters       = ps_src.straight_inverters;
         ps_dest.desynchronize            = ps_src.desynchronize;
         ps_dest.minimize_wires           = ps_src.minimize_wires;
         ps_dest.minimize_crossings       = ps_src.minimize_crossings;
         ps_dest.timeout                  = ps_src.timeout;
+        ps_dest.memory_limit             = ps_src.memory_limit;
+        ps_dest.best_effort              = ps_src.best_effort;
+        ps_dest.smt_profiling            = ps_src.smt_profiling;
         ps_dest.technology_specifics     = ps_src.technology_specifics;
 
         return ps_dest;
@@ -2,8 +2,6 @@
 // Created by marcel on 09.04.20.
 //
 
-#if (MUGEN)
-
 #ifndef FICTION_CMD_ONEPASS_HPP
 #define FICTION_CMD_ONEPASS_HPP
 
@@ -27,8 +25,8 @@
 namespace alice
 {
 /**
- * Executes a SAT-driven topology-based logic re-synthesis, i.e., a one-pass synthesis. Utilizes the synthesis tool
- * Mugen by Winston Haaswijk.
+ * Executes a SAT-driven topology-based logic re-synthesis, i.e., a one-pass synthesis. Utilizes either a native SAT
+ * encoding or the synthesis tool Mugen by Winston Haaswijk.
  *
  * See fiction/algorithms/one_pass_synthesis.hpp for more details.
  */
@@ -42,11 +40,11 @@ class onepass_command : public command
      */
     explicit onepass_command(const environment::ptr& e) :
             command(e, "SAT-driven topology-based logic re-synthesis, i.e., one-pass synthesis. Uses "
-                       "Mugen by Winston Haaswijk to synthesize a specification in terms of a truth table or a "
-                       "logic network onto a given clocking scheme. Gate types to be used can be specified. If "
-                       "none are given, all are enabled, because synthesis without gates cannot work. Layouts "
-                       "resulting from this approach might be desynchronized. I/Os are always located at the "
-                       "layout's borders.")
+                       "a native SAT encoding or Mugen by Winston Haaswijk (if available) to synthesize a "
+                       "specification in terms of a truth table or a logic network onto a given clocking scheme. "
+                       "Gate types to be used can be specified. If none are given, all are enabled, because "
+                       "synthesis without gates cannot work. Layouts resulting from this approach might be "
+                       "desynchronized. I/Os are always located at the layout's borders.")
     {
         add_option("--clk_scheme,-s", clocking, "Clocking scheme to use {2DDWAVE[3|4], USE, RES, ESR, CFE, BANCS}",
                    true);
@@ -58,6 +56,13 @@ class onepass_command : public command
 #if !defined(__APPLE__)
         add_option("--async,-a", ps.num_threads, "Number of threads to use for parallel solving (beta feature)");
         add_flag("--async_max", "Use the maximum number of threads available to the system (beta feature)");
+#endif
+#if !defined(_WIN32)
+        add_option("--workers", ps.num_workers,
+                   "Number of aspect ratios to explore simultaneously in separate worker processes");
+#endif
+#if (MUGEN)
+        add_flag("--bill,-b", "Use the native SAT encoding solved via bill instead of Mugen");
 #endif
         add_flag("--network,-n", "Re-synthesize the current logic network in store instead of the current truth table");
         add_flag("--and,-A", ps.enable_and, "Enable the use of AND gates");
@@ -131,6 +136,13 @@ class onepass_command : public command
         }
 #endif
 
+#if (MUGEN)
+        if (this->is_set("bill"))
+        {
+            ps.engine = fiction::one_pass_synthesis_engine::BILL;
+        }
+#endif
+
         if (this->is_set("network"))
         {
             auto& s = store<fiction::logic_network_t>();
@@ -248,5 +260,3 @@ ALICE_ADD_COMMAND(onepass, "Physical Design")
 }  // namespace alice
 
 #endif  // FICTION_CMD_ONEPASS_HPP
-
-#endif  // MUGEN
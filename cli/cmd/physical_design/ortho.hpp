@@ -35,7 +35,7 @@ class ortho_command : public command
         add_option("--clock_numbers,-n", num_clock_phases, "Number of clock phases to be used {3 or 4}");
         add_option("--hex", hexagonal_tile_shift,
                    "Use hexagonal tiles and specify tile shift. Possible values are 'odd_row', 'even_row', "
-                   "'odd_column', or 'even_column'");
+                   "'odd_column', or 'even_column'. 'even_row' yields ROW-clocked layouts");
         add_flag("--verbose,-v", "Be verbose");
     }
 
@@ -10,7 +10,6 @@
 #include "fiction/layouts/obstruction_layout.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/routing_utils.hpp"
-#include "fiction/utils/stl_utils.hpp"
 
 #include <mockturtle/utils/stopwatch.hpp>
 #include <phmap.h>
@@ -18,6 +17,8 @@
 #include <algorithm>
 #include <cstdint>
 #include <optional>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <combinations.h>
@@ -50,6 +51,11 @@ struct generate_edge_intersection_graph_params
      * Yen's algorithm) instead of all paths.
      */
     std::optional<uint32_t> path_limit = std::nullopt;
+    /**
+     * Number of threads that enumerate the paths of different objectives concurrently. The resulting graph does not
+     * depend on this value.
+     */
+    uint32_t num_threads = 1ul;
 };
 
 struct generate_edge_intersection_graph_stats
@@ -95,24 +101,12 @@ class generate_edge_intersection_graph_impl
         // measure runtime
         mockturtle::stopwatch stop{pst.time_total};
 
-        std::for_each(objectives.cbegin(), objectives.cend(),
-                      [this](const auto& obj)
-                      {
-                          path_collection<clk_path> obj_paths{};
-
-                          if (!ps.path_limit.has_value())
-                          {
-                              // enumerate all paths for the current objective
-                              obj_paths = enumerate_all_clocking_paths<clk_path>(
-                                  obstruction_layout{layout}, {obj.source, obj.target}, {ps.crossings});
-                          }
-                          else
-                          {
-                              // enumerate k paths for the current objective
-                              obj_paths = yen_k_shortest_paths<clk_path>(
-                                  obstruction_layout{layout}, {obj.source, obj.target}, *ps.path_limit, {ps.crossings});
-                          }
+        auto objective_paths = enumerate_objective_paths();
 
+        // merge the paths into the graph in order of the objectives such that labels are reproducible
+        std::for_each(objective_paths.begin(), objective_paths.end(),
+                      [this](auto& obj_paths)
+                      {
                           // assign a unique label to each path and create a corresponding node in the graph
                           initiate_objective_nodes(obj_paths);
 
@@ -127,11 +121,8 @@ class generate_edge_intersection_graph_impl
                               // edges between all of them by iterating over all possible combinations of size 2
                               connect_clique(obj_paths);
                           }
-                          // for each previously stored path, create an edge if there is an intersection
+                          // for each previously indexed path, create an edge if there is an intersection
                           create_intersection_edges(obj_paths);
-
-                          // add the collection to all paths gathered thus far
-                          all_paths.insert(all_paths.end(), obj_paths.cbegin(), obj_paths.cend());
                       });
 
         // store size of the generated graph
@@ -167,71 +158,11 @@ class generate_edge_intersection_graph_impl
      */
     std::size_t node_id{0}, edge_id{0};
     /**
-     * Extends the layout_coordinate_path to additionally to the vector representation of the path also hold a set that
-     * allows fast lookup needed to find intersections (O(log n)). Additionally, a label is assigned to each path to
-     * identify it in the edge intersection graph.
+     * Extends the layout_coordinate_path by a label that identifies it in the edge intersection graph.
      */
-    class labeled_layout_coordinate_lookup_path : public layout_coordinate_path<Lyt>
+    class labeled_layout_coordinate_path : public layout_coordinate_path<Lyt>
     {
       public:
-        /**
-         * Overwrites the append function to additionally store the given coordinate in a set.
-         *
-         * @param c Coordinate to append to the path.
-         */
-        void append(const coordinate<Lyt>& c) noexcept
-        {
-            path_elements.insert(c);
-            layout_coordinate_path<Lyt>::append(c);
-        }
-        /**
-         * Given another path, this function checks if they are not disjoint, i.e., it looks for at least one coordinate
-         * that both paths share.
-         *
-         * If, at some point, the set approach is not to be used anymore, std::find_first_of offers the same
-         * functionality on any kind of range.
-         *
-         * @tparam Path Type of other path.
-         * @param other The other path.
-         * @return `true` iff this path and the given one are not disjoint, i.e., share at least one coordinate.
-         */
-        template <typename Path>
-        bool has_intersection_with(const Path& other) const noexcept
-        {
-            // if source and target are identical, an intersection was found
-            if (this->source() == other.source() && this->target() == other.target())
-            {
-                return true;
-            }
-
-            // else, check if any of the remaining coordinates occur in the stored path
-            return std::any_of(std::cbegin(other) + 1, std::cend(other) - 1,
-                               [this](const auto& c) { return path_elements.count(c) > 0; });
-        }
-        /**
-         * Like has_intersection_with but allows paths to share crossings, i.e., single-tile intersections.
-         *
-         * Similar to has_intersection_with, this function also returns `true` if source and target are matching in both
-         * paths.
-         *
-         * @tparam Path Type of other path.
-         * @param other The other path.
-         * @return `true` iff this path and the given one are overlapping, i.e., share at least one coordinate segment
-         * of size 2.
-         */
-        template <typename Path>
-        bool has_overlap_with(const Path& other) const noexcept
-        {
-            // if source and target are identical, an intersection was found
-            if (this->source() == other.source() && this->target() == other.target())
-            {
-                return true;
-            }
-
-            // else, check if any of the coordinates (including I/Os) form a shared segment in the stored path
-            return find_first_two_of(std::cbegin(other), std::cend(other), std::cbegin(*this), std::cend(*this)) !=
-                   std::cend(other);
-        }
         /**
          * Label to identify the path in the edge intersection graph.
          */
@@ -243,24 +174,92 @@ class generate_edge_intersection_graph_impl
       public:
         // make all inherited constructors available
         using base::base;
-
-      private:
-        /**
-         * Uniquely identify path elements in a set to make them searchable in O(1).
-         */
-        phmap::flat_hash_set<coordinate<Lyt>> path_elements{};
     };
     /**
      * Alias for the path type.
      */
-    using clk_path = labeled_layout_coordinate_lookup_path;
+    using clk_path = labeled_layout_coordinate_path;
     /**
-     * Stores a collection of all annotated paths (labeled_layout_coordinate_lookup_path objects) computed thus far to
-     * find intersections with new ones. The edge intersection graph stores plain paths without the extra set and label.
-     * Therefore, after the generate_edge_intersection_graph function terminates, the extra memory overhead is being
-     * released again.
+     * Enumerates the paths of the given objective. Each call operates on its own obstruction_layout view of the layout.
+     *
+     * @param obj Routing objective whose paths are to be enumerated.
+     * @return All paths or the `path_limit` shortest paths that fulfill `obj`.
      */
-    path_collection<clk_path> all_paths{};
+    [[nodiscard]] path_collection<clk_path> enumerate_paths(const routing_objective<Lyt>& obj) const
+    {
+        if (!ps.path_limit.has_value())
+        {
+            // enumerate all paths for the current objective
+            return enumerate_all_clocking_paths<clk_path>(obstruction_layout{layout}, {obj.source, obj.target},
+                                                          {ps.crossings});
+        }
+
+        // enumerate k paths for the current objective
+        return yen_k_shortest_paths<clk_path>(obstruction_layout{layout}, {obj.source, obj.target}, *ps.path_limit,
+                                              {ps.crossings});
+    }
+    /**
+     * Enumerates the paths of all objectives. Since objectives are independent of each other, they are distributed
+     * among `num_threads` threads in contiguous chunks. Each thread stores its results at the respective objective's
+     * position such that the outcome does not depend on the scheduling.
+     *
+     * @return The enumerated paths of each objective in order of the objectives.
+     */
+    [[nodiscard]] std::vector<path_collection<clk_path>> enumerate_objective_paths() const
+    {
+        std::vector<path_collection<clk_path>> objective_paths(objectives.size());
+
+        const auto num_chunks = std::min(static_cast<std::size_t>(ps.num_threads), objectives.size());
+
+        if (num_chunks <= 1)
+        {
+            std::transform(objectives.cbegin(), objectives.cend(), objective_paths.begin(),
+                           [this](const auto& obj) { return enumerate_paths(obj); });
+
+            return objective_paths;
+        }
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_chunks);
+
+        for (std::size_t c = 0; c < num_chunks; ++c)
+        {
+            threads.emplace_back(
+                [this, &objective_paths, c, num_chunks]
+                {
+                    const auto begin = objectives.size() * c / num_chunks;
+                    const auto end   = objectives.size() * (c + 1) / num_chunks;
+
+                    for (auto i = begin; i < end; ++i)
+                    {
+                        objective_paths[i] = enumerate_paths(objectives[i]);
+                    }
+                });
+        }
+
+        std::for_each(threads.begin(), threads.end(), [](auto& t) { t.join(); });
+
+        return objective_paths;
+    }
+    /**
+     * Inverted index from each coordinate to the labels of all paths enumerated thus far that contain it as an
+     * intermediate coordinate, i.e., neither as source nor as target.
+     */
+    phmap::flat_hash_map<coordinate<Lyt>, std::vector<std::size_t>> coordinate_paths{};
+    /**
+     * Inverted index from each coordinate to the labels of all paths enumerated thus far that start or end in it. Only
+     * used if crossings are disabled.
+     */
+    phmap::flat_hash_map<coordinate<Lyt>, std::vector<std::size_t>> terminal_paths{};
+    /**
+     * Inverted index from each segment, i.e., pair of consecutive coordinates, to the labels of all paths enumerated
+     * thus far that contain it. Only used if crossings are enabled.
+     */
+    phmap::flat_hash_map<std::pair<coordinate<Lyt>, coordinate<Lyt>>, std::vector<std::size_t>> segment_paths{};
+    /**
+     * Inverted index from each source-target pair to the labels of all paths enumerated thus far that connect them.
+     */
+    phmap::flat_hash_map<std::pair<coordinate<Lyt>, coordinate<Lyt>>, std::vector<std::size_t>> endpoint_paths{};
     /**
      * Given a collection of paths belonging to the same objective, this function assigns them unique labels and
      * generates corresponding nodes in the edge intersection graph.
@@ -303,10 +302,60 @@ class generate_edge_intersection_graph_impl
                                                return false;  // keep looping
                                            });
     }
+    /**
+     * Collects the labels of all previously indexed paths that intersect with the given one. Two paths intersect if
+     * they connect the same source and target or, if crossings are disabled, if an intermediate coordinate of either
+     * path is part of the other one. Since the relation is symmetric, the result does not depend on the order in which
+     * paths are indexed. If crossings are enabled, paths only intersect if they share a segment, i.e., a pair of
+     * consecutive coordinates, such that they are allowed to cross each other in single coordinates.
+     *
+     * @param p Path whose intersecting paths are to be determined.
+     * @return Labels of all intersecting paths in ascending order without duplicates.
+     */
+    [[nodiscard]] std::vector<std::size_t> intersecting_paths(const clk_path& p) const noexcept
+    {
+        std::vector<std::size_t> labels{};
+
+        const auto collect = [&labels](const auto& index, const auto& key)
+        {
+            if (const auto it = index.find(key); it != index.cend())
+            {
+                labels.insert(labels.end(), it->second.cbegin(), it->second.cend());
+            }
+        };
+
+        collect(endpoint_paths, std::make_pair(p.source(), p.target()));
+
+        if (ps.crossings)
+        {
+            for (auto it = p.cbegin(); it + 1 < p.cend(); ++it)
+            {
+                collect(segment_paths, std::make_pair(*it, *(it + 1)));
+            }
+        }
+        else
+        {
+            // intermediate coordinates of the indexed paths that are part of the given one
+            std::for_each(p.cbegin(), p.cend(), [&collect, this](const auto& c) { collect(coordinate_paths, c); });
+
+            // intermediate coordinates of the given path that are sources or targets of the indexed ones
+            if (p.size() > 2)
+            {
+                std::for_each(p.cbegin() + 1, p.cend() - 1,
+                              [&collect, this](const auto& c) { collect(terminal_paths, c); });
+            }
+        }
+
+        std::sort(labels.begin(), labels.end());
+        labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+
+        return labels;
+    }
     /**
      * Given a collection of paths belonging to the same objective, this function creates edges in the edge intersection
      * graph between each corresponding node and all of the already existing nodes that represent paths that intersect
-     * with it, i.e., that share at least one coordinate.
+     * with it. Candidates are looked up in the inverted indices such that only intersecting pairs of paths are
+     * examined. Afterwards, the given paths are added to the indices.
      *
      * @param objective_paths Collection of paths belonging to the same objective.
      */
@@ -315,16 +364,43 @@ class generate_edge_intersection_graph_impl
         std::for_each(objective_paths.cbegin(), objective_paths.cend(),
                       [this](const auto& obj_p)
                       {
-                          std::for_each(all_paths.cbegin(), all_paths.cend(),
-                                        [this, &obj_p](const auto& stored_p)
-                                        {
-                                            if (ps.crossings ? obj_p.has_overlap_with(stored_p) :
-                                                               obj_p.has_intersection_with(stored_p))
-                                            {
-                                                graph.insert_edge(obj_p.label, stored_p.label, edge_id++);
-                                            }
-                                        });
+                          for (const auto label : intersecting_paths(obj_p))
+                          {
+                              graph.insert_edge(obj_p.label, label, edge_id++);
+                          }
                       });
+
+        // paths of the same objective are connected via their clique already and, thus, indexed afterwards
+        std::for_each(objective_paths.cbegin(), objective_paths.cend(),
+                      [this](const auto& obj_p) { index_path(obj_p); });
+    }
+    /**
+     * Adds the given path to the inverted indices.
+     *
+     * @param p Path to index.
+     */
+    void index_path(const clk_path& p) noexcept
+    {
+        endpoint_paths[{p.source(), p.target()}].push_back(p.label);
+
+        if (ps.crossings)
+        {
+            for (auto it = p.cbegin(); it + 1 < p.cend(); ++it)
+            {
+                segment_paths[{*it, *(it + 1)}].push_back(p.label);
+            }
+        }
+        else
+        {
+            terminal_paths[p.source()].push_back(p.label);
+            terminal_paths[p.target()].push_back(p.label);
+
+            if (p.size() > 2)
+            {
+                std::for_each(p.cbegin() + 1, p.cend() - 1,
+                              [this, &p](const auto& c) { coordinate_paths[c].push_back(p.label); });
+            }
+        }
     }
 };
 
@@ -333,9 +409,10 @@ class generate_edge_intersection_graph_impl
 /**
  * Creates an edge intersection graph of all paths that satisfy a given list of routing objectives. That is, this
  * function generates an undirected graph whose nodes represent paths in the given layout and whose edges represent
- * intersections of these paths. An intersection is understood as the non-disjunction of paths, i.e., they share at
- * least one coordinate. To generate the paths for the routing objectives, all possible paths from source to target in
- * the layout are enumerated while taking obstructions into consideration. The given layout must be clocked.
+ * intersections of these paths. An intersection is understood as the non-disjunction of paths, i.e., they connect the
+ * same source and target or share at least one coordinate that is an intermediate one of either path. To generate the
+ * paths for the routing objectives, all possible paths from source to target in the layout are enumerated while taking
+ * obstructions into consideration. The given layout must be clocked.
  *
  * @tparam Lyt Type of the clocked layout.
  * @param lyt The layout to generate the edge intersection graph for.
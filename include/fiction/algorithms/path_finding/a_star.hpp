@@ -7,18 +7,20 @@
 
 #include "fiction/algorithms/path_finding/cost.hpp"
 #include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/algorithms/path_finding/search_state.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/routing_utils.hpp"
 #include "fiction/utils/stl_utils.hpp"
 
-#include <phmap.h>
-
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <functional>
 #include <iterator>
 #include <limits>
+#include <optional>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -33,26 +35,45 @@ struct a_star_params
      * Allow paths to cross over obstructed tiles if they are occupied by wire segments.
      */
     bool crossings = false;
+    /**
+     * Search from both ends simultaneously, i.e., forward from the source along outgoing clock zones and backward from
+     * the target along incoming clock zones. Since both frontiers only need to cover about half the distance, this
+     * tends to expand far fewer coordinates on long routes. The backward search estimates the remaining costs via the
+     * distance function from the source.
+     */
+    bool bidirectional = false;
+    /**
+     * Factor \f$ w \geq 1 \f$ by which the heuristic is inflated. With \f$ w > 1 \f$, the search is greedier and
+     * usually finds a path with far fewer expansions. For a consistent heuristic, a unidirectional search returns a
+     * path whose costs exceed the optimum by at most a factor of \f$ w \f$.
+     */
+    double heuristic_weight = 1.0;
+    /**
+     * Number of refinement searches after the initial weighted one, which make the search an anytime algorithm. The
+     * weight is decreased linearly such that the last refinement searches with \f$ w = 1 \f$ and, thus, returns an
+     * optimal path for an admissible heuristic. Each refinement prunes all coordinates that cannot lead to a path that
+     * is cheaper than the best one found so far and keeps the latter if there is no such path. Refinements are skipped
+     * if `heuristic_weight` is not larger than 1.
+     */
+    uint32_t num_refinements = 0;
 };
 
 namespace detail
 {
 
-template <typename Path, typename Lyt, typename Dist, typename Cost>
+template <typename Path, typename Lyt, typename DistFn, typename CostFn>
 class a_star_impl
 {
   public:
-    a_star_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const distance_functor<Lyt, Dist>& dist_fn,
-                const cost_functor<Lyt, Cost>& cost_fn, const a_star_params p) :
+    a_star_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const DistFn& dist_fn, const CostFn& cost_fn,
+                const a_star_params p) :
             layout{lyt},
             source{obj.source},
             target{obj.target},
             distance{dist_fn},
             cost{cost_fn},
             ps{p}
-    {
-        open_list.push(coordinate_f{source, 0});
-    }
+    {}
 
     Path run()
     {
@@ -61,24 +82,26 @@ class a_star_impl
         assert(layout.is_within_bounds(source) && layout.is_within_bounds(target) &&
                "Both source and target coordinate have to be within the layout bounds");
 
-        do {
-            // get coordinate with lowest f-value
-            const auto current = get_lowest_f_coord();
+        const auto initial_weight = std::max(ps.heuristic_weight, 1.0);
 
-            // if coord is the target, a path has been found
-            if (current == target)
-            {
-                return reconstruct_path();
-            }
-            // don't examine the current coordinate again
-            closed_list.insert(current);
+        auto result = search(initial_weight);
 
-            // expand from current coordinate
-            expand(current);
+        // anytime refinement with decreasing weights
+        for (uint32_t r = 1; r <= ps.num_refinements && initial_weight > 1.0 && !result.path.empty(); ++r)
+        {
+            // only paths that are cheaper than the best one found so far are of interest
+            upper_bound = result.costs;
 
-        } while (!open_list.empty());  // until the open list is empty
+            const auto w = 1.0 + (initial_weight - 1.0) * static_cast<double>(ps.num_refinements - r) /
+                                     static_cast<double>(ps.num_refinements);
 
-        return {};                     // open list is empty, no path has been found
+            if (auto refined = search(w); !refined.path.empty())
+            {
+                result = std::move(refined);
+            }
+        }
+
+        return result.path;
     }
 
   private:
@@ -86,93 +109,252 @@ class a_star_impl
 
     const coordinate<Lyt> source, target;
 
-    const distance_functor<Lyt, Dist> distance;
+    const DistFn distance;
 
-    const cost_functor<Lyt, Cost> cost;
+    const CostFn cost;
 
     a_star_params ps;
 
     /**
-     * The values used for g and f have a type in accordance with Dist and Cost.
+     * Value type of the distance function.
+     */
+    using dist_type = distance_type<Lyt, DistFn>;
+    /**
+     * The values used for g and f have a type in accordance with the distance and cost functions.
+     */
+    using g_f_type = std::common_type_t<dist_type, cost_type<Lyt, CostFn>>;
+    /**
+     * Open and closed list, g-values, and origins of all coordinates stored in flat arrays.
+     */
+    using search_state = path_search_state<coordinate<Lyt>, g_f_type>;
+    /**
+     * Dense indices of the layout coordinates that serve as keys in the search state.
+     */
+    dense_coordinate_index<Lyt> coordinate_index{layout};
+    /**
+     * Search state that is reused from previous searches on the same thread to avoid reallocation.
+     */
+    typename search_state_pool<search_state>::handle state{search_state_pool<search_state>::acquire()};
+    /**
+     * Search state of the backward direction, which is only acquired for bidirectional searches.
      */
-    using g_f_type = std::common_type_t<Dist, Cost>;
+    std::optional<typename search_state_pool<search_state>::handle> backward_state{};
     /**
-     * Stores a coordinate and its f-value.
+     * A path together with its costs.
      */
-    struct coordinate_f
+    struct search_result
     {
-        // cannot be const because operator= is required by std::priority_queue
-        coordinate<Lyt> coord;
-
-        g_f_type f;
-
         /**
-         * Comparator for the priority queue. Compares only the f-values.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this f-value is greater than the other's.
+         * The found path, which is empty if there is none.
          */
-        bool operator>(const coordinate_f& other) const
-        {
-            return this->f > other.f;
-        }
+        Path path{};
         /**
-         * Equality operator that only compares the stored coordinates. This allows for a convenient lookup in the
-         * priority queue.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this coord value is equal to the other's.
+         * Costs of the path.
          */
-        bool operator==(const coordinate_f& other) const
-        {
-            return this->coord == other.coord;
-        }
+        g_f_type costs{0};
     };
+    /**
+     * Weight of the heuristic in the current search.
+     */
+    double weight{1.0};
+    /**
+     * Coordinates whose g-value plus heuristic is not smaller than this value are pruned during refinement searches.
+     */
+    std::optional<g_f_type> upper_bound{};
+    /**
+     * Coordinate at which the cheapest connection of both search directions found so far meets.
+     */
+    std::optional<coordinate<Lyt>> meeting_point{};
+    /**
+     * Costs of the path via the meeting point.
+     */
+    g_f_type meeting_costs{0};
+    /**
+     * Performs a single search with the given heuristic weight in the configured direction(s).
+     *
+     * @param w Heuristic weight.
+     * @return The found path and its costs.
+     */
+    search_result search(const double w)
+    {
+        weight = w;
 
+        return ps.bidirectional ? bidirectional_search() : forward_search();
+    }
     /**
-     * Priority queue for coordinates sorted by their f-values. Uses std::greater to get the smallest f-value on top...
-     * C++ is weird at times...
+     * Inflates the given heuristic value by the current weight.
+     *
+     * @param h Heuristic value.
+     * @return `h` multiplied by the current weight.
      */
-    using a_star_priority_queue =
-        searchable_priority_queue<coordinate_f, std::vector<coordinate_f>, std::greater<coordinate_f>>;
+    [[nodiscard]] g_f_type weighted(const dist_type h) const noexcept
+    {
+        if (weight == 1.0)
+        {
+            return static_cast<g_f_type>(h);
+        }
+
+        return static_cast<g_f_type>(weight * static_cast<double>(h));
+    }
     /**
-     * Open list that contains all coordinates to process next sorted by their f-value.
+     * Checks whether a coordinate with the given g-value and heuristic value can be skipped because it cannot lead to a
+     * path that is cheaper than the upper bound.
+     *
+     * @param g_val g-value of the coordinate.
+     * @param h Heuristic value of the coordinate.
+     * @return `true` iff the coordinate can be pruned.
      */
-    a_star_priority_queue open_list{};
+    [[nodiscard]] bool exceeds_upper_bound(const g_f_type g_val, const dist_type h) const noexcept
+    {
+        return upper_bound.has_value() && g_val + static_cast<g_f_type>(h) >= *upper_bound;
+    }
     /**
-     * Closed list that acts as a set of already visited coordinates.
+     * Unidirectional A* search from the source to the target.
+     *
+     * @return The found path and its costs.
      */
-    phmap::flat_hash_set<coordinate<Lyt>> closed_list{};
+    search_result forward_search()
+    {
+        state->prepare(coordinate_index.size());
+        state->open_list.push(coordinate_index(source), source, 0);
+
+        do {
+            // get coordinate with lowest f-value
+            const auto current = get_lowest_f_coord();
+
+            // if coord is the target, a path has been found
+            if (current == target)
+            {
+                return {reconstruct_path(), g(target)};
+            }
+            // don't examine the current coordinate again
+            state->close(coordinate_index(current));
+
+            // expand from current coordinate
+            expand(current);
+
+        } while (!state->open_list.empty());  // until the open list is empty
+
+        return {};                     // open list is empty, no path has been found
+    }
     /**
-     * Stores the g-cost for each coordinate c, i.e., the length of the shortest path from source to c found so far.
+     * Bidirectional A* search that alternates between expanding the smaller of both frontiers. Whenever a coordinate is
+     * reached from both sides, the costs of the connecting path are recorded. The search terminates as soon as no
+     * frontier can offer a cheaper connection anymore.
+     *
+     * @return The found path and its costs.
      */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, g_f_type> g_values{};
+    search_result bidirectional_search()
+    {
+        if (!backward_state.has_value())
+        {
+            backward_state.emplace(search_state_pool<search_state>::acquire());
+        }
+
+        auto& backward = **backward_state;
+
+        state->prepare(coordinate_index.size());
+        backward.prepare(coordinate_index.size());
+
+        state->open_list.push(coordinate_index(source), source, 0);
+        backward.open_list.push(coordinate_index(target), target, 0);
+
+        meeting_point.reset();
+
+        if (source == target)
+        {
+            meeting_point = source;
+            meeting_costs = 0;
+        }
+
+        while (!state->open_list.empty() && !backward.open_list.empty())
+        {
+            // if neither frontier can lead to a cheaper connection anymore
+            if (meeting_point.has_value() &&
+                meeting_costs <= std::max(state->open_list.top_priority(), backward.open_list.top_priority()))
+            {
+                break;
+            }
+
+            if (state->open_list.size() <= backward.open_list.size())
+            {
+                const auto current = get_lowest_f_coord();
+                state->close(coordinate_index(current));
+
+                // paths do not continue beyond the target
+                if (current != target)
+                {
+                    expand(current);
+                }
+            }
+            else
+            {
+                const auto current = backward.open_list.top();
+                backward.open_list.pop();
+                backward.close(coordinate_index(current));
+
+                // paths do not lead back to the source
+                if (current != source)
+                {
+                    expand_backward(current);
+                }
+            }
+        }
+
+        if (!meeting_point.has_value())
+        {
+            return {};
+        }
+
+        return {reconstruct_bidirectional_path(), meeting_costs};
+    }
     /**
-     * Tracks the origin of each coordinate to recreate the path.
+     * Checks whether the given search state has reached the coordinate with the given key.
+     *
+     * @param s Search state.
+     * @param key Key of the coordinate to check.
+     * @return `true` iff the coordinate is in the open or closed list of `s`.
      */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, coordinate<Lyt>> came_from{};
+    [[nodiscard]] static bool is_reached(const search_state& s, const std::size_t key) noexcept
+    {
+        return s.open_list.contains(key) || s.is_closed(key);
+    }
     /**
-     * Fetches and pops the coordinate with the lowest f-value from the open list priority queue.
+     * Records the given coordinate as the meeting point if it has been reached from both directions via a path that is
+     * cheaper than the best one found so far.
      *
-     * @return Coordinate with the lowest f-value from the open list.
+     * @param c Coordinate that has just been reached by one of the directions.
      */
-    coordinate<Lyt> get_lowest_f_coord() noexcept
+    void update_meeting_point(const coordinate<Lyt>& c) noexcept
     {
-        const auto current = open_list.top().coord;
-        open_list.pop();
+        const auto  key      = coordinate_index(c);
+        const auto& backward = **backward_state;
 
-        return current;
+        if (is_reached(*state, key) && is_reached(backward, key))
+        {
+            if (const auto costs = state->g(key) + backward.g(key);
+                !meeting_point.has_value() || costs < meeting_costs)
+            {
+                meeting_point = c;
+                meeting_costs = costs;
+            }
+        }
     }
     /**
-     * Expands the frontier of coordinates to visit next in the direction of the heuristic cost function.
+     * Applies a function to all coordinates that a path can be extended to from the given one, i.e., to all outgoing
+     * clock zones in the ground layer or, if crossings are enabled and the ground layer is occupied by a wire, in the
+     * crossing layer that are neither obstructed themselves nor connected via an obstructed connection.
      *
-     * @param current Coordinate that is currently examined.
+     * @tparam Fn Functor type.
+     * @param current Coordinate to extend from.
+     * @param fn Functor to apply to each successor.
      */
-    void expand(const coordinate<Lyt>& current) noexcept
+    template <typename Fn>
+    void foreach_successor(const coordinate<Lyt>& current, Fn&& fn) const
     {
         layout.foreach_outgoing_clocked_zone(
             current,
-            [this, current](auto successor)  // make a copy
+            [this, &current, &fn](auto successor)  // make a copy
             {
                 // return to ground layer to avoid getting stuck in crossing layer
                 successor = layout.below(successor);
@@ -214,6 +396,32 @@ class a_star_impl
                     }
                 }
 
+                std::invoke(fn, successor);
+            });
+    }
+    /**
+     * Fetches and pops the coordinate with the lowest f-value from the open list priority queue.
+     *
+     * @return Coordinate with the lowest f-value from the open list.
+     */
+    coordinate<Lyt> get_lowest_f_coord() noexcept
+    {
+        const auto current = state->open_list.top();
+        state->open_list.pop();
+
+        return current;
+    }
+    /**
+     * Expands the frontier of coordinates to visit next in the direction of the heuristic cost function.
+     *
+     * @param current Coordinate that is currently examined.
+     */
+    void expand(const coordinate<Lyt>& current) noexcept
+    {
+        foreach_successor(
+            current,
+            [this, &current](const auto& successor)
+            {
                 if (is_visited(successor))
                 {
                     return;  // skip any coordinate that is already in the closed list
@@ -222,67 +430,145 @@ class a_star_impl
                 // compute the g-value of cz. In this implementation, the costs of each 'step' are given by a function
                 const g_f_type tentative_g = g(current) + cost(current, successor);
 
-                // f-value does not matter because the comparator compares only the coordinates
-                const auto it = open_list.find({successor, 0});
-                if (it != open_list.end() && no_improvement(successor, tentative_g))
+                const auto key     = coordinate_index(successor);
+                const auto in_open = state->open_list.contains(key);
+                if (in_open && no_improvement(successor, tentative_g))
                 {
                     return;  // skip the coordinate if it does not offer improvement
                 }
 
+                // estimate the remaining distance to the target
+                const dist_type h = distance(layout, successor, target);
+                if (is_infinite_distance(h) || exceeds_upper_bound(tentative_g, h))
+                {
+                    return;  // skip the coordinate if the target cannot be reached (cheaply enough) from it
+                }
+
                 // track origin
-                came_from[successor] = current;
-                set_g(successor, tentative_g);
+                state->set_origin(key, current);
+                state->set_g(key, tentative_g);
 
                 // compute new f-value
-                const auto f = tentative_g + static_cast<g_f_type>(distance(layout, successor, target));
+                const auto f = tentative_g + weighted(h);
 
                 // if successor is contained in the open list (frontier)
-                if (it != open_list.end())
+                if (in_open)
                 {
-                    // update its f-value
-                    it->f = f;
+                    // decrease its f-value and restore the heap order
+                    state->open_list.decrease_key(key, f);
                 }
                 else
                 {
                     // add successor to the open list
-                    open_list.push({successor, f});
+                    state->open_list.push(key, successor, f);
+                }
+
+                if (ps.bidirectional)
+                {
+                    update_meeting_point(successor);
                 }
             });
     }
     /**
-     * Checks if a coordinate has been visited already.
+     * Expands the backward frontier from the given coordinate to all coordinates from which the forward search would
+     * move to it. Candidates are the incoming clock zones in both layers. Each of them is validated against the forward
+     * successor relation such that obstructions and crossings are treated exactly as in the forward direction.
      *
-     * @param c Coordinate to check.
-     * @return `true` iff c has already been visited.
+     * @param current Coordinate that is currently examined by the backward search.
      */
-    bool is_visited(const coordinate<Lyt>& c) const noexcept
+    void expand_backward(const coordinate<Lyt>& current) noexcept
     {
-        return closed_list.count(c) > 0;
+        layout.foreach_incoming_clocked_zone(layout.below(current),
+                                             [this, &current](const auto& predecessor)
+                                             {
+                                                 const auto ground = layout.below(predecessor);
+
+                                                 relax_backward(ground, current);
+
+                                                 if (const auto above = layout.above(ground); above != ground)
+                                                 {
+                                                     relax_backward(above, current);
+                                                 }
+                                             });
     }
     /**
-     * Returns the g-value of a coordinate by accessing the g_values map. Returns 0 if no entry exists.
+     * Updates the backward search state of `predecessor` via its connection to `current`.
      *
-     * @param c Coordinate whose g-value is desired.
-     * @return g-value of coordinate c or 0 if no value has been stored.
+     * @param predecessor Coordinate from which `current` might be reachable.
+     * @param current Coordinate that is currently examined by the backward search.
      */
-    g_f_type g(const coordinate<Lyt>& c) const noexcept
+    void relax_backward(const coordinate<Lyt>& predecessor, const coordinate<Lyt>& current) noexcept
     {
-        if (const auto it = g_values.find(c); it != g_values.cend())
+        auto& backward = **backward_state;
+
+        const auto key = coordinate_index(predecessor);
+
+        // paths do not pass through the target and closed coordinates need no further examination
+        if (predecessor == target || backward.is_closed(key))
+        {
+            return;
+        }
+
+        // check whether the forward search would take the connection from predecessor to current
+        bool is_connected = false;
+        foreach_successor(predecessor, [&is_connected, &current](const auto& s) { is_connected |= s == current; });
+
+        if (!is_connected)
+        {
+            return;
+        }
+
+        const g_f_type tentative_g = backward.g(coordinate_index(current)) + cost(predecessor, current);
+
+        const auto in_open = backward.open_list.contains(key);
+        if (in_open && tentative_g >= backward.g(key))
+        {
+            return;  // skip the coordinate if it does not offer improvement
+        }
+
+        // estimate the remaining distance from the source
+        const dist_type h = distance(layout, source, predecessor);
+        if (is_infinite_distance(h) || exceeds_upper_bound(tentative_g, h))
+        {
+            return;  // skip the coordinate if it cannot be reached (cheaply enough) from the source
+        }
+
+        // the origin of the backward search points towards the target
+        backward.set_origin(key, current);
+        backward.set_g(key, tentative_g);
+
+        const auto f = tentative_g + weighted(h);
+
+        if (in_open)
         {
-            return it->second;
+            backward.open_list.decrease_key(key, f);
+        }
+        else
+        {
+            backward.open_list.push(key, predecessor, f);
         }
 
-        return 0ul;
+        update_meeting_point(predecessor);
+    }
+    /**
+     * Checks if a coordinate has been visited already.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff c has already been visited.
+     */
+    bool is_visited(const coordinate<Lyt>& c) noexcept
+    {
+        return state->is_closed(coordinate_index(c));
     }
     /**
-     * Updates the g-value of the given coordinate to the given value.
+     * Returns the g-value of a coordinate. Returns 0 if no value has been stored.
      *
-     * @param c Coordinate whose g-value is to be updated to g_val.
-     * @param g_val New g-value for c.
+     * @param c Coordinate whose g-value is desired.
+     * @return g-value of coordinate c or 0 if no value has been stored.
      */
-    void set_g(const coordinate<Lyt>& c, const g_f_type g_val) noexcept
+    g_f_type g(const coordinate<Lyt>& c) noexcept
     {
-        g_values.insert_or_assign(c, g_val);
+        return state->g(coordinate_index(c));
     }
     /**
      * Checks if the given g-value is greater or equal than the stored g-value of the given coordinate. If that is the
@@ -301,12 +587,12 @@ class a_star_impl
      *
      * @return The shortest path connecting source and target.
      */
-    Path reconstruct_path() const noexcept
+    Path reconstruct_path() noexcept
     {
         Path path{};
 
         // iterate backwards over the found connections and add them to the path
-        for (auto current = target; current != source; current = came_from.at(current))
+        for (auto current = target; current != source; current = state->origin(coordinate_index(current)))
         {
             path.push_back(current);
         }
@@ -315,6 +601,33 @@ class a_star_impl
         // and reverse the path to bring it in proper order
         std::reverse(std::begin(path), std::end(path));
 
+        return path;
+    }
+    /**
+     * Reconstruct the final path of a bidirectional search by following the forward origins from the meeting point to
+     * the source and the backward origins from the meeting point to the target.
+     *
+     * @return The path connecting source and target via the meeting point.
+     */
+    Path reconstruct_bidirectional_path() noexcept
+    {
+        Path path{};
+
+        // forward part from the meeting point back to the source
+        for (auto current = *meeting_point; current != source; current = state->origin(coordinate_index(current)))
+        {
+            path.push_back(current);
+        }
+        path.push_back(source);
+        std::reverse(std::begin(path), std::end(path));
+
+        // backward part from the meeting point to the target
+        for (auto current = *meeting_point; current != target;)
+        {
+            current = (*backward_state)->origin(coordinate_index(current));
+            path.push_back(current);
+        }
+
         return path;
     }
 };
@@ -325,7 +638,12 @@ class a_star_impl
  * layout. A* is an extension of Dijkstra's algorithm for shortest paths but offers better average complexity. It uses a
  * heuristic distance function that estimates the remaining costs towards the target in every step. Thus, this heuristic
  * function should neither be complex to calculate nor overestimating the remaining costs. Common heuristics to be used
- * are the Manhattan and the Euclidean distance functions. See distance_functor for implementations.
+ * are the Manhattan and the Euclidean distance functions. Coordinates for which the heuristic returns an infinite
+ * distance (see is_infinite_distance) are considered to be unable to reach the target and are pruned.
+ *
+ * Distance and cost functions can be arbitrary callables. Their types are template parameters such that stateless
+ * function objects like manhattan_distance_fn and unit_cost_fn, which are used by default, can be inlined. The
+ * type-erased distance_functor and cost_functor are supported as well.
  *
  * If the given layout implements the obstruction interface (see obstruction_layout), paths will not be routed via
  * obstructed coordinates and connections.
@@ -335,6 +653,17 @@ class a_star_impl
  * if the crossing layer is not obstructed. Furthermore, it is ensured that crossings do not run along another wire but
  * cross only in a single point (orthogonal crossings + knock-knees/double wires).
  *
+ * For long routes, the search can be configured via the parameters to run bidirectionally, i.e., simultaneously from
+ * the source along outgoing and from the target along incoming clock zones, which yields paths of the same costs while
+ * usually expanding fewer coordinates. In that case, the distance function is not only called as
+ * `(layout, c, target)` to estimate the remaining costs from a coordinate `c` to the target, but also as
+ * `(layout, source, c)` to estimate the costs from the source to `c`. Thus, it must be admissible for arbitrary pairs
+ * of coordinates rather than only for those whose second element is the target.
+ *
+ * Furthermore, the heuristic can be inflated by a weight to quickly obtain a path whose costs are bounded by a factor
+ * of the optimum. Subsequent refinements with decreasing weights then improve this path, which turns the search into an
+ * anytime algorithm whose final refinement is optimal again.
+ *
  * A* was introduced in \"A Formal Basis for the Heuristic Determination of Minimum Cost Paths\" by Peter E. Hart, Nils
  * J. Nilsson, and Bertram Raphael in IEEE Transactions on Systems Science and Cybernetics 1968, Volume 4, Issue 2.
  *
@@ -342,24 +671,27 @@ class a_star_impl
  *
  * @tparam Path Path type to create.
  * @tparam Lyt Clocked layout type.
- * @tparam Dist Distance value type to be used in the heuristic estimation function.
- * @tparam Cost Cost value type to be used when determining moving cost between coordinates.
+ * @tparam DistFn Distance function type that maps from a layout and two of its coordinates to an arithmetic value.
+ * @tparam CostFn Cost function type that maps from two layout coordinates to an arithmetic value.
  * @param layout The clocked layout in which the shortest path between `source` and `target` is to be found.
  * @param objective Source-target coordinate pair.
- * @param dist_fn A distance functor that implements the desired heuristic estimation function.
- * @param cost_fn A cost functor that implements the desired cost function.
+ * @param dist_fn A distance function that implements the desired heuristic estimation function.
+ * @param cost_fn A cost function that implements the desired cost function.
  * @param ps Parameters.
  * @return The shortest loopless path in `layout` from `source` to `target`.
  */
-template <typename Path, typename Lyt, typename Dist = uint64_t, typename Cost = uint8_t>
-[[nodiscard]] Path a_star(const Lyt& layout, const routing_objective<Lyt>& objective,
-                          const distance_functor<Lyt, Dist>& dist_fn = manhattan_distance_functor<Lyt, uint64_t>(),
-                          const cost_functor<Lyt, Cost>&     cost_fn = unit_cost_functor<Lyt, uint8_t>(),
-                          a_star_params                      ps      = {}) noexcept
+template <typename Path, typename Lyt, typename DistFn = manhattan_distance_fn<uint64_t>,
+          typename CostFn = unit_cost_fn<uint8_t>>
+[[nodiscard]] Path a_star(const Lyt& layout, const routing_objective<Lyt>& objective, const DistFn& dist_fn = DistFn{},
+                          const CostFn& cost_fn = CostFn{}, a_star_params ps = {}) noexcept
 {
     static_assert(is_clocked_layout_v<Lyt>, "Lyt is not a clocked layout");
+    static_assert(std::is_invocable_v<const DistFn&, const Lyt&, const coordinate<Lyt>&, const coordinate<Lyt>&>,
+                  "DistFn is not a distance function on Lyt");
+    static_assert(std::is_invocable_v<const CostFn&, const coordinate<Lyt>&, const coordinate<Lyt>&>,
+                  "CostFn is not a cost function on coordinates of Lyt");
 
-    return detail::a_star_impl<Path, Lyt, Dist, Cost>{layout, objective, dist_fn, cost_fn, ps}.run();
+    return detail::a_star_impl<Path, Lyt, DistFn, CostFn>{layout, objective, dist_fn, cost_fn, ps}.run();
 }
 /**
  * A distance function that does not approximate but compute the actual minimum path length on the given layout via A*
@@ -371,19 +703,21 @@ template <typename Path, typename Lyt, typename Dist = uint64_t, typename Cost =
  *
  * @tparam Lyt Clocked layout type.
  * @tparam Dist Distance type.
+ * @tparam DistFn Distance function type to be used as the heuristic of the internal A* traversal.
  * @param layout The clocked layout in which the distance between `source` and `target` is to be determined.
  * @param source Source coordinate.
  * @param target Target coordinate.
+ * @param dist_fn Heuristic distance function of the internal A* traversal.
  * @return Minimum path length between `source` and `target`.
  */
-template <typename Lyt, typename Dist = uint64_t>
-[[nodiscard]] Dist a_star_distance(const Lyt& layout, const coordinate<Lyt>& source,
-                                   const coordinate<Lyt>& target) noexcept
+template <typename Lyt, typename Dist = uint64_t, typename DistFn = manhattan_distance_fn<uint64_t>>
+[[nodiscard]] Dist a_star_distance(const Lyt& layout, const coordinate<Lyt>& source, const coordinate<Lyt>& target,
+                                   const DistFn& dist_fn = DistFn{}) noexcept
 {
     static_assert(is_clocked_layout_v<Lyt>, "Lyt is not a clocked layout");
     static_assert(std::is_arithmetic_v<Dist>, "Dist is not an arithmetic type");
 
-    const auto path_length = a_star<layout_coordinate_path<Lyt>>(layout, {source, target}).size();
+    const auto path_length = a_star<layout_coordinate_path<Lyt>>(layout, {source, target}, dist_fn).size();
 
     if (path_length == 0ul)
     {
@@ -397,6 +731,28 @@ template <typename Lyt, typename Dist = uint64_t>
 
     return static_cast<Dist>(path_length - 1);
 }
+/**
+ * A function object that computes the A* distance (see a_star_distance) for any clocked layout. Its call operator can
+ * be inlined by the compiler.
+ *
+ * @tparam Dist Distance type.
+ * @tparam DistFn Distance function type to be used as the heuristic of the internal A* traversal.
+ */
+template <typename Dist = uint64_t, typename DistFn = manhattan_distance_fn<uint64_t>>
+struct a_star_distance_fn
+{
+    /**
+     * Heuristic distance function of the internal A* traversal.
+     */
+    DistFn heuristic{};
+
+    template <typename Lyt>
+    [[nodiscard]] Dist operator()(const Lyt& lyt, const coordinate<Lyt>& source,
+                                  const coordinate<Lyt>& target) const noexcept
+    {
+        return a_star_distance<Lyt, Dist>(lyt, source, target, heuristic);
+    }
+};
 /**
  * A pre-defined distance functor that uses the A* distance.
  *
@@ -407,7 +763,7 @@ template <typename Lyt, typename Dist = uint64_t>
 class a_star_distance_functor : public distance_functor<Lyt, Dist>
 {
   public:
-    a_star_distance_functor() : distance_functor<Lyt, Dist>(&a_star_distance<Lyt, Dist>) {}
+    a_star_distance_functor() : distance_functor<Lyt, Dist>(a_star_distance_fn<Dist>{}) {}
 };
 
 }  // namespace fiction
@@ -0,0 +1,498 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_CLOCKED_DISTANCE_ORACLE_HPP
+#define FICTION_CLOCKED_DISTANCE_ORACLE_HPP
+
+#include "fiction/algorithms/path_finding/a_star.hpp"
+#include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/routing_utils.hpp"
+
+#include <phmap.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Statistics of a clocked_distance_oracle.
+ */
+struct clocked_distance_oracle_stats
+{
+    /**
+     * Number of distance queries that were answered by a periodic distance table.
+     */
+    uint64_t num_table_queries{0ull};
+    /**
+     * Number of distance queries that were answered by a breadth-first search on the layout.
+     */
+    uint64_t num_fallback_queries{0ull};
+    /**
+     * Number of periodic distance tables that have been computed.
+     */
+    uint64_t num_tables{0ull};
+    /**
+     * Number of breadth-first searches that have been performed on the layout.
+     */
+    uint64_t num_bfs{0ull};
+};
+
+/**
+ * A distance oracle that answers queries for the length of the shortest clocked path between two tiles of a clocked
+ * layout, i.e., the value `a_star_distance` would return, without running a path search for each query.
+ *
+ * If the layout is Cartesian, obstruction-free, and clocked by one of the regular schemes 2DDWave, USE, RES, ESR, ROW,
+ * or COLUMNAR, the oracle exploits that the clock numbers repeat periodically with the scheme's cutout. Thereby, the
+ * distance between two tiles only depends on the position of the source within the cutout and on the offset of the
+ * target if the layout's borders are far enough away. For each of the cutout's positions, a distance table is computed
+ * once via breadth-first search on a virtual, periodically clocked grid that covers all offsets the layout admits.
+ * Such a table entry \f$ d \f$ is a lower bound for the actual distance and exact if the bounding box of source and
+ * target enlarged by \f$ (d - m) / 2 \f$ tiles, where \f$ m \f$ is their Manhattan distance, lies within the layout
+ * since no shortest path can leave this region. Hence, queries are answered in \f$ O(1) \f$ by a table look-up except
+ * for some pairs close to the layout's borders. Monotone schemes like 2DDWave, ROW, and COLUMNAR never require such an
+ * exception.
+ *
+ * In all other cases, i.e., close to the borders, for other layout topologies, irregular clocking, or if the layout
+ * implements the obstruction interface (see obstruction_layout), queries fall back to a breadth-first search on the
+ * layout starting from the queried source. The result is cached such that all further queries from the same source
+ * are answered in \f$ O(1) \f$ as well.
+ *
+ * Tables and cached searches are computed lazily on first use and reflect the layout's state at that time. If the
+ * layout's obstructions change, `clear_cache` has to be called. Copies of an oracle share their tables and caches. The
+ * oracle is not thread-safe.
+ *
+ * The oracle can be passed as a distance function to path finding algorithms like a_star. Its distances are exact and,
+ * thus, form a perfect heuristic in obstruction-free layouts.
+ *
+ * @tparam Lyt Clocked layout type.
+ * @tparam Dist Distance type.
+ */
+template <typename Lyt, typename Dist = uint64_t>
+class clocked_distance_oracle
+{
+  public:
+    /**
+     * Standard constructor. No distances are computed yet.
+     *
+     * @param lyt The clocked layout whose distances are to be determined. Since layouts are shallow copies, later
+     * changes to `lyt` are visible to the oracle.
+     */
+    explicit clocked_distance_oracle(const Lyt& lyt) : strg{std::make_shared<storage>(lyt)}
+    {
+        static_assert(is_clocked_layout_v<Lyt>, "Lyt is not a clocked layout");
+        static_assert(std::is_arithmetic_v<Dist>, "Dist is not an arithmetic type");
+
+        if constexpr (is_cartesian_layout_v<Lyt> && !has_is_obstructed_coordinate_v<Lyt> &&
+                      !has_is_obstructed_connection_v<Lyt> && !has_synchronization_elements_v<Lyt>)
+        {
+            const auto& layout = strg->layout;
+
+            if (layout.is_regularly_clocked() &&
+                (layout.is_clocking_scheme(clock_name::TWODDWAVE) || layout.is_clocking_scheme(clock_name::USE) ||
+                 layout.is_clocking_scheme(clock_name::RES) || layout.is_clocking_scheme(clock_name::ESR) ||
+                 layout.is_clocking_scheme(clock_name::ROW) || layout.is_clocking_scheme(clock_name::COLUMNAR)))
+            {
+                // the cutouts of all these schemes are quadratic with an edge length of the number of clocks
+                strg->period = static_cast<uint64_t>(layout.num_clocks());
+                strg->tables.resize(strg->period * strg->period);
+            }
+        }
+    }
+    /**
+     * Returns the length of the shortest clocked path from `source` to `target`.
+     *
+     * If no such path exists, the returned distance is `std::numeric_limits<Dist>::infinity()` if that value is
+     * supported by `Dist`, or `std::numeric_limits<Dist>::max()`, otherwise.
+     *
+     * @param source Source coordinate.
+     * @param target Target coordinate.
+     * @return Minimum path length between `source` and `target`.
+     */
+    [[nodiscard]] Dist distance(const coordinate<Lyt>& source, const coordinate<Lyt>& target) const
+    {
+        assert(strg->layout.is_within_bounds(source) && strg->layout.is_within_bounds(target) &&
+               "Both source and target coordinate have to be within the layout bounds");
+
+        // paths are routed in the ground layer; queries from or to other layers are rare and left to A*
+        if (source.z != 0 || target.z != 0)
+        {
+            ++strg->st.num_fallback_queries;
+
+            return a_star_distance<Lyt, Dist>(strg->layout, source, target);
+        }
+
+        if (strg->period != 0)
+        {
+            if (const auto d = table_distance(source, target); d.has_value())
+            {
+                ++strg->st.num_table_queries;
+
+                return to_dist(*d);
+            }
+        }
+
+        ++strg->st.num_fallback_queries;
+
+        return to_dist(bfs_distance(source, target));
+    }
+    /**
+     * Function call operator that allows to use the oracle as a distance function, e.g., in a_star.
+     *
+     * @param lyt Layout. It has to be the one the oracle was constructed for or one that wraps it.
+     * @param source Source coordinate.
+     * @param target Target coordinate.
+     * @return Minimum path length between `source` and `target`.
+     */
+    [[nodiscard]] Dist operator()([[maybe_unused]] const Lyt& lyt, const coordinate<Lyt>& source,
+                                  const coordinate<Lyt>& target) const
+    {
+        assert(lyt.x() == strg->layout.x() && lyt.y() == strg->layout.y() &&
+               "the oracle has been constructed for a different layout");
+
+        return distance(source, target);
+    }
+    /**
+     * Checks whether the oracle exploits the layout's periodic clocking, i.e., whether queries are answered via
+     * distance tables if possible.
+     *
+     * @return `true` iff periodic distance tables are used.
+     */
+    [[nodiscard]] bool is_periodic() const noexcept
+    {
+        return strg->period != 0;
+    }
+    /**
+     * Discards all cached breadth-first searches. This function has to be called whenever the layout's obstructions
+     * change. Periodic distance tables only depend on the clocking and, thus, remain valid.
+     */
+    void clear_cache() noexcept
+    {
+        strg->searches.clear();
+    }
+    /**
+     * Returns the statistics of all queries answered so far by this oracle and its copies.
+     *
+     * @return Statistics.
+     */
+    [[nodiscard]] const clocked_distance_oracle_stats& stats() const noexcept
+    {
+        return strg->st;
+    }
+
+  private:
+    /**
+     * Stored distances use a fixed-width type to keep tables compact.
+     */
+    using distance_value = uint32_t;
+    /**
+     * Marks unreachable tiles.
+     */
+    static constexpr const distance_value UNREACHABLE = std::numeric_limits<distance_value>::max();
+    /**
+     * Distances from a single position of the cutout to all tiles of a virtual grid that is periodically clocked like
+     * the layout.
+     */
+    struct periodic_table
+    {
+        /**
+         * Dimensions of the virtual grid.
+         */
+        uint64_t width{0ull}, height{0ull};
+        /**
+         * Position of the source in the virtual grid.
+         */
+        uint64_t origin_x{0ull}, origin_y{0ull};
+        /**
+         * Distances from the source to all tiles of the virtual grid in row-major order.
+         */
+        std::vector<distance_value> distances{};
+    };
+    /**
+     * Shared storage of oracle copies.
+     */
+    struct storage
+    {
+        explicit storage(const Lyt& lyt) : layout{lyt}, index{layout} {}
+        /**
+         * The layout whose distances are determined.
+         */
+        const Lyt layout;
+        /**
+         * Dense indices of the layout's tiles.
+         */
+        dense_coordinate_index<Lyt> index;
+        /**
+         * Edge length of the clocking scheme's cutout or 0 if periodic tables are not used.
+         */
+        uint64_t period{0ull};
+        /**
+         * Lazily computed distance tables for each position in the cutout in row-major order.
+         */
+        std::vector<std::optional<periodic_table>> tables{};
+        /**
+         * Lazily computed distances from sources to all tiles of the layout indexed by `index`.
+         */
+        phmap::flat_hash_map<coordinate<Lyt>, std::vector<distance_value>> searches{};
+        /**
+         * Statistics.
+         */
+        clocked_distance_oracle_stats st{};
+    };
+    /**
+     * Shared storage.
+     */
+    std::shared_ptr<storage> strg;
+    /**
+     * Converts a stored distance to the distance type.
+     *
+     * @param d Stored distance.
+     * @return `d` as `Dist` where unreachable tiles are mapped to an infinite distance.
+     */
+    [[nodiscard]] static Dist to_dist(const distance_value d) noexcept
+    {
+        if (d == UNREACHABLE)
+        {
+            if constexpr (std::numeric_limits<Dist>::has_infinity)
+            {
+                return std::numeric_limits<Dist>::infinity();
+            }
+
+            return std::numeric_limits<Dist>::max();
+        }
+
+        return static_cast<Dist>(d);
+    }
+    /**
+     * Looks up the distance between two ground-layer tiles in the periodic table of the source's cutout position and
+     * checks whether it is exact in the layout.
+     *
+     * @param source Source tile.
+     * @param target Target tile.
+     * @return Distance between `source` and `target` or `std::nullopt` if the table entry is not guaranteed to be
+     * exact.
+     */
+    [[nodiscard]] std::optional<distance_value> table_distance(const coordinate<Lyt>& source,
+                                                               const coordinate<Lyt>& target) const
+    {
+        const auto sx = static_cast<int64_t>(source.x);
+        const auto sy = static_cast<int64_t>(source.y);
+        const auto tx = static_cast<int64_t>(target.x);
+        const auto ty = static_cast<int64_t>(target.y);
+
+        const auto& table = periodic_table_of(static_cast<uint64_t>(sx) % strg->period,
+                                              static_cast<uint64_t>(sy) % strg->period);
+
+        const auto vx = static_cast<int64_t>(table.origin_x) + tx - sx;
+        const auto vy = static_cast<int64_t>(table.origin_y) + ty - sy;
+
+        const auto d = table.distances[static_cast<std::size_t>(vy) * table.width + static_cast<std::size_t>(vx)];
+
+        // the virtual grid contains all translated paths of the layout; if there is none, there is none in the layout
+        if (d == UNREACHABLE)
+        {
+            return d;
+        }
+
+        // no shortest path in the virtual grid can leave the bounding box of source and target by more tiles
+        const auto slack = (static_cast<int64_t>(d) - std::abs(tx - sx) - std::abs(ty - sy)) / 2;
+
+        if (std::min(sx, tx) - slack >= 0 && std::min(sy, ty) - slack >= 0 &&
+            std::max(sx, tx) + slack <= static_cast<int64_t>(strg->layout.x()) &&
+            std::max(sy, ty) + slack <= static_cast<int64_t>(strg->layout.y()))
+        {
+            return d;
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Returns the periodic table of the given cutout position and computes it if necessary.
+     *
+     * The virtual grid is large enough to contain each possible layout tile if the layout is translated such that any
+     * source tile with the same cutout position is mapped to the virtual source. Since translations by multiples of the
+     * cutout's edge length preserve the clocking, every path in the layout corresponds to a path in the virtual grid.
+     *
+     * @param rx Column in the cutout.
+     * @param ry Row in the cutout.
+     * @return Periodic table of position (`rx`, `ry`).
+     */
+    [[nodiscard]] const periodic_table& periodic_table_of(const uint64_t rx, const uint64_t ry) const
+    {
+        auto& entry = strg->tables[ry * strg->period + rx];
+
+        if (entry.has_value())
+        {
+            return *entry;
+        }
+
+        const auto& layout = strg->layout;
+        const auto  p      = strg->period;
+
+        // the clock numbers of the cutout determine the clocking of the entire virtual grid
+        std::vector<typename Lyt::clock_number_t> cutout(p * p);
+        for (uint64_t y = 0; y < p; ++y)
+        {
+            for (uint64_t x = 0; x < p; ++x)
+            {
+                cutout[y * p + x] = layout.get_clock_number({x, y});
+            }
+        }
+
+        const auto lx = static_cast<uint64_t>(layout.x());
+        const auto ly = static_cast<uint64_t>(layout.y());
+
+        periodic_table table{};
+        // smallest coordinates that admit offsets of up to lx and ly in each direction and have the right remainders
+        table.origin_x = lx + (rx + p - lx % p) % p;
+        table.origin_y = ly + (ry + p - ly % p) % p;
+        table.width    = table.origin_x + lx + 1;
+        table.height   = table.origin_y + ly + 1;
+        table.distances.assign(table.width * table.height, UNREACHABLE);
+
+        const auto clock = [&cutout, p](const uint64_t x, const uint64_t y) { return cutout[(y % p) * p + x % p]; };
+
+        std::deque<std::pair<uint64_t, uint64_t>> queue{{table.origin_x, table.origin_y}};
+        table.distances[table.origin_y * table.width + table.origin_x] = 0;
+
+        while (!queue.empty())
+        {
+            const auto [x, y] = queue.front();
+            queue.pop_front();
+
+            const auto d    = table.distances[y * table.width + x];
+            const auto next = static_cast<typename Lyt::clock_number_t>((clock(x, y) + 1) % layout.num_clocks());
+
+            const auto visit = [&table, &queue, &clock, d, next](const uint64_t nx, const uint64_t ny)
+            {
+                if (clock(nx, ny) == next && table.distances[ny * table.width + nx] == UNREACHABLE)
+                {
+                    table.distances[ny * table.width + nx] = d + 1;
+                    queue.emplace_back(nx, ny);
+                }
+            };
+
+            // 4-neighborhood of Cartesian layouts
+            if (y > 0)
+            {
+                visit(x, y - 1);
+            }
+            if (x + 1 < table.width)
+            {
+                visit(x + 1, y);
+            }
+            if (y + 1 < table.height)
+            {
+                visit(x, y + 1);
+            }
+            if (x > 0)
+            {
+                visit(x - 1, y);
+            }
+        }
+
+        ++strg->st.num_tables;
+
+        return entry.emplace(std::move(table));
+    }
+    /**
+     * Returns the distance between two ground-layer tiles via a cached breadth-first search from the source. The
+     * search mimics the A* traversal of `a_star_distance`, i.e., obstructed tiles can only be entered as the target.
+     *
+     * @param source Source tile.
+     * @param target Target tile.
+     * @return Distance between `source` and `target` or `UNREACHABLE`.
+     */
+    [[nodiscard]] distance_value bfs_distance(const coordinate<Lyt>& source, const coordinate<Lyt>& target) const
+    {
+        auto& index = strg->index;
+
+        auto [it, inserted] = strg->searches.try_emplace(source);
+        auto& distances     = it->second;
+
+        const auto dist = [&index, &distances](const coordinate<Lyt>& c) -> distance_value&
+        {
+            const auto key = index(c);
+            if (key >= distances.size())
+            {
+                distances.resize(std::max(key + 1, index.size()), UNREACHABLE);
+            }
+
+            return distances[key];
+        };
+
+        if (inserted)
+        {
+            const auto& layout = strg->layout;
+
+            distances.assign(index.size(), UNREACHABLE);
+
+            std::deque<coordinate<Lyt>> queue{source};
+            dist(source) = 0;
+
+            while (!queue.empty())
+            {
+                const auto current = queue.front();
+                queue.pop_front();
+
+                const auto d = dist(current);
+
+                layout.foreach_outgoing_clocked_zone(
+                    current,
+                    [&layout, &queue, &dist, &current, d](auto successor)  // make a copy
+                    {
+                        // return to ground layer as A* does
+                        successor = layout.below(successor);
+
+                        if constexpr (has_is_obstructed_connection_v<Lyt>)
+                        {
+                            if (layout.is_obstructed_connection(current, successor))
+                            {
+                                return;
+                            }
+                        }
+
+                        auto& ds = dist(successor);
+
+                        if (ds != UNREACHABLE)
+                        {
+                            return;
+                        }
+
+                        ds = d + 1;
+
+                        // obstructed tiles are reachable as targets but cannot be passed through
+                        if constexpr (has_is_obstructed_coordinate_v<Lyt>)
+                        {
+                            if (layout.is_obstructed_coordinate(successor))
+                            {
+                                return;
+                            }
+                        }
+
+                        queue.push_back(successor);
+                    });
+            }
+
+            ++strg->st.num_bfs;
+        }
+
+        return dist(target);
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_CLOCKED_DISTANCE_ORACLE_HPP
@@ -7,6 +7,7 @@
 
 #include "fiction/traits.hpp"
 
+#include <cstdint>
 #include <functional>
 #include <random>
 #include <type_traits>
@@ -54,6 +55,34 @@ template <typename Lyt, typename Cost = double>
     return distr(engine);
 }
 
+/**
+ * A stateless function object that assigns unit costs (see unit_cost) to connections between coordinates of any
+ * layout. In contrast to unit_cost_functor, its call operator is neither virtual nor type-erased. Therefore, it can be
+ * inlined by the compiler when passed as a template parameter to, e.g., path finding algorithms.
+ *
+ * @tparam Cost Integral cost type.
+ */
+template <typename Cost = uint8_t>
+struct unit_cost_fn
+{
+    template <typename CoordinateType>
+    [[nodiscard]] constexpr Cost operator()([[maybe_unused]] const CoordinateType& source,
+                                            [[maybe_unused]] const CoordinateType& target) const noexcept
+    {
+        static_assert(std::is_integral_v<Cost>, "Cost is not an integral type");
+
+        return static_cast<Cost>(1);
+    }
+};
+/**
+ * Determines the value type of a cost function, i.e., of a callable that maps from two layout coordinates to a cost.
+ *
+ * @tparam Lyt Coordinate layout type.
+ * @tparam CostFn Cost function type.
+ */
+template <typename Lyt, typename CostFn>
+using cost_type = std::decay_t<std::invoke_result_t<const CostFn&, const coordinate<Lyt>&, const coordinate<Lyt>&>>;
+
 // NOLINTBEGIN(*-special-member-functions): virtual destructor is prudent
 
 /**
@@ -61,6 +90,9 @@ template <typename Lyt, typename Cost = double>
  * with a standardized signature. This class is intended to be instantiated with concrete cost functions passed to the
  * constructor.
  *
+ * Since the cost function is type-erased, each call is dispatched dynamically. Where the cost function is known at
+ * compile time, stateless function objects like unit_cost_fn should be preferred as they can be inlined.
+ *
  * @tparam Lyt Coordinate layout type.
  * @tparam Cost Cost value type.
  */
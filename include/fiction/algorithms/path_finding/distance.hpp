@@ -11,6 +11,7 @@
 #include <cmath>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <type_traits>
 
 namespace fiction
@@ -62,6 +63,35 @@ template <typename Lyt, typename Dist = double>
 
     return static_cast<Dist>(std::hypot(x, y));
 }
+/**
+ * The 2DDWave distance \f$ D \f$ between two layout coordinates \f$ s = (x_1, y_1) \f$ and \f$ t = (x_2, y_2) \f$
+ * given by
+ *
+ *  \f$ D = |x_1 - x_2| + |y_1 - y_2| \f$ iff \f$ s \leq t \f$ and \f$ \infty \f$, otherwise
+ *
+ * Thereby, \f$ s \leq t \f$ iff \f$ x_1 \leq x_2 \f$ and \f$ y_1 \leq y_2 \f$. Since information in 2DDWave-clocked
+ * layouts can only flow eastwards and southwards, the Manhattan distance is only admissible if `target` is located to
+ * the south-east of `source`. All other targets are unreachable.
+ *
+ * @note To represent \f$ \infty \f$ in the given integral type, `std::numeric_limits<Dist>::max()` is returned.
+ *
+ * @tparam Lyt Coordinate layout type.
+ * @tparam Dist Integral type for the distance.
+ * @param lyt Layout.
+ * @param source Source coordinate.
+ * @param target Target coordinate.
+ * @return 2DDWave distance between `source` and `target`.
+ */
+template <typename Lyt, typename Dist = uint64_t>
+[[nodiscard]] constexpr Dist twoddwave_distance(const Lyt& lyt, const coordinate<Lyt>& source,
+                                                const coordinate<Lyt>& target) noexcept
+{
+    static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+    static_assert(std::is_integral_v<Dist>, "Dist is not an integral type");
+
+    return source.x <= target.x && source.y <= target.y ? manhattan_distance<Lyt, Dist>(lyt, source, target) :
+                                                          std::numeric_limits<Dist>::max();
+}
 /**
  * Computes the distance between two SiDB cells in nanometers.
  *
@@ -90,6 +120,87 @@ sidb_nanometer_distance([[maybe_unused]] const Lyt& lyt, const coordinate<Lyt>&
     return static_cast<Dist>(std::hypot(x, y));
 }
 
+/**
+ * A stateless function object that computes the Manhattan distance (see manhattan_distance) for any coordinate layout.
+ * In contrast to manhattan_distance_functor, its call operator is neither virtual nor type-erased. Therefore, it can be
+ * inlined by the compiler when passed as a template parameter to, e.g., path finding algorithms.
+ *
+ * @tparam Dist Integral distance type.
+ */
+template <typename Dist = uint64_t>
+struct manhattan_distance_fn
+{
+    template <typename Lyt>
+    [[nodiscard]] constexpr Dist operator()(const Lyt& lyt, const coordinate<Lyt>& source,
+                                            const coordinate<Lyt>& target) const noexcept
+    {
+        return manhattan_distance<Lyt, Dist>(lyt, source, target);
+    }
+};
+/**
+ * A stateless function object that computes the Euclidean distance (see euclidean_distance) for any coordinate layout.
+ * Its call operator can be inlined by the compiler.
+ *
+ * @tparam Dist Floating-point distance type.
+ */
+template <typename Dist = double>
+struct euclidean_distance_fn
+{
+    template <typename Lyt>
+    [[nodiscard]] constexpr Dist operator()(const Lyt& lyt, const coordinate<Lyt>& source,
+                                            const coordinate<Lyt>& target) const noexcept
+    {
+        return euclidean_distance<Lyt, Dist>(lyt, source, target);
+    }
+};
+/**
+ * A stateless function object that computes the 2DDWave distance (see twoddwave_distance) for any coordinate layout.
+ * Its call operator can be inlined by the compiler.
+ *
+ * @tparam Dist Integral distance type.
+ */
+template <typename Dist = uint64_t>
+struct twoddwave_distance_fn
+{
+    template <typename Lyt>
+    [[nodiscard]] constexpr Dist operator()(const Lyt& lyt, const coordinate<Lyt>& source,
+                                            const coordinate<Lyt>& target) const noexcept
+    {
+        return twoddwave_distance<Lyt, Dist>(lyt, source, target);
+    }
+};
+/**
+ * Checks whether a distance value represents an unreachable target, i.e., whether it equals
+ * `std::numeric_limits<Dist>::infinity()` if that value is supported by `Dist`, or `std::numeric_limits<Dist>::max()`,
+ * otherwise. Path finding algorithms use this check to prune coordinates from which the target cannot be reached.
+ *
+ * @tparam Dist Arithmetic distance type.
+ * @param dist Distance value to check.
+ * @return `true` iff `dist` represents an infinite distance.
+ */
+template <typename Dist>
+[[nodiscard]] constexpr bool is_infinite_distance(const Dist dist) noexcept
+{
+    static_assert(std::is_arithmetic_v<Dist>, "Dist is not an arithmetic type");
+
+    if constexpr (std::numeric_limits<Dist>::has_infinity)
+    {
+        return dist == std::numeric_limits<Dist>::infinity();
+    }
+
+    return dist == std::numeric_limits<Dist>::max();
+}
+/**
+ * Determines the value type of a distance function, i.e., of a callable that maps from a layout and two of its
+ * coordinates to a distance.
+ *
+ * @tparam Lyt Coordinate layout type.
+ * @tparam DistFn Distance function type.
+ */
+template <typename Lyt, typename DistFn>
+using distance_type = std::decay_t<
+    std::invoke_result_t<const DistFn&, const Lyt&, const coordinate<Lyt>&, const coordinate<Lyt>&>>;
+
 // NOLINTBEGIN(*-special-member-functions): virtual destructor is prudent
 
 /**
@@ -97,6 +208,9 @@ sidb_nanometer_distance([[maybe_unused]] const Lyt& lyt, const coordinate<Lyt>&
  * algorithms with a standardized signature. This class is intended to be instantiated with concrete distance functions
  * passed to the constructor.
  *
+ * Since the distance function is type-erased, each call is dispatched dynamically. Where the distance function is known
+ * at compile time, stateless function objects like manhattan_distance_fn should be preferred as they can be inlined.
+ *
  * @tparam Lyt Coordinate layout type.
  * @tparam Dist Distance value type.
  */
@@ -167,6 +281,19 @@ class euclidean_distance_functor : public distance_functor<Lyt, Dist>
     euclidean_distance_functor() : distance_functor<Lyt, Dist>(&euclidean_distance<Lyt, Dist>) {}
 };
 
+/**
+ * A pre-defined distance functor that uses the 2DDWave distance.
+ *
+ * @tparam Lyt Coordinate layout type.
+ * @tparam Dist Integral distance type.
+ */
+template <typename Lyt, typename Dist = uint64_t>
+class twoddwave_distance_functor : public distance_functor<Lyt, Dist>
+{
+  public:
+    twoddwave_distance_functor() : distance_functor<Lyt, Dist>(&twoddwave_distance<Lyt, Dist>) {}
+};
+
 }  // namespace fiction
 
 #endif  // FICTION_DISTANCE_HPP
@@ -10,6 +10,14 @@
 
 #include <phmap.h>
 
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace fiction
 {
 
@@ -22,23 +30,34 @@ struct enumerate_all_clocking_paths_params
      * Allow paths to cross over obstructed tiles if they are occupied by wire segments.
      */
     bool crossings = false;
+    /**
+     * Maximum number of coordinates a path may consist of. Partial paths that reach this length without arriving at the
+     * target are not explored any further. If no value is given, path lengths are only bounded by the layout size.
+     */
+    std::optional<uint64_t> max_path_length = std::nullopt;
+    /**
+     * Maximum number of paths to enumerate. The enumeration terminates as soon as this many paths have been found. If
+     * no value is given, all paths are enumerated.
+     */
+    std::optional<uint64_t> max_num_paths = std::nullopt;
 };
 
 namespace detail
 {
 
-template <typename Path, typename Lyt>
+template <typename Path, typename Lyt, typename Fn>
 class enumerate_all_clocking_paths_impl
 {
   public:
-    enumerate_all_clocking_paths_impl(const Lyt& lyt, const routing_objective<Lyt>& obj,
+    enumerate_all_clocking_paths_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, Fn&& f,
                                       const enumerate_all_clocking_paths_params p) :
             layout{lyt},
             objective{obj},
+            fn{std::forward<Fn>(f)},
             ps{p}
     {}
 
-    [[nodiscard]] path_collection<Path> run()
+    void run()
     {
         assert(!objective.source.is_dead() && !objective.target.is_dead() &&
                "Neither source nor target coordinate can be dead");
@@ -46,21 +65,80 @@ class enumerate_all_clocking_paths_impl
         assert(layout.is_within_bounds(objective.source) && layout.is_within_bounds(objective.target) &&
                "Both source and target coordinate have to be within the layout bounds");
 
-        recursively_enumerate_all_paths(objective.source, objective.target, Path{});
+        if (ps.max_num_paths.has_value() && *ps.max_num_paths == 0)
+        {
+            return;
+        }
+
+        // depth-first search with an explicit stack; the prefix of the current path is shared by all its extensions
+        if (!enter(objective.source))
+        {
+            return;
+        }
 
-        return collection;
+        while (depth > 0)
+        {
+            auto& top = stack[depth - 1];
+
+            // if the current coordinate has unexplored successors
+            if (top.next < top.successors.size())
+            {
+                // copy the successor because entering it might reallocate the stack
+                const auto successor = top.successors[top.next++];
+
+                if (!enter(successor))
+                {
+                    return;  // the visitor requested termination
+                }
+            }
+            else  // all successors have been explored
+            {
+                leave();
+            }
+        }
     }
 
   private:
+    /**
+     * A coordinate on the current path together with its successors that are yet to be explored.
+     */
+    struct frame
+    {
+        /**
+         * Successors of the coordinate that passed the obstruction and visitation checks when it was entered.
+         */
+        std::vector<coordinate<Lyt>> successors{};
+        /**
+         * Index of the next successor to explore.
+         */
+        std::size_t next{0};
+    };
+
     const Lyt& layout;
 
     const routing_objective<Lyt> objective;
 
+    Fn fn;
+
     enumerate_all_clocking_paths_params ps;
 
     phmap::flat_hash_set<coordinate<Lyt>> visited{};
-
-    path_collection<Path> collection{};
+    /**
+     * Prefix of all paths that are currently being explored.
+     */
+    Path prefix{};
+    /**
+     * Explicit search stack. Its frames are not destroyed on backtracking such that their memory can be reused.
+     */
+    std::vector<frame> stack{};
+    /**
+     * Number of active frames in the stack.
+     */
+    std::size_t depth{0};
+    /**
+     * Number of paths that have been passed to the visitor thus far.
+     */
+    uint64_t num_paths{0};
 
     void mark_visited(const coordinate<Lyt>& c) noexcept
     {
@@ -76,84 +154,183 @@ class enumerate_all_clocking_paths_impl
     {
         return visited.count(c) > 0;
     }
+    /**
+     * Appends the given coordinate to the prefix. If it is the target, the prefix is reported as a path and removed
+     * again right away. Otherwise, a new frame holding its successors is pushed onto the stack.
+     *
+     * @param c Coordinate to enter.
+     * @return `false` iff the enumeration should terminate.
+     */
+    [[nodiscard]] bool enter(const coordinate<Lyt>& c)
+    {
+        // mark coordinate as visited and append it to the path
+        mark_visited(c);
+        prefix.append(c);
+
+        // if the target is reached, a path has been found
+        if (c == objective.target)
+        {
+            const auto proceed = report();
+
+            prefix.pop_back();
+            mark_unvisited(c);
+
+            return proceed;
+        }
+
+        // if the maximum path length is reached, there is no need to explore any further
+        if (ps.max_path_length.has_value() && prefix.size() >= *ps.max_path_length)
+        {
+            prefix.pop_back();
+            mark_unvisited(c);
+
+            return true;
+        }
+
+        if (depth == stack.size())
+        {
+            stack.emplace_back();
+        }
+
+        auto& f = stack[depth];
+        f.next  = 0;
+        f.successors.clear();
+
+        collect_successors(c, f.successors);
+
+        ++depth;
+
+        return true;
+    }
+    /**
+     * Pops the topmost frame from the stack and removes its coordinate from the prefix such that it can be part of
+     * other paths.
+     */
+    void leave() noexcept
+    {
+        --depth;
 
-    void recursively_enumerate_all_paths(const coordinate<Lyt>& src, const coordinate<Lyt>& tgt, Path p) noexcept
+        mark_unvisited(prefix.back());
+        prefix.pop_back();
+    }
+    /**
+     * Passes the current prefix to the visitor.
+     *
+     * @return `false` iff the enumeration should terminate.
+     */
+    [[nodiscard]] bool report()
     {
-        // mark source coordinate as visited and append it to the path
-        mark_visited(src);
-        p.append(src);
+        ++num_paths;
 
-        // if source and target are identical, a path has been found
-        if (src == tgt)
+        if constexpr (std::is_same_v<std::invoke_result_t<Fn, const Path&>, bool>)
         {
-            collection.add(p);
+            if (!std::invoke(fn, std::as_const(prefix)))
+            {
+                return false;
+            }
         }
-        else  // destination is not reached yet
+        else
         {
-            // recurse for all outgoing clock zones
-            layout.foreach_outgoing_clocked_zone(
-                src,
-                [&, this](auto successor)  // make a copy
-                {
-                    // return to ground layer to avoid getting stuck in crossing layer
-                    successor = layout.below(successor);
+            std::invoke(fn, std::as_const(prefix));
+        }
 
-                    // check if successor is obstructed
-                    if constexpr (has_is_obstructed_coordinate_v<Lyt>)
+        return !(ps.max_num_paths.has_value() && num_paths >= *ps.max_num_paths);
+    }
+    /**
+     * Stores all outgoing clock zones of the given coordinate that can extend the current prefix in the given vector.
+     *
+     * @param src Coordinate whose successors are to be collected.
+     * @param successors Vector to store the successors in.
+     */
+    void collect_successors(const coordinate<Lyt>& src, std::vector<coordinate<Lyt>>& successors) const
+    {
+        const auto& tgt = objective.target;
+
+        layout.foreach_outgoing_clocked_zone(
+            src,
+            [&, this](auto successor)  // make a copy
+            {
+                // return to ground layer to avoid getting stuck in crossing layer
+                successor = layout.below(successor);
+
+                // check if successor is obstructed
+                if constexpr (has_is_obstructed_coordinate_v<Lyt>)
+                {
+                    if (layout.is_obstructed_coordinate(successor) && successor != tgt)
                     {
-                        if (layout.is_obstructed_coordinate(successor) && successor != tgt)
+                        // if crossings are enabled, check if it is possible to switch to the crossing layer
+                        if (ps.crossings && is_crossable_wire(layout, src, successor))
                         {
-                            // if crossings are enabled, check if it is possible to switch to the crossing layer
-                            if (ps.crossings && is_crossable_wire(layout, src, successor))
+                            // if the crossing layer is not obstructed
+                            if (const auto above_successor = layout.above(successor);
+                                above_successor != successor && above_successor != tgt &&
+                                !layout.is_obstructed_coordinate(above_successor))
                             {
-                                // if the crossing layer is not obstructed
-                                if (const auto above_successor = layout.above(successor);
-                                    above_successor != successor && above_successor != tgt &&
-                                    !layout.is_obstructed_coordinate(above_successor))
-                                {
-                                    // allow exploring the crossing layer
-                                    successor = above_successor;
-                                }
-                                else
-                                {
-                                    return;  // skip the obstructed coordinate and keep looping
-                                }
+                                // allow exploring the crossing layer
+                                successor = above_successor;
                             }
                             else
                             {
                                 return;  // skip the obstructed coordinate and keep looping
                             }
                         }
-                    }
-
-                    // check if the connection to the successor is obstructed
-                    if constexpr (has_is_obstructed_connection_v<Lyt>)
-                    {
-                        if (layout.is_obstructed_connection(src, successor))
+                        else
                         {
-                            return;  // skip the obstructed connection and keep looping
+                            return;  // skip the obstructed coordinate and keep looping
                         }
                     }
+                }
 
-                    // if the successor has not yet been visited
-                    if (!is_visited(successor))
+                // check if the connection to the successor is obstructed
+                if constexpr (has_is_obstructed_connection_v<Lyt>)
+                {
+                    if (layout.is_obstructed_connection(src, successor))
                     {
-                        // recurse
-                        recursively_enumerate_all_paths(successor, tgt, p);
+                        return;  // skip the obstructed connection and keep looping
                     }
+                }
 
-                    return;  // keep looping
-                });
-        }
+                // the prefix does not change while the successors are explored; hence, the check remains valid
+                if (!is_visited(successor))
+                {
+                    successors.push_back(successor);
+                }
 
-        // after recursion, remove current coordinate from path and mark it as unvisited to allow it in other paths
-        p.pop_back();
-        mark_unvisited(src);
+                return;  // keep looping
+            });
     }
 };
 
 }  // namespace detail
 
+/**
+ * Enumerates all possible paths in a clocked layout that start at coordinate source and lead to coordinate target while
+ * respecting the information flow imposed by the clocking scheme and passes each of them to the given visitor instead
+ * of storing them. This algorithm does neither generate duplicate nor looping paths, even in a cyclic clocking scheme.
+ * That is, along each path, each coordinate can occur at maximum once.
+ *
+ * The enumeration is a depth-first search with an explicit stack that shares a single prefix buffer among all paths.
+ * Hence, its memory consumption is linear in the length of the longest path and independent of the number of paths.
+ *
+ * Obstructions and crossings are handled as in enumerate_all_clocking_paths.
+ *
+ * @tparam Path Type of the individual paths.
+ * @tparam Lyt Type of the clocked layout to perform path finding on.
+ * @tparam Fn Functor type that receives a `const Path&` and may return `bool` to signal whether to continue.
+ * @param layout The clocked layout whose paths are to be enumerated.
+ * @param objective Source-target coordinate pair.
+ * @param fn Visitor that is called once for each path. The given reference is only valid during the call. If `fn`
+ * returns `false`, the enumeration terminates.
+ * @param ps Parameters.
+ */
+template <typename Path, typename Lyt, typename Fn>
+void foreach_clocking_path(const Lyt& layout, const routing_objective<Lyt>& objective, Fn&& fn,
+                           enumerate_all_clocking_paths_params ps = {})
+{
+    static_assert(is_clocked_layout_v<Lyt>, "Lyt is not a clocked layout");
+
+    detail::enumerate_all_clocking_paths_impl<Path, Lyt, Fn>{layout, objective, std::forward<Fn>(fn), ps}.run();
+}
 /**
  * Enumerates all possible paths in a clocked layout that start at coordinate source and lead to coordinate target while
  * respecting the information flow imposed by the clocking scheme. This algorithm does neither generate duplicate nor
@@ -167,6 +344,9 @@ class enumerate_all_clocking_paths_impl
  * if the crossing layer is not obstructed. Furthermore, it is ensured that crossings do not run along another wire but
  * cross only in a single point (orthogonal crossings + knock-knees/double wires).
  *
+ * Since the number of paths can grow exponentially with the distance between source and target, consider bounding it
+ * via the parameters or consuming the paths one by one via foreach_clocking_path.
+ *
  * @tparam Path Type of the returned individual paths.
  * @tparam Lyt Type of the clocked layout to perform path finding on.
  * @param layout The clocked layout whose paths are to be enumerated.
@@ -181,7 +361,11 @@ template <typename Path, typename Lyt>
 {
     static_assert(is_clocked_layout_v<Lyt>, "Lyt is not a clocked layout");
 
-    return detail::enumerate_all_clocking_paths_impl<Path, Lyt>{layout, objective, ps}.run();
+    path_collection<Path> collection{};
+
+    foreach_clocking_path<Path>(layout, objective, [&collection](const Path& p) { collection.add(p); }, ps);
+
+    return collection;
 }
 
 }  // namespace fiction
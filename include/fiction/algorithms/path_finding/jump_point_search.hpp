@@ -6,12 +6,11 @@
 #define FICTION_JUMP_POINT_SEARCH_HPP
 
 #include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/algorithms/path_finding/search_state.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/routing_utils.hpp"
 #include "fiction/utils/stl_utils.hpp"
 
-#include <phmap.h>
-
 #include <algorithm>
 #include <cassert>
 #include <cmath>
@@ -27,18 +26,18 @@ namespace fiction
 namespace detail
 {
 
-template <typename Path, typename Lyt, typename Dist>
+template <typename Path, typename Lyt, typename DistFn>
 class jump_point_search_impl
 {
   public:
-    jump_point_search_impl(const Lyt& lyt, const routing_objective<Lyt>& obj,
-                           const distance_functor<Lyt, Dist>& dist_fn) :
+    jump_point_search_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const DistFn& dist_fn) :
             layout{lyt},
             source{obj.source},
             target{obj.target},
             distance{dist_fn}
     {
-        open_list.push(coordinate_f{source, 0});
+        state->prepare(coordinate_index.size());
+        state->open_list.push(coordinate_index(source), source, 0);
     }
 
     Path run()
@@ -58,12 +57,12 @@ class jump_point_search_impl
                 return reconstruct_path();
             }
             // don't examine the current coordinate again
-            closed_list.insert(current);
+            state->close(coordinate_index(current));
 
             // expand from current coordinate
             expand(current);
 
-        } while (!open_list.empty());  // until the open list is empty
+        } while (!state->open_list.empty());  // until the open list is empty
 
         return {};                     // open list is empty, no path has been found
     }
@@ -73,62 +72,24 @@ class jump_point_search_impl
 
     const coordinate<Lyt> source, target;
 
-    const distance_functor<Lyt, Dist> distance;
+    const DistFn distance;
 
     /**
-     * Stores a coordinate and its f-value.
-     */
-    struct coordinate_f
-    {
-        coordinate<Lyt> coord;
-
-        Dist f;
-
-        /**
-         * Comparator for the priority queue. Compares only the f-values.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this f-value is greater than the other's.
-         */
-        bool operator>(const coordinate_f& other) const
-        {
-            return this->f > other.f;
-        }
-        /**
-         * Equality operator that only compares the stored coordinates. This allows for a convenient lookup in the
-         * priority queue.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this coord value is equal to the other's.
-         */
-        bool operator==(const coordinate_f& other) const
-        {
-            return this->coord == other.coord;
-        }
-    };
-
-    /**
-     * Priority queue for coordinates sorted by their f-values. Uses std::greater to get the smallest f-value on top...
-     * C++ is weird at times...
-     */
-    using jump_point_search_priority_queue =
-        searchable_priority_queue<coordinate_f, std::vector<coordinate_f>, std::greater<coordinate_f>>;
-    /**
-     * Open list that contains all coordinates to process next sorted by their f-value.
+     * Value type of the distance function.
      */
-    jump_point_search_priority_queue open_list{};
+    using dist_type = distance_type<Lyt, DistFn>;
     /**
-     * Closed list that acts as a set of already visited coordinates.
+     * Open and closed list, g-values, and origins of all coordinates stored in flat arrays.
      */
-    phmap::flat_hash_set<coordinate<Lyt>> closed_list{};
+    using search_state = path_search_state<coordinate<Lyt>, dist_type>;
     /**
-     * Stores the g-cost for each coordinate c, i.e., the length of the shortest path from source to c found so far.
+     * Dense indices of the layout coordinates that serve as keys in the search state.
      */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, Dist> g_values{};
+    dense_coordinate_index<Lyt> coordinate_index{layout};
     /**
-     * Tracks the origin of each coordinate to recreate the path.
+     * Search state that is reused from previous searches on the same thread to avoid reallocation.
      */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, coordinate<Lyt>> came_from{};
+    typename search_state_pool<search_state>::handle state{search_state_pool<search_state>::acquire()};
     /**
      * Fetches and pops the coordinate with the lowest f-value from the open list priority queue.
      *
@@ -136,8 +97,8 @@ class jump_point_search_impl
      */
     coordinate<Lyt> get_lowest_f_coord() noexcept
     {
-        const auto current = open_list.top().coord;
-        open_list.pop();
+        const auto current = state->open_list.top();
+        state->open_list.pop();
 
         return current;
     }
@@ -179,32 +140,39 @@ class jump_point_search_impl
                     }
 
                     // compute the g-value of current. Add the distance to the jump point as it might not be adjacent
-                    const auto tentative_g = g(current) + distance(layout, *jump_point, current);
+                    const dist_type tentative_g = g(current) + distance(layout, current, *jump_point);
 
-                    // f-value does not matter because the comparator compares only the coordinates
-                    const auto it = open_list.find({*jump_point, 0});
-                    if (it != open_list.end() && no_improvement(*jump_point, tentative_g))
+                    const auto key     = coordinate_index(*jump_point);
+                    const auto in_open = state->open_list.contains(key);
+                    if (in_open && no_improvement(*jump_point, tentative_g))
                     {
                         return;  // skip the coordinate if it does not offer improvement
                     }
 
+                    // estimate the remaining distance to the target
+                    const dist_type h = distance(layout, *jump_point, target);
+                    if (is_infinite_distance(h))
+                    {
+                        return;  // skip the jump point if the target cannot be reached from it
+                    }
+
                     // track origin
-                    came_from[*jump_point] = current;
-                    set_g(*jump_point, tentative_g);
+                    state->set_origin(key, current);
+                    state->set_g(key, tentative_g);
 
                     // compute new f-value
-                    const auto f = tentative_g + distance(layout, *jump_point, target);
+                    const auto f = tentative_g + h;
 
                     // if successor is contained in the open list (frontier)
-                    if (it != open_list.end())
+                    if (in_open)
                     {
-                        // update its f-value
-                        it->f = f;
+                        // decrease its f-value and restore the heap order
+                        state->open_list.decrease_key(key, f);
                     }
                     else
                     {
                         // add successor to the open list
-                        open_list.push({*jump_point, f});
+                        state->open_list.push(key, *jump_point, f);
                     }
                 }
 
@@ -305,34 +273,19 @@ class jump_point_search_impl
      * @param c Coordinate to check.
      * @return `true` iff c has already been visited.
      */
-    bool is_visited(const coordinate<Lyt>& c) const noexcept
+    bool is_visited(const coordinate<Lyt>& c) noexcept
     {
-        return closed_list.count(c) > 0;
+        return state->is_closed(coordinate_index(c));
     }
     /**
-     * Returns the g-value of a coordinate by accessing the g_values map. Returns 0 if no entry exists.
+     * Returns the g-value of a coordinate. Returns 0 if no value has been stored.
      *
      * @param c Coordinate whose g-value is desired.
      * @return g-value of coordinate c or 0 if no value has been stored.
      */
-    Dist g(const coordinate<Lyt>& c) const noexcept
-    {
-        if (const auto it = g_values.find(c); it != g_values.cend())
-        {
-            return it->second;
-        }
-
-        return 0ul;
-    }
-    /**
-     * Updates the g-value of the given coordinate to the given value.
-     *
-     * @param c Coordinate whose g-value is to be updated to g_val.
-     * @param g_val New g-value for c.
-     */
-    void set_g(const coordinate<Lyt>& c, const Dist g_val) noexcept
+    dist_type g(const coordinate<Lyt>& c) noexcept
     {
-        g_values.insert_or_assign(c, g_val);
+        return state->g(coordinate_index(c));
     }
     /**
      * Checks if the given g-value is greater or equal than the stored g-value of the given coordinate. If that is the
@@ -342,7 +295,7 @@ class jump_point_search_impl
      * @param g_val g-value to compare to c's.
      * @return `true` iff the given g-value does not mean an improvement for the given coordinate.
      */
-    bool no_improvement(const coordinate<Lyt>& c, const Dist g_val) noexcept
+    bool no_improvement(const coordinate<Lyt>& c, const dist_type g_val) noexcept
     {
         return g_val >= g(c);
     }
@@ -351,12 +304,12 @@ class jump_point_search_impl
      *
      * @return The shortest path connecting source and target.
      */
-    Path reconstruct_path() const noexcept
+    Path reconstruct_path() noexcept
     {
         Path path{};
 
         // iterate backwards over the found connections and add them to the path
-        for (auto current = target; current != source; current = came_from.at(current))
+        for (auto current = target; current != source; current = state->origin(coordinate_index(current)))
         {
             path.push_back(current);
         }
@@ -457,8 +410,13 @@ class jump_point_search_impl
  * average complexity on uniform-cost grids that allow diagonal connections. It uses a heuristic distance function that
  * estimates the remaining costs towards the target in every step. Thus, this heuristic function should neither be
  * complex to calculate nor overestimating the remaining costs. Common heuristics to be used are the Manhattan and the
- * Euclidean distance functions. See distance_functor for implementations. Since JPS assumes a unit-cost grid, the use
- * of cost functions together with JPS is not possible.
+ * Euclidean distance functions. Since JPS assumes a unit-cost grid, the use of cost functions together with JPS is not
+ * possible. Instead, the distance function also measures the cost of jumps between non-adjacent coordinates.
+ *
+ * The distance function can be an arbitrary callable. Its type is a template parameter such that stateless function
+ * objects like manhattan_distance_fn, which is used by default, can be inlined. The type-erased distance_functor is
+ * supported as well. Jump points for which the distance function returns an infinite distance to the target (see
+ * is_infinite_distance) are pruned.
  *
  * If the given layout implements the obstruction interface (see obstruction_layout), paths will not be routed via
  * obstructed coordinates and connections.
@@ -477,22 +435,23 @@ class jump_point_search_impl
  *
  * @tparam Path Path type to create.
  * @tparam Lyt Clocked layout type.
- * @tparam Dist Distance value type to be used in the heuristic estimation function.
+ * @tparam DistFn Distance function type that maps from a layout and two of its coordinates to an arithmetic value.
  * @param layout The clocked layout in which the shortest path between `source` and `target` is to be found.
  * @param objective Source-target coordinate pair.
  * @param dist_fn A distance functor that implements the desired heuristic estimation function.
  * @param ps Parameters.
  * @return The shortest loopless path in `layout` from `source` to `target`.
  */
-template <typename Path, typename Lyt, typename Dist = uint64_t>
-[[nodiscard]] Path
-jump_point_search(const Lyt& layout, const routing_objective<Lyt>& objective,
-                  const distance_functor<Lyt, Dist>& dist_fn = manhattan_distance_functor<Lyt, Dist>()) noexcept
+template <typename Path, typename Lyt, typename DistFn = manhattan_distance_fn<uint64_t>>
+[[nodiscard]] Path jump_point_search(const Lyt& layout, const routing_objective<Lyt>& objective,
+                                     const DistFn& dist_fn = DistFn{}) noexcept
 {
     static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
     static_assert(is_clocked_layout_v<Lyt>, "Lyt is not a clocked layout");
+    static_assert(std::is_invocable_v<const DistFn&, const Lyt&, const coordinate<Lyt>&, const coordinate<Lyt>&>,
+                  "DistFn is not a distance function on Lyt");
 
-    return detail::jump_point_search_impl<Path, Lyt, Dist>{layout, objective, dist_fn}.run();
+    return detail::jump_point_search_impl<Path, Lyt, DistFn>{layout, objective, dist_fn}.run();
 }
 
 }  // namespace fiction
@@ -6,15 +6,25 @@
 #define FICTION_K_SHORTEST_PATHS_HPP
 
 #include "fiction/algorithms/path_finding/a_star.hpp"
+#include "fiction/algorithms/path_finding/cost.hpp"
 #include "fiction/algorithms/path_finding/distance.hpp"
 #include "fiction/layouts/obstruction_layout.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/hash.hpp"
 #include "fiction/utils/routing_utils.hpp"
 
+#include <phmap.h>
+
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <condition_variable>
 #include <cstdint>
-#include <iterator>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -30,29 +40,105 @@ struct yen_k_shortest_paths_params
      * Parameters for the internal A* algorithm.
      */
     a_star_params astar_params{};
+    /**
+     * Number of threads that compute the spur paths of different deviation points concurrently. The resulting paths do
+     * not depend on this value.
+     */
+    uint32_t num_threads = 1ul;
 };
 
 namespace detail
 {
 
-template <typename Path, typename Lyt>
+/**
+ * A view on an obstruction_layout that adds obstructions which are only visible through this view. Thereby, spur path
+ * searches can block root paths without modifying the obstruction storage that is shared with the underlying layout.
+ * Hence, multiple views on the same layout can be used concurrently.
+ *
+ * @tparam Lyt Clocked layout type.
+ */
+template <typename Lyt>
+class yen_spur_layout : public obstruction_layout<Lyt>
+{
+  public:
+    explicit yen_spur_layout(const obstruction_layout<Lyt>& lyt) : obstruction_layout<Lyt>(lyt) {}
+    /**
+     * Marks the given coordinate as obstructed in this view only.
+     *
+     * @param c Coordinate to obstruct.
+     */
+    void obstruct_coordinate(const typename Lyt::coordinate& c) noexcept
+    {
+        obstructed_coordinates.insert(c);
+    }
+    /**
+     * Marks the connection from coordinate `src` to coordinate `tgt` as obstructed in this view only.
+     *
+     * @param src Source coordinate.
+     * @param tgt Target coordinate.
+     */
+    void obstruct_connection(const typename Lyt::coordinate& src, const typename Lyt::coordinate& tgt) noexcept
+    {
+        obstructed_connections.insert({src, tgt});
+    }
+    /**
+     * Clears all obstructions that were marked in this view.
+     */
+    void clear_view_obstructions() noexcept
+    {
+        obstructed_coordinates.clear();
+        obstructed_connections.clear();
+    }
+    /**
+     * Checks if the given coordinate is obstructed in this view or in the underlying layout.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` is obstructed.
+     */
+    [[nodiscard]] bool is_obstructed_coordinate(const typename Lyt::coordinate& c) const noexcept
+    {
+        return obstructed_coordinates.count(c) > 0 || obstruction_layout<Lyt>::is_obstructed_coordinate(c);
+    }
+    /**
+     * Checks if the given connection is obstructed in this view or in the underlying layout.
+     *
+     * @param src Source coordinate.
+     * @param tgt Target coordinate.
+     * @return `true` iff the connection from `src` to `tgt` is obstructed.
+     */
+    [[nodiscard]] bool is_obstructed_connection(const typename Lyt::coordinate& src,
+                                                const typename Lyt::coordinate& tgt) const noexcept
+    {
+        return obstructed_connections.count({src, tgt}) > 0 ||
+               obstruction_layout<Lyt>::is_obstructed_connection(src, tgt);
+    }
+
+  private:
+    phmap::flat_hash_set<typename Lyt::coordinate> obstructed_coordinates{};
+
+    phmap::flat_hash_set<std::pair<typename Lyt::coordinate, typename Lyt::coordinate>> obstructed_connections{};
+};
+
+template <typename Path, typename Lyt, typename DistFn, typename CostFn>
 class yen_k_shortest_paths_impl
 {
   public:
     yen_k_shortest_paths_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const uint32_t k,
-                              const yen_k_shortest_paths_params p) :
+                              const yen_k_shortest_paths_params p, const DistFn& dist_fn, const CostFn& cost_fn) :
             layout{lyt},
             objective{obj.source, obj.target},
             num_shortest_paths{k},
-            ps{p}
+            ps{p},
+            distance{dist_fn},
+            cost{cost_fn}
     {
         // start by determining the shortest path between source and target
-        k_shortest_paths.push_back(
-            a_star<Path>(layout, objective, manhattan_distance_functor<obstruction_layout<Lyt>, uint64_t>(),
-                         unit_cost_functor<obstruction_layout<Lyt>, uint8_t>(), ps.astar_params));
+        yen_spur_layout<Lyt> view{layout};
+        k_shortest_paths.push_back(find_path(view, objective.source));
+        deviations.push_back(0ul);
     }
 
-    path_collection<Path> run() noexcept
+    path_collection<Path> run()
     {
         assert(!objective.source.is_dead() && !objective.target.is_dead() &&
                "Neither source nor target coordinate can be dead");
@@ -66,89 +152,92 @@ class yen_k_shortest_paths_impl
             return {};
         }
 
-        // for the number of shortest paths k
-        for (uint32_t k = 1; k < num_shortest_paths; ++k)
+        if (num_shortest_paths <= 1)
         {
-            const auto& latest_path = k_shortest_paths[k - 1];
+            return k_shortest_paths;
+        }
 
-            // for all coordinates of the latest path except the last one
-            for (uint32_t i = 0; i < static_cast<int64_t>(latest_path.size()) - 1; ++i)
-            {
-                // create a spur, which is the ith coordinate of the latest path
-                const auto spur = latest_path[i];
+        // the reverse tree only pays off once spur paths have to be computed
+        build_reverse_tree();
 
-                // the root path is the path from the source to the spur coordinate
-                Path root_path{latest_path.cbegin(), latest_path.cbegin() + i};
+        const auto num_workers = static_cast<std::size_t>(std::max(ps.num_threads, 1u));
 
-                // for all previous paths
-                for (const auto& p : k_shortest_paths)
-                {
-                    // if the root path is equal to a previous partial path
-                    if (p.size() >= i && std::equal(root_path.cbegin(), root_path.cend(), p.cbegin(), p.cbegin() + i))
-                    {
-                        // block the connection that was already used in the previous shortest path
-                        layout.obstruct_connection(p[i], p[i + 1]);
-                        // store connection for later clearing
-                        temporarily_obstructed_connections.push_back({p[i], p[i + 1]});
-                    }
-                }
+        if (num_workers == 1)
+        {
+            yen_spur_layout<Lyt> view{layout};
 
-                // for all coordinates in the root path...
-                for (const auto& root : root_path)
+            // for the number of shortest paths k
+            for (uint32_t k = 1; k < num_shortest_paths; ++k)
+            {
+                std::vector<Path> spur_paths(num_spurs());
+                compute_spur_paths(view, spur_paths, 0ul, spur_paths.size());
+
+                if (!select_next_path(spur_paths))
                 {
-                    // ... that are not the spur
-                    if (root != spur)
-                    {
-                        // block them from further exploration
-                        layout.obstruct_coordinate(root);
-                        // store coordinate for later clearing
-                        temporarily_obstructed_coordinates.push_back(root);
-                    }
+                    break;
                 }
+            }
+
+            return k_shortest_paths;
+        }
+
+        // the threads persist throughout all iterations such that their views and pooled search states are reused
+        std::vector<Path> spur_paths(num_spurs());
 
-                // find an alternative path from the spur coordinate to the target and check that it is not empty
-                if (const auto spur_path =
-                        a_star<Path>(layout, {spur, objective.target},
-                                     manhattan_distance_functor<obstruction_layout<Lyt>, uint64_t>(),
-                                     unit_cost_functor<obstruction_layout<Lyt>, uint8_t>(), ps.astar_params);
-                    !spur_path.empty())
+        std::mutex              mutex{};
+        std::condition_variable iteration_done{};
+        std::size_t             num_arrived{0}, current_iteration{0};
+        bool                    done{false};
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_workers);
+
+        for (std::size_t t = 0; t < num_workers; ++t)
+        {
+            threads.emplace_back(
+                [&, t]
                 {
-                    // the final path will be a concatenation of the root path and the spur path
-                    auto& final_path = root_path;
-                    // allocate more memory for the final path (prepare concatenation)
-                    final_path.reserve(root_path.size() + spur_path.size());
-                    // concatenate root path and spur path to get the final path
-                    final_path.insert(final_path.end(), std::make_move_iterator(spur_path.begin()),
-                                      std::make_move_iterator(spur_path.end()));
-
-                    // if the candidates do not already contain the path, it is a potential k-shortest path
-                    if (!final_path.empty())  // NOTE a contains check needs to be added back in if no set is used here
+                    yen_spur_layout<Lyt> view{layout};
+
+                    // iteration i determines the (i + 2)-th shortest path
+                    for (std::size_t i = 0;; ++i)
                     {
-                        shortest_path_candidates.add(final_path);
-                    }
-                }
+                        // the spur indices are distributed among the threads in contiguous chunks
+                        const auto n = spur_paths.size();
+                        compute_spur_paths(view, spur_paths, n * t / num_workers, n * (t + 1) / num_workers);
 
-                // clear obstructions again (prepare for the next potential path)
-                reset_temporary_obstructions();
-            }
+                        std::unique_lock lock{mutex};
 
-            // if there were no spur paths or if all spur paths have been added to k_shortest_paths already
-            if (shortest_path_candidates.empty())
-            {
-                break;
-            }
+                        // the last thread to finish selects the next path and prepares the next iteration
+                        if (++num_arrived == num_workers)
+                        {
+                            done = !select_next_path(spur_paths) || i + 2 >= num_shortest_paths;
 
-            // fetch and remove the lowest cost path from the candidates and add it to k_shortest_paths
-            if (const auto lowest_cost_path_it =
-                    std::min_element(shortest_path_candidates.cbegin(), shortest_path_candidates.cend(),
-                                     [](const auto& p1, const auto& p2) { return path_cost(p1) < path_cost(p2); });
-                lowest_cost_path_it != shortest_path_candidates.cend())
-            {
-                k_shortest_paths.add(*lowest_cost_path_it);
-                shortest_path_candidates.erase(lowest_cost_path_it);
-            }
+                            if (!done)
+                            {
+                                spur_paths.assign(num_spurs(), Path{});
+                            }
+
+                            num_arrived = 0;
+                            ++current_iteration;
+
+                            iteration_done.notify_all();
+                        }
+                        else
+                        {
+                            iteration_done.wait(lock, [&current_iteration, i] { return current_iteration > i; });
+                        }
+
+                        if (done)
+                        {
+                            return;
+                        }
+                    }
+                });
         }
 
+        std::for_each(threads.begin(), threads.end(), [](auto& t) { t.join(); });
+
         return k_shortest_paths;
     }
 
@@ -169,50 +258,452 @@ class yen_k_shortest_paths_impl
      * Parameters.
      */
     yen_k_shortest_paths_params ps;
+    /**
+     * Heuristic distance function of the internal A* algorithm.
+     */
+    const DistFn distance;
+    /**
+     * Cost function of the internal A* algorithm.
+     */
+    const CostFn cost;
+    /**
+     * Type of accumulated path costs.
+     */
+    using path_cost_type = std::common_type_t<cost_type<obstruction_layout<Lyt>, CostFn>, uint64_t>;
+    /**
+     * Type of the heuristic that combines the given distance function with the reverse shortest-path tree.
+     */
+    using heuristic_type = std::common_type_t<distance_type<obstruction_layout<Lyt>, DistFn>, path_cost_type>;
+    /**
+     * A node in the reverse shortest-path tree towards the target.
+     */
+    struct tree_node
+    {
+        /**
+         * Lower bound on the costs from the node's coordinate to the target.
+         */
+        path_cost_type distance;
+        /**
+         * Next coordinate on the tree path to the target.
+         */
+        coordinate<Lyt> successor;
+        /**
+         * Lower bound on the costs of the connection to the successor.
+         */
+        path_cost_type connection_cost;
+    };
+    /**
+     * Reverse shortest-path tree to the target on the ground layer. It is computed once on the layout without any
+     * obstructions and with each connection's costs bounded from below by the cheapest variant across both layers.
+     * Therefore, its distances are lower bounds for every spur search. Coordinates that are not contained cannot reach
+     * the target. Since it is only needed for spur searches, it is computed lazily and remains empty if only a single
+     * path is requested.
+     */
+    phmap::flat_hash_map<coordinate<Lyt>, tree_node> reverse_tree{};
     /**
      * The list of k shortest paths that is created during the algorithm.
      */
     path_collection<Path> k_shortest_paths{};
     /**
-     * A set of potential shortest paths.
+     * Index of the spur coordinate at which each path in k_shortest_paths deviates from the path it was derived from.
+     */
+    std::vector<std::size_t> deviations{};
+    /**
+     * Hash function for paths.
+     */
+    struct path_hash
+    {
+        [[nodiscard]] std::size_t operator()(const Path& p) const noexcept
+        {
+            std::size_t h = 0;
+            for (const auto& c : p)
+            {
+                hash_combine(h, c);
+            }
+
+            return h;
+        }
+    };
+    /**
+     * All paths that have ever been candidates. Since node-based sets do not move their elements, the candidate heap
+     * can refer to them.
      */
-    path_set<Path> shortest_path_candidates{};
+    phmap::node_hash_set<Path, path_hash> known_paths{};
     /**
-     * A temporary storage for coordinates that are obstructed during the algorithm.
+     * A potential shortest path.
      */
-    std::vector<coordinate<Lyt>> temporarily_obstructed_coordinates{};
+    struct candidate
+    {
+        /**
+         * Costs of the path.
+         */
+        path_cost_type path_cost;
+        /**
+         * The path itself.
+         */
+        const Path* path;
+        /**
+         * Index of the spur coordinate at which the path deviates from the path it was derived from.
+         */
+        std::size_t deviation;
+    };
     /**
-     * A temporary storage for coordinates that are obstructed during the algorithm.
+     * Orders candidates by their costs and breaks ties lexicographically such that the result is deterministic.
      */
-    std::vector<std::pair<coordinate<Lyt>, coordinate<Lyt>>> temporarily_obstructed_connections{};
+    struct candidate_order
+    {
+        [[nodiscard]] bool operator()(const candidate& c1, const candidate& c2) const noexcept
+        {
+            if (c1.path_cost != c2.path_cost)
+            {
+                return c1.path_cost > c2.path_cost;
+            }
+
+            return *c2.path < *c1.path;
+        }
+    };
+    /**
+     * Min-heap of potential shortest paths.
+     */
+    std::priority_queue<candidate, std::vector<candidate>, candidate_order> candidates{};
     /**
-     * Computes the cost of a path. This function can be adjusted to fetch paths of differing costs.
+     * Returns a value that represents an infinite distance of the given type (see is_infinite_distance).
      *
-     * Currently, the cost is equal to its length.
+     * @tparam Dist Distance type.
+     * @return Infinite distance.
+     */
+    template <typename Dist>
+    [[nodiscard]] static constexpr Dist infinite_distance() noexcept
+    {
+        if constexpr (std::numeric_limits<Dist>::has_infinity)
+        {
+            return std::numeric_limits<Dist>::infinity();
+        }
+        else
+        {
+            return std::numeric_limits<Dist>::max();
+        }
+    }
+    /**
+     * Computes the cost of a path as the sum of the costs of all its connections according to the cost function. With
+     * unit costs, this is equal to its length.
      *
      * @param p Path whose costs are to be calculated.
      * @return Costs of path p.
      */
-    static std::size_t path_cost(const Path& p) noexcept
+    [[nodiscard]] path_cost_type path_cost(const Path& p) const noexcept
+    {
+        path_cost_type c{0};
+
+        for (std::size_t i = 1; i < p.size(); ++i)
+        {
+            c += static_cast<path_cost_type>(cost(p[i - 1], p[i]));
+        }
+
+        return c;
+    }
+    /**
+     * Computes a lower bound on the costs of moving from `src` to `tgt`, where both may be lifted to the crossing
+     * layer.
+     *
+     * @param src Ground coordinate to move from.
+     * @param tgt Ground coordinate to move to.
+     * @return Minimum costs of all variants of the connection from `src` to `tgt`.
+     */
+    [[nodiscard]] path_cost_type connection_lower_bound(const coordinate<Lyt>& src,
+                                                        const coordinate<Lyt>& tgt) const noexcept
+    {
+        auto lower_bound = static_cast<path_cost_type>(cost(src, tgt));
+
+        const auto above_src = layout.above(src);
+        const auto above_tgt = layout.above(tgt);
+
+        if (above_src != src)
+        {
+            lower_bound = std::min(lower_bound, static_cast<path_cost_type>(cost(above_src, tgt)));
+        }
+        if (above_tgt != tgt)
+        {
+            lower_bound = std::min(lower_bound, static_cast<path_cost_type>(cost(src, above_tgt)));
+
+            if (above_src != src)
+            {
+                lower_bound = std::min(lower_bound, static_cast<path_cost_type>(cost(above_src, above_tgt)));
+            }
+        }
+
+        return lower_bound;
+    }
+    /**
+     * Computes the reverse shortest-path tree via Dijkstra's algorithm from the target along incoming clock zones.
+     */
+    void build_reverse_tree()
+    {
+        using queue_entry = std::pair<path_cost_type, coordinate<Lyt>>;
+
+        const auto greater_distance = [](const queue_entry& e1, const queue_entry& e2) { return e1.first > e2.first; };
+
+        std::priority_queue<queue_entry, std::vector<queue_entry>, decltype(greater_distance)> queue{greater_distance};
+
+        const auto target = layout.below(objective.target);
+
+        reverse_tree[target] = {path_cost_type{0}, target, path_cost_type{0}};
+        queue.push({path_cost_type{0}, target});
+
+        while (!queue.empty())
+        {
+            const auto [dist, current] = queue.top();
+            queue.pop();
+
+            // skip outdated queue entries
+            if (dist > reverse_tree.at(current).distance)
+            {
+                continue;
+            }
+
+            layout.foreach_incoming_clocked_zone(
+                current,
+                [this, &queue, dist = dist, current = current](auto predecessor)  // make a copy
+                {
+                    predecessor = layout.below(predecessor);
+
+                    const auto connection_cost    = connection_lower_bound(predecessor, current);
+                    const auto tentative_distance = dist + connection_cost;
+
+                    // if the predecessor has not been reached before or the distance improves
+                    if (const auto it = reverse_tree.find(predecessor);
+                        it == reverse_tree.cend() || tentative_distance < it->second.distance)
+                    {
+                        reverse_tree[predecessor] = {tentative_distance, current, connection_cost};
+                        queue.push({tentative_distance, predecessor});
+                    }
+                });
+        }
+    }
+    /**
+     * Returns the lower bound on the costs from the given coordinate to the target according to the reverse tree.
+     *
+     * @param c Coordinate whose distance to the target is desired.
+     * @return Lower bound on the costs from `c` to the target or an infinite distance if it cannot reach the target.
+     */
+    [[nodiscard]] path_cost_type reverse_distance(const coordinate<Lyt>& c) const noexcept
+    {
+        if (const auto it = reverse_tree.find(layout.below(c)); it != reverse_tree.cend())
+        {
+            return it->second.distance;
+        }
+
+        return infinite_distance<path_cost_type>();
+    }
+    /**
+     * Follows the reverse tree from `src` to the target. Since the tree distances are lower bounds, the tree path is a
+     * shortest path if none of its coordinates and connections are obstructed in the given view and its connections do
+     * not cost more than their lower bounds.
+     *
+     * @param view Layout view including the temporary obstructions.
+     * @param src Ground coordinate to start from.
+     * @return The tree path from `src` to the target if it is a shortest path in `view`, or an empty path otherwise.
+     */
+    [[nodiscard]] Path tree_path(const yen_spur_layout<Lyt>& view, const coordinate<Lyt>& src) const
+    {
+        Path path{};
+        path.push_back(src);
+
+        for (auto current = src; current != objective.target;)
+        {
+            const auto& node      = reverse_tree.at(current);
+            const auto  successor = node.successor;
+
+            if ((successor != objective.target && view.is_obstructed_coordinate(successor)) ||
+                view.is_obstructed_connection(current, successor) ||
+                static_cast<path_cost_type>(cost(current, successor)) != node.connection_cost)
+            {
+                return {};
+            }
+
+            path.push_back(successor);
+            current = successor;
+        }
+
+        return path;
+    }
+    /**
+     * Determines a shortest path from `src` to the target in the given view. If the reverse tree has been computed,
+     * the tree path is used directly if it is unobstructed. Otherwise, A* is guided by the tree distances, which
+     * dominate the given distance function if it is admissible.
+     *
+     * @param view Layout view including the temporary obstructions.
+     * @param src Coordinate to start from.
+     * @return A shortest path from `src` to the target in `view` or an empty path if there is none.
+     */
+    [[nodiscard]] Path find_path(const yen_spur_layout<Lyt>& view, const coordinate<Lyt>& src) const
+    {
+        // without the reverse tree, A* is guided by the distance function alone
+        const auto has_tree = !reverse_tree.empty();
+
+        // if the target cannot be reached even without obstructions
+        if (has_tree && is_infinite_distance(reverse_distance(src)))
+        {
+            return {};
+        }
+
+        if (has_tree && src == layout.below(src) && layout.below(objective.target) == objective.target)
+        {
+            if (auto path = tree_path(view, src); !path.empty())
+            {
+                return path;
+            }
+        }
+
+        const auto heuristic = [this, has_tree](const yen_spur_layout<Lyt>& lyt, const coordinate<Lyt>& c,
+                                                const coordinate<Lyt>& t) -> heuristic_type
+        {
+            const auto estimation = distance(static_cast<const obstruction_layout<Lyt>&>(lyt), c, t);
+
+            // the tree only bounds the distances to the objective's target, whereas a bidirectional search also
+            // estimates the distances from the spur coordinate to the coordinates expanded by its backward direction
+            if (!has_tree || t != objective.target)
+            {
+                return is_infinite_distance(estimation) ? infinite_distance<heuristic_type>() :
+                                                          static_cast<heuristic_type>(estimation);
+            }
+
+            const auto tree_distance = reverse_distance(c);
+
+            if (is_infinite_distance(tree_distance) || is_infinite_distance(estimation))
+            {
+                return infinite_distance<heuristic_type>();
+            }
+
+            return std::max(static_cast<heuristic_type>(tree_distance), static_cast<heuristic_type>(estimation));
+        };
+
+        return a_star<Path>(view, {src, objective.target}, heuristic, cost, ps.astar_params);
+    }
+    /**
+     * Computes the spur path of the latest path at the given spur index. To this end, the root path up to the spur
+     * coordinate is obstructed as well as all connections from the spur coordinate that previous shortest paths with
+     * the same root path have already taken.
+     *
+     * @param view Layout view to place the temporary obstructions in.
+     * @param latest_path The latest shortest path.
+     * @param spur Index of the spur coordinate in `latest_path`.
+     * @return The spur path from the spur coordinate to the target or an empty path if there is none.
+     */
+    [[nodiscard]] Path spur_path(yen_spur_layout<Lyt>& view, const Path& latest_path, const std::size_t spur) const
+    {
+        view.clear_view_obstructions();
+
+        const auto root_end = latest_path.cbegin() + static_cast<int64_t>(spur) + 1;
+
+        // for all previous paths
+        for (const auto& p : k_shortest_paths)
+        {
+            // if the root path including the spur coordinate is equal to a previous partial path
+            if (p.size() > spur + 1 && std::equal(latest_path.cbegin(), root_end, p.cbegin()))
+            {
+                // block the connection that was already used in the previous shortest path
+                view.obstruct_connection(p[spur], p[spur + 1]);
+            }
+        }
+
+        // block all coordinates of the root path except the spur from further exploration
+        std::for_each(latest_path.cbegin(), root_end - 1,
+                      [&view](const auto& root) { view.obstruct_coordinate(root); });
+
+        // find an alternative path from the spur coordinate to the target
+        return find_path(view, latest_path[spur]);
+    }
+    /**
+     * Returns the number of spur indices of the latest path that have to be considered. Spur coordinates before the
+     * deviation point of the latest path would only reproduce known candidates (Lawler's observation) and all
+     * coordinates except the last one can be spurs.
+     *
+     * @return Number of spur paths to compute for the latest path.
+     */
+    [[nodiscard]] std::size_t num_spurs() const noexcept
     {
-        return p.size();
+        const auto& latest_path = k_shortest_paths.back();
+        const auto  first_spur  = deviations.back();
+
+        return latest_path.size() > first_spur + 1 ? latest_path.size() - first_spur - 1 : 0ul;
     }
     /**
-     * Resets all temporary obstructions.
+     * Computes the spur paths of the latest path for the given range of spur indices, counted from its deviation point.
+     * The spur paths of different indices are independent of each other.
+     *
+     * @param view Layout view to place the temporary obstructions in.
+     * @param spur_paths Storage for the spur path of each spur index. Empty paths indicate that there is none.
+     * @param begin First spur index to consider.
+     * @param end Spur index after the last one to consider.
      */
-    void reset_temporary_obstructions() noexcept
+    void compute_spur_paths(yen_spur_layout<Lyt>& view, std::vector<Path>& spur_paths, const std::size_t begin,
+                            const std::size_t end) const
     {
-        for (const auto& c : temporarily_obstructed_coordinates)
+        const auto& latest_path = k_shortest_paths.back();
+        const auto  first_spur  = deviations.back();
+
+        for (auto i = begin; i < end; ++i)
         {
-            layout.clear_obstructed_coordinate(c);
+            spur_paths[i] = spur_path(view, latest_path, first_spur + i);
+        }
+    }
+    /**
+     * Adds the concatenations of the latest path's root paths and the given spur paths to the candidates. Afterward,
+     * the lowest cost candidate is moved to k_shortest_paths.
+     *
+     * @param spur_paths The spur path for each spur index starting at the latest path's deviation point.
+     * @return `false` iff there was no candidate left.
+     */
+    bool select_next_path(const std::vector<Path>& spur_paths)
+    {
+        const auto& latest_path = k_shortest_paths.back();
+        const auto  first_spur  = deviations.back();
+
+        for (std::size_t i = 0; i < spur_paths.size(); ++i)
+        {
+            if (spur_paths[i].empty())
+            {
+                continue;
+            }
+
+            // the final path will be a concatenation of the root path and the spur path
+            const auto spur = first_spur + i;
+
+            Path final_path{latest_path.cbegin(), latest_path.cbegin() + static_cast<int64_t>(spur)};
+            final_path.reserve(spur + spur_paths[i].size());
+            final_path.insert(final_path.end(), spur_paths[i].cbegin(), spur_paths[i].cend());
+
+            add_candidate(std::move(final_path), spur);
         }
-        for (const auto& c : temporarily_obstructed_connections)
+
+        // if there were no spur paths or if all spur paths have been added to k_shortest_paths already
+        if (candidates.empty())
         {
-            layout.clear_obstructed_connection(c.first, c.second);
+            return false;
         }
 
-        temporarily_obstructed_coordinates.clear();
-        temporarily_obstructed_connections.clear();
+        // fetch and remove the lowest cost candidate and add it to k_shortest_paths
+        const auto lowest_cost_candidate = candidates.top();
+        candidates.pop();
+
+        k_shortest_paths.add(*lowest_cost_candidate.path);
+        deviations.push_back(lowest_cost_candidate.deviation);
+
+        return true;
+    }
+    /**
+     * Adds the given path to the candidates unless it has been a candidate before.
+     *
+     * @param p Potential shortest path.
+     * @param deviation Index of the spur coordinate at which `p` deviates from the latest path.
+     */
+    void add_candidate(Path&& p, const std::size_t deviation)
+    {
+        if (const auto [it, inserted] = known_paths.insert(std::move(p)); inserted)
+        {
+            candidates.push({path_cost(*it), &*it, deviation});
+        }
     }
 };
 
@@ -220,7 +711,8 @@ class yen_k_shortest_paths_impl
 
 /**
  * Yen's algorithm for finding up to \f$ k \f$ shortest paths without loops from source to target. This implementation
- * works on clocked layouts and uses the A* algorithm with the Manhattan distance function internally. The algorithm was
+ * works on clocked layouts and uses the A* algorithm internally, by default with the Manhattan distance function and
+ * unit costs. The algorithm was
  * originally described in \"An algorithm for finding shortest routes from all source nodes to a given destination in
  * general networks\" by Jin Y. Yen in Quarterly of Applied Mathematics, 1970.
  *
@@ -232,21 +724,41 @@ class yen_k_shortest_paths_impl
  * if the crossing layer is not obstructed. Furthermore, it is ensured that crossings do not run along another wire but
  * cross only in a single point (orthogonal crossings + knock-knees/double wires).
  *
+ * The distance and cost functions of the internal A* algorithm can be arbitrary callables (see a_star). They are
+ * invoked on an obstruction_layout wrapping `layout`. Paths are ranked by the sum of their connections' costs. Paths of
+ * equal costs are ranked lexicographically.
+ *
+ * This implementation incorporates several well-known speedups. Following Lawler, spur coordinates are only considered
+ * from the point on where the latest path deviates from the path it was derived from. As soon as more than one path is
+ * requested, a reverse shortest-path tree to the target is computed once on the unobstructed layout. Spur paths are
+ * taken from this tree directly if it is not obstructed, and it guides the internal A* searches otherwise. Candidate
+ * paths are kept in a heap and deduplicated via hashing. Finally, the spur paths of different deviation points can be
+ * computed concurrently by threads that persist throughout the whole search. Temporary obstructions are kept local to
+ * each spur path search such that `layout` is not modified.
+ *
  * @tparam Path Path type to create.
  * @tparam Lyt Clocked layout type.
+ * @tparam DistFn Distance function type that maps from a layout and two of its coordinates to an arithmetic value.
+ * @tparam CostFn Cost function type that maps from two layout coordinates to an arithmetic value.
  * @param layout The clocked layout in which the \f$ k \f$ shortest paths between `source` and `target` are to be found.
  * @param objective Source-target coordinate pair.
  * @param k Maximum number of shortest paths to find.
  * @param ps Parameters.
+ * @param dist_fn A distance function that implements the heuristic estimation function of the internal A* algorithm.
+ * @param cost_fn A cost function that implements the cost function of the internal A* algorithm.
  * @return A collection of up to \f$ k \f$ shortest loopless paths in `layout` from `source` to `target`.
  */
-template <typename Path, typename Lyt>
+template <typename Path, typename Lyt, typename DistFn = manhattan_distance_fn<uint64_t>,
+          typename CostFn = unit_cost_fn<uint8_t>>
 [[nodiscard]] path_collection<Path> yen_k_shortest_paths(const Lyt& layout, const routing_objective<Lyt>& objective,
-                                                         const uint32_t k, yen_k_shortest_paths_params ps = {}) noexcept
+                                                         const uint32_t k, yen_k_shortest_paths_params ps = {},
+                                                         const DistFn& dist_fn = DistFn{},
+                                                         const CostFn& cost_fn = CostFn{}) noexcept
 {
     static_assert(is_clocked_layout_v<Lyt>, "Lyt is not a clocked layout");
 
-    return detail::yen_k_shortest_paths_impl<Path, Lyt>{layout, objective, k, ps}.run();
+    return detail::yen_k_shortest_paths_impl<Path, Lyt, DistFn, CostFn>{layout, objective, k, ps, dist_fn, cost_fn}
+        .run();
 }
 
 }  // namespace fiction
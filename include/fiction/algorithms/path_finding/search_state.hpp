@@ -0,0 +1,273 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_SEARCH_STATE_HPP
+#define FICTION_SEARCH_STATE_HPP
+
+#include "fiction/utils/stl_utils.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Per-coordinate state of best-first path searches like A* and jump point search, i.e., the open list, the closed
+ * list, the g-values, and the origins of all visited coordinates. Coordinates are addressed by dense keys, e.g., as
+ * assigned by `dense_coordinate_index`, such that the state is stored in flat arrays instead of hash maps.
+ *
+ * Each entry carries a generation stamp. Entries whose stamp does not match the current generation are treated as
+ * unset. Thereby, resetting the state between searches does not need to revisit all entries but merely increments the
+ * generation. Together with `search_state_pool`, this allows for repeated path searches, e.g., by routing algorithms,
+ * without any reallocation. Consequently, `prepare` has to be called before each search.
+ *
+ * @tparam CoordinateType Coordinate type of the searched layout.
+ * @tparam Value Type of the g- and f-values.
+ */
+template <typename CoordinateType, typename Value>
+class path_search_state
+{
+  public:
+    /**
+     * Priority queue of coordinates sorted by their f-values with the smallest f-value on top.
+     */
+    using open_list_type = indexed_priority_queue<CoordinateType, Value>;
+    /**
+     * Invalidates all entries and prepares the state for a new search. Runs in \f$ O(1) \f$ apart from clearing the
+     * open list and from the first preparation for a larger key range.
+     *
+     * @param num_keys Number of keys that are expected to be used, e.g., the number of coordinates in a bounded layout.
+     * Further entries are allocated on demand.
+     */
+    void prepare(const std::size_t num_keys)
+    {
+        open_list.clear();
+
+        // on overflow, all stamps have to be invalidated explicitly
+        if (++generation == 0)
+        {
+            std::for_each(entries.begin(), entries.end(), [](auto& e) { e.stamp = 0; });
+            generation = 1;
+        }
+
+        if (num_keys > entries.size())
+        {
+            entries.resize(num_keys);
+            open_list.reserve(num_keys);
+        }
+    }
+    /**
+     * Checks whether the coordinate with the given key has already been visited, i.e., is in the closed list.
+     *
+     * @param key Key of the coordinate to check.
+     * @return `true` iff the coordinate with key `key` has been closed in the current search.
+     */
+    [[nodiscard]] bool is_closed(const std::size_t key) const noexcept
+    {
+        return is_set(key) && entries[key].closed;
+    }
+    /**
+     * Adds the coordinate with the given key to the closed list.
+     *
+     * @param key Key of the coordinate to close.
+     */
+    void close(const std::size_t key)
+    {
+        touch(key).closed = true;
+    }
+    /**
+     * Returns the g-value of the coordinate with the given key, i.e., the length of the shortest path from the source
+     * to it found so far. Returns 0 if no g-value has been stored in the current search.
+     *
+     * @param key Key of the coordinate whose g-value is desired.
+     * @return g-value of the coordinate with key `key` or 0 if none has been stored.
+     */
+    [[nodiscard]] Value g(const std::size_t key) const noexcept
+    {
+        return is_set(key) ? entries[key].g : Value{0};
+    }
+    /**
+     * Updates the g-value of the coordinate with the given key.
+     *
+     * @param key Key of the coordinate whose g-value is to be updated.
+     * @param g_val New g-value.
+     */
+    void set_g(const std::size_t key, const Value g_val)
+    {
+        touch(key).g = g_val;
+    }
+    /**
+     * Returns the coordinate from which the coordinate with the given key has been reached. An origin must have been
+     * stored in the current search.
+     *
+     * @param key Key of the coordinate whose origin is desired.
+     * @return Origin of the coordinate with key `key`.
+     */
+    [[nodiscard]] const CoordinateType& origin(const std::size_t key) const noexcept
+    {
+        assert(is_set(key) && "no origin has been stored for the given key");
+
+        return entries[key].origin;
+    }
+    /**
+     * Tracks the coordinate from which the coordinate with the given key has been reached.
+     *
+     * @param key Key of the coordinate whose origin is to be stored.
+     * @param c Origin coordinate.
+     */
+    void set_origin(const std::size_t key, const CoordinateType& c)
+    {
+        touch(key).origin = c;
+    }
+    /**
+     * Open list that contains all coordinates to process next sorted by their f-value.
+     */
+    open_list_type open_list{};
+
+  private:
+    /**
+     * State of a single coordinate.
+     */
+    struct entry
+    {
+        /**
+         * Generation in which this entry was last written.
+         */
+        uint32_t stamp{0};
+        /**
+         * Flag that indicates whether the coordinate is in the closed list.
+         */
+        bool closed{false};
+        /**
+         * g-value.
+         */
+        Value g{0};
+        /**
+         * Origin coordinate.
+         */
+        CoordinateType origin{};
+    };
+    /**
+     * Entries indexed by coordinate keys.
+     */
+    std::vector<entry> entries{};
+    /**
+     * Current generation. It is incremented by each preparation and, thus, never 0 during a search such that
+     * default-constructed entries are unset.
+     */
+    uint32_t generation{0};
+    /**
+     * Checks whether the entry with the given key has been written in the current generation.
+     *
+     * @param key Key to check.
+     * @return `true` iff the entry with key `key` is valid.
+     */
+    [[nodiscard]] bool is_set(const std::size_t key) const noexcept
+    {
+        return key < entries.size() && entries[key].stamp == generation;
+    }
+    /**
+     * Returns the entry with the given key for writing. Entries from previous generations are reinitialized first.
+     *
+     * @param key Key of the desired entry.
+     * @return Reference to the entry with key `key`.
+     */
+    entry& touch(const std::size_t key)
+    {
+        if (key >= entries.size())
+        {
+            entries.resize(key + 1);
+        }
+
+        auto& e = entries[key];
+
+        if (e.stamp != generation)
+        {
+            e = entry{generation, false, Value{0}, CoordinateType{}};
+        }
+
+        return e;
+    }
+};
+/**
+ * A thread-local pool of reusable search states. Path searches acquire a state for their lifetime and return it to the
+ * pool afterwards such that repeated searches on the same thread reuse the previously allocated memory. Nested
+ * searches, e.g., A* with an A*-based distance function, simply acquire multiple states.
+ *
+ * @tparam State Search state type, e.g., `path_search_state`.
+ */
+template <typename State>
+class search_state_pool
+{
+  public:
+    /**
+     * Grants exclusive access to a pooled search state and returns it to the pool on destruction. Handles must be
+     * destroyed on the thread that created them.
+     */
+    class handle
+    {
+      public:
+        handle(std::unique_ptr<State> s, std::vector<std::unique_ptr<State>>& p) noexcept :
+                state{std::move(s)},
+                pool{&p}
+        {}
+
+        handle(const handle&)            = delete;
+        handle& operator=(const handle&) = delete;
+
+        handle(handle&& other) noexcept            = default;
+        handle& operator=(handle&& other) noexcept = delete;
+
+        ~handle()
+        {
+            if (state)
+            {
+                pool->push_back(std::move(state));
+            }
+        }
+
+        State& operator*() const noexcept
+        {
+            return *state;
+        }
+
+        State* operator->() const noexcept
+        {
+            return state.get();
+        }
+
+      private:
+        std::unique_ptr<State>                state;
+        std::vector<std::unique_ptr<State>>* pool;
+    };
+    /**
+     * Acquires a search state from the calling thread's pool or creates a new one if the pool is exhausted.
+     *
+     * @return Handle to the acquired search state.
+     */
+    [[nodiscard]] static handle acquire()
+    {
+        thread_local std::vector<std::unique_ptr<State>> pool{};
+
+        if (pool.empty())
+        {
+            return handle{std::make_unique<State>(), pool};
+        }
+
+        auto state = std::move(pool.back());
+        pool.pop_back();
+
+        return handle{std::move(state), pool};
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_SEARCH_STATE_HPP
@@ -13,7 +13,15 @@
 
 #include <mockturtle/traits.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #if (PROGRESS_BARS)
 #include <mockturtle/utils/progress_bar.hpp>
@@ -27,6 +35,19 @@
 namespace fiction
 {
 
+/**
+ * Parameters for the application of gate libraries.
+ */
+struct apply_gate_library_params
+{
+    /**
+     * Number of threads to use for setting up the gates. If greater than 1, the layout's tiles are partitioned into
+     * bands of rows whose gates are set up concurrently and collected in thread-local buffers before they are written
+     * to the cell-level layout. The result is identical to the sequential application.
+     */
+    uint32_t num_threads = 1ul;
+};
+
 namespace detail
 {
 
@@ -34,7 +55,8 @@ template <typename CellLyt, typename GateLibrary, typename GateLyt>
 class apply_gate_library_impl
 {
   public:
-    explicit apply_gate_library_impl(const GateLyt& lyt) :
+    apply_gate_library_impl(const GateLyt& lyt, const apply_gate_library_params& p) :
+            ps{p},
             gate_lyt{lyt},
             cell_lyt{aspect_ratio<CellLyt>{((gate_lyt.x() + 1) * GateLibrary::gate_x_size()) - 1,
                                            ((gate_lyt.y() + 1) * GateLibrary::gate_y_size()) - 1, gate_lyt.z()},
@@ -42,6 +64,50 @@ class apply_gate_library_impl
     {}
 
     CellLyt run()
+    {
+        if (ps.num_threads > 1)
+        {
+            apply_in_parallel();
+        }
+        else
+        {
+            apply_sequentially();
+        }
+
+        // perform post-layout optimization if necessary
+        if constexpr (has_post_layout_optimization_v<GateLibrary, CellLyt>)
+        {
+            GateLibrary::post_layout_optimization(cell_lyt);
+        }
+        // if available, recover layout name
+        if constexpr (has_get_layout_name_v<GateLyt> && has_set_layout_name_v<CellLyt>)
+        {
+            cell_lyt.set_layout_name(gate_lyt.get_layout_name());
+        }
+
+        return cell_lyt;
+    }
+
+  private:
+    const apply_gate_library_params ps;
+
+    GateLyt gate_lyt;
+    CellLyt cell_lyt;
+    /**
+     * Cells and IO names of a band of tiles that were set up by a single thread.
+     */
+    struct band_buffer
+    {
+        std::vector<std::pair<cell<CellLyt>, typename technology<CellLyt>::cell_type>> cells{};
+
+        std::vector<std::pair<cell<CellLyt>, std::string>> names{};
+        /**
+         * Exception thrown by the library while setting up one of the band's gates, if any.
+         */
+        std::exception_ptr error{};
+    };
+
+    void apply_sequentially()
     {
 #if (PROGRESS_BARS)
         // initialize a progress bar
@@ -54,39 +120,143 @@ class apply_gate_library_impl
                 {
                     const auto t = gate_lyt.get_tile(n);
 
-                    // retrieve the top-leftmost cell in tile t
-                    const auto c =
-                        relative_to_absolute_cell_position<GateLibrary::gate_x_size(), GateLibrary::gate_y_size(),
-                                                           GateLyt, CellLyt>(gate_lyt, t, cell<CellLyt>{0, 0});
-
-                    assign_gate(c, GateLibrary::set_up_gate(gate_lyt, t), n);
+                    assign_gate(top_left_cell(t), GateLibrary::set_up_gate(gate_lyt, t), n);
                 }
 #if (PROGRESS_BARS)
                 // update progress
                 bar(i);
 #endif
             });
+    }
+    /**
+     * Sets up the gates of horizontal bands of tiles concurrently. Gate libraries only read from the gate-level layout
+     * and tiles do not overlap. Hence, each thread collects the cells of its band in a local buffer. Afterwards, all
+     * buffers are written to the cell-level layout in band order.
+     */
+    void apply_in_parallel()
+    {
+        std::vector<std::pair<tile<GateLyt>, mockturtle::node<GateLyt>>> tiles{};
+        tiles.reserve(gate_lyt.size());
 
-        // perform post-layout optimization if necessary
-        if constexpr (has_post_layout_optimization_v<GateLibrary, CellLyt>)
+        gate_lyt.foreach_node(
+            [this, &tiles](const auto& n)
+            {
+                if (!gate_lyt.is_constant(n))
+                {
+                    tiles.emplace_back(gate_lyt.get_tile(n), n);
+                }
+            });
+
+        // sort tiles row by row such that each thread processes a contiguous band
+        std::sort(tiles.begin(), tiles.end(),
+                  [](const auto& t1, const auto& t2)
+                  {
+                      if (t1.first.y != t2.first.y)
+                      {
+                          return t1.first.y < t2.first.y;
+                      }
+                      if (t1.first.x != t2.first.x)
+                      {
+                          return t1.first.x < t2.first.x;
+                      }
+
+                      return t1.first.z < t2.first.z;
+                  });
+
+        const auto num_bands =
+            std::max(std::min(static_cast<std::size_t>(ps.num_threads), tiles.size()), std::size_t{1});
+
+        std::vector<band_buffer> buffers(num_bands);
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_bands);
+
+        for (std::size_t b = 0; b < num_bands; ++b)
         {
-            GateLibrary::post_layout_optimization(cell_lyt);
+            threads.emplace_back(
+                [this, &tiles, &buffers, b, num_bands]
+                {
+                    auto& buffer = buffers[b];
+
+                    try
+                    {
+                        const auto begin = tiles.size() * b / num_bands;
+                        const auto end   = tiles.size() * (b + 1) / num_bands;
+
+                        for (auto i = begin; i < end; ++i)
+                        {
+                            const auto& t = tiles[i].first;
+                            const auto& n = tiles[i].second;
+
+                            foreach_gate_cell(top_left_cell(t), GateLibrary::set_up_gate(gate_lyt, t),
+                                              [this, &buffer, &n](const auto& pos, const auto& type)
+                                              {
+                                                  if (!technology<CellLyt>::is_empty_cell(type))
+                                                  {
+                                                      buffer.cells.emplace_back(pos, type);
+                                                  }
+                                                  if (technology<CellLyt>::is_input_cell(type) ||
+                                                      technology<CellLyt>::is_output_cell(type))
+                                                  {
+                                                      buffer.names.emplace_back(pos, gate_lyt.get_name(n));
+                                                  }
+                                              });
+                        }
+                    }
+                    catch (...)
+                    {
+                        buffer.error = std::current_exception();
+                    }
+                });
         }
-        // if available, recover layout name
-        if constexpr (has_get_layout_name_v<GateLyt> && has_set_layout_name_v<CellLyt>)
+
+        for (auto& thread : threads)
         {
-            cell_lyt.set_layout_name(gate_lyt.get_layout_name());
+            thread.join();
         }
 
-        return cell_lyt;
-    }
-
-  private:
-    GateLyt gate_lyt;
-    CellLyt cell_lyt;
+        // rethrow the first exception in band order to behave deterministically
+        for (const auto& buffer : buffers)
+        {
+            if (buffer.error)
+            {
+                std::rethrow_exception(buffer.error);
+            }
+        }
 
-    void assign_gate(const cell<CellLyt>& c, const typename GateLibrary::fcn_gate& g,
-                     const mockturtle::node<GateLyt>& n)
+        for (const auto& buffer : buffers)
+        {
+            for (const auto& [pos, type] : buffer.cells)
+            {
+                cell_lyt.assign_cell_type(pos, type);
+            }
+            for (const auto& [pos, name] : buffer.names)
+            {
+                cell_lyt.assign_cell_name(pos, name);
+            }
+        }
+    }
+    /**
+     * Retrieves the top-leftmost cell in tile `t`.
+     *
+     * @param t Tile in the gate-level layout.
+     * @return Top-leftmost cell of `t` in the cell-level layout.
+     */
+    [[nodiscard]] cell<CellLyt> top_left_cell(const tile<GateLyt>& t) const noexcept
+    {
+        return relative_to_absolute_cell_position<GateLibrary::gate_x_size(), GateLibrary::gate_y_size(), GateLyt,
+                                                  CellLyt>(gate_lyt, t, cell<CellLyt>{0, 0});
+    }
+    /**
+     * Applies a function to all cell positions of gate `g` when placed with its top-left corner at cell `c`.
+     *
+     * @tparam Fn Functor type that receives a cell position and a cell type.
+     * @param c Top-left cell of the gate.
+     * @param g Gate to place.
+     * @param fn Functor to apply.
+     */
+    template <typename Fn>
+    void foreach_gate_cell(const cell<CellLyt>& c, const typename GateLibrary::fcn_gate& g, Fn&& fn) const
     {
         auto start_x = c.x;
         auto start_y = c.y;
@@ -99,19 +269,29 @@ class apply_gate_library_impl
                 const cell<CellLyt> pos{start_x + x, start_y + y, layer};
                 const auto          type{g[y][x]};
 
-                if (!technology<CellLyt>::is_empty_cell(type))
-                {
-                    cell_lyt.assign_cell_type(pos, type);
-                }
-
-                // set IO names
-                if (technology<CellLyt>::is_input_cell(type) || technology<CellLyt>::is_output_cell(type))
-                {
-                    cell_lyt.assign_cell_name(pos, gate_lyt.get_name(n));
-                }
+                std::invoke(std::forward<Fn>(fn), pos, type);
             }
         }
     }
+
+    void assign_gate(const cell<CellLyt>& c, const typename GateLibrary::fcn_gate& g,
+                     const mockturtle::node<GateLyt>& n)
+    {
+        foreach_gate_cell(c, g,
+                          [this, &n](const auto& pos, const auto& type)
+                          {
+                              if (!technology<CellLyt>::is_empty_cell(type))
+                              {
+                                  cell_lyt.assign_cell_type(pos, type);
+                              }
+
+                              // set IO names
+                              if (technology<CellLyt>::is_input_cell(type) || technology<CellLyt>::is_output_cell(type))
+                              {
+                                  cell_lyt.assign_cell_name(pos, gate_lyt.get_name(n));
+                              }
+                          });
+    }
 };
 
 }  // namespace detail
@@ -125,14 +305,18 @@ class apply_gate_library_impl
  * May pass through, and thereby throw, an `unsupported_gate_type_exception` or an
  * `unsupported_gate_orientation_exception`.
  *
+ * Gates can be set up by multiple threads concurrently (see `apply_gate_library_params`). Combining this with a
+ * cell-level layout that uses `chunked_cell_storage` is recommended for large layouts.
+ *
  * @tparam CellLyt Type of the returned cell-level layout.
  * @tparam GateLibrary Type of the gate library to apply.
  * @tparam GateLyt Type of the gate-level layout to apply the library to.
  * @param lyt The gate-level layout.
+ * @param ps Parameters.
  * @return A cell-level layout that implements `lyt`'s gate types with building blocks defined in `GateLibrary`.
  */
 template <typename CellLyt, typename GateLibrary, typename GateLyt>
-CellLyt apply_gate_library(const GateLyt& lyt)
+CellLyt apply_gate_library(const GateLyt& lyt, const apply_gate_library_params& ps = {})
 {
     static_assert(is_cell_level_layout_v<CellLyt>, "CellLyt is not a cell-level layout");
     static_assert(!has_siqad_coord_v<CellLyt>, "CellLyt cannot have SiQAD coordinates");
@@ -143,7 +327,7 @@ CellLyt apply_gate_library(const GateLyt& lyt)
     static_assert(std::is_same_v<technology<CellLyt>, technology<GateLibrary>>,
                   "CellLyt and GateLibrary must implement the same technology");
 
-    detail::apply_gate_library_impl<CellLyt, GateLibrary, GateLyt> p{lyt};
+    detail::apply_gate_library_impl<CellLyt, GateLibrary, GateLyt> p{lyt, ps};
 
     auto result = p.run();
 
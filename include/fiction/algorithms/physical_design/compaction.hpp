@@ -0,0 +1,1157 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_COMPACTION_HPP
+#define FICTION_COMPACTION_HPP
+
+#include "fiction/algorithms/path_finding/a_star.hpp"
+#include "fiction/algorithms/path_finding/cost.hpp"
+#include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/layouts/gate_level_layout.hpp"
+#include "fiction/layouts/obstruction_layout.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/name_utils.hpp"
+#include "fiction/utils/routing_utils.hpp"
+
+#include <fmt/format.h>
+#include <mockturtle/traits.hpp>
+#include <mockturtle/utils/node_map.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Parameters for the post-layout compaction.
+ */
+struct compaction_params
+{
+    /**
+     * Re-place all gates as far north-west as their fanins permit and re-route their connections. The relocated layout
+     * is only kept if it is strictly smaller than the one obtained by line removal alone.
+     */
+    bool relocate_gates = true;
+    /**
+     * Maximum number of candidate tiles that are tried per gate during relocation. Higher values increase the chance
+     * of successful relocations at the cost of runtime.
+     */
+    uint32_t max_candidates = 16u;
+};
+/**
+ * Statistics of the post-layout compaction.
+ */
+struct compaction_stats
+{
+    /**
+     * Total runtime.
+     */
+    mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Layout size after compaction.
+     */
+    uint64_t x_size{0ull}, y_size{0ull};
+    /**
+     * Number of removed columns and rows.
+     */
+    uint64_t num_removed_columns{0ull}, num_removed_rows{0ull};
+    /**
+     * Number of wire segments removed along with columns and rows.
+     */
+    uint64_t num_removed_wires{0ull};
+    /**
+     * Number of gates that were moved to another tile by the relocation. It is 0 if the relocation was disabled or
+     * did not reduce the layout area.
+     */
+    uint64_t num_relocated_gates{0ull};
+    /**
+     * Number of performed compaction rounds.
+     */
+    uint32_t num_rounds{0ul};
+
+    void report(std::ostream& out = std::cout) const
+    {
+        out << fmt::format("[i] total time      = {:.2f} secs\n", mockturtle::to_seconds(time_total));
+        out << fmt::format("[i] layout size     = {} × {}\n", x_size, y_size);
+        out << fmt::format("[i] removed columns = {}\n", num_removed_columns);
+        out << fmt::format("[i] removed rows    = {}\n", num_removed_rows);
+        out << fmt::format("[i] removed wires   = {}\n", num_removed_wires);
+        out << fmt::format("[i] relocated gates = {}\n", num_relocated_gates);
+        out << fmt::format("[i] rounds          = {}\n", num_rounds);
+    }
+};
+
+namespace detail
+{
+
+template <typename Lyt>
+class compaction_impl
+{
+  public:
+    compaction_impl(const Lyt& src, const compaction_params& p, compaction_stats& st) : lyt{src}, ps{p}, pst{st} {}
+
+    Lyt run()
+    {
+        // measure run time
+        mockturtle::stopwatch stop{pst.time_total};
+
+        remove_all_lines();
+
+        if (ps.relocate_gates)
+        {
+            // keep the line-removed layout and its statistics in case the relocation does not pay off
+            const auto line_removed_lyt   = lyt;
+            const auto line_removed_stats = pst;
+
+            auto best_lyt   = line_removed_lyt;
+            auto best_stats = line_removed_stats;
+
+            // neither strategy dominates the other; reserving exits protects fanouts but also blocks tiles
+            for (const auto reserve : {false, true})
+            {
+                lyt = line_removed_lyt;
+                pst = line_removed_stats;
+
+                reserve_pending_exits = reserve;
+
+                if (auto relocated_lyt = relocate_gates(); relocated_lyt.has_value())
+                {
+                    lyt = std::move(*relocated_lyt);
+
+                    // the rebuild removes the nodes of discarded relocation attempts even if no line can be removed
+                    if (determine_removable_lines())
+                    {
+                        ++pst.num_rounds;
+                    }
+                    lyt = remove_lines();
+
+                    remove_all_lines();
+
+                    if (area(lyt) < area(best_lyt))
+                    {
+                        best_lyt   = lyt;
+                        best_stats = pst;
+                    }
+                }
+            }
+
+            lyt = std::move(best_lyt);
+            pst = best_stats;
+        }
+
+        pst.x_size = lyt.x() + 1;
+        pst.y_size = lyt.y() + 1;
+
+        return lyt;
+    }
+
+  private:
+    /**
+     * The layout that is being compacted.
+     */
+    Lyt lyt;
+    /**
+     * Parameters.
+     */
+    const compaction_params ps;
+    /**
+     * Statistics.
+     */
+    compaction_stats& pst;
+    /**
+     * Computes the number of tiles in the ground layer of the given layout.
+     *
+     * @param l Layout whose area is desired.
+     * @return Area of `l`.
+     */
+    [[nodiscard]] static uint64_t area(const Lyt& l) noexcept
+    {
+        return (static_cast<uint64_t>(l.x()) + 1) * (static_cast<uint64_t>(l.y()) + 1);
+    }
+    /**
+     * Removes columns and rows in rounds until no further line can be removed. Each round is linear in the number of
+     * occupied tiles; removing columns can enable the removal of rows and vice versa.
+     */
+    void remove_all_lines()
+    {
+        while (determine_removable_lines())
+        {
+            lyt = remove_lines();
+            ++pst.num_rounds;
+        }
+    }
+    /**
+     * Checks whether the given node is one of the layout's logic elements, i.e., a PI, a PO, a gate, or a fanout. All
+     * other nodes are wire segments that merely connect those elements and are, therefore, re-routed by the relocation.
+     *
+     * @param n Node to check.
+     * @return `true` iff `n` is not a connecting wire segment.
+     */
+    [[nodiscard]] bool is_logic_node(const mockturtle::node<Lyt>& n) const noexcept
+    {
+        return !lyt.is_wire(n) || lyt.is_pi(n) || lyt.is_po(n) || lyt.is_fanout(n);
+    }
+    /**
+     * Determines the logic fanins of the given node by tracing its incoming wire segments back to the logic elements
+     * that drive them. The fanin order is preserved.
+     *
+     * @param n Logic node whose logic fanins are desired.
+     * @return Logic fanins of `n`.
+     */
+    [[nodiscard]] std::vector<mockturtle::node<Lyt>> logic_fanins(const mockturtle::node<Lyt>& n) const noexcept
+    {
+        std::vector<mockturtle::node<Lyt>> fanins{};
+
+        lyt.foreach_fanin(n,
+                          [this, &fanins](const auto& fi)
+                          {
+                              auto fin = lyt.get_node(fi);
+
+                              while (!is_logic_node(fin))
+                              {
+                                  // connecting wire segments have exactly one fanin
+                                  lyt.foreach_fanin(fin, [this, &fin](const auto& wfi) { fin = lyt.get_node(wfi); });
+                              }
+
+                              fanins.push_back(fin);
+                          });
+
+        return fanins;
+    }
+    /**
+     * Routes the given fanin tiles to tile `t`. To this end, each fanin is routed via A* on the ground layer and, if
+     * the layout provides a crossing layer, across existing wire segments. Since the node that is to be placed on `t`
+     * is created after all of its fanins have been routed, the connections entering `t` are obstructed for subsequent
+     * fanins to ensure that each one enters `t` from a different side. If any fanin cannot be routed, all wire segments
+     * created for `t` are removed again.
+     *
+     * @param work Layout in which the fanins are to be routed.
+     * @param obstr Obstruction view on `work`.
+     * @param sources Tiles in `work` that host the fanins.
+     * @param t Tile to route the fanins to.
+     * @param wires Receives the tiles of all created wire segments in the order of their creation.
+     * @return Signals that enter `t` in the order of `sources` or `std::nullopt` if not all fanins could be routed.
+     */
+    [[nodiscard]] std::optional<std::vector<mockturtle::signal<Lyt>>>
+    route_fanins(Lyt& work, obstruction_layout<Lyt>& obstr, const std::vector<tile<Lyt>>& sources,
+                 const tile<Lyt>& t, std::vector<tile<Lyt>>& wires) const
+    {
+        a_star_params astar_ps{};
+        astar_ps.crossings = lyt.z() > 0;
+
+        std::vector<mockturtle::signal<Lyt>>         children{};
+        std::vector<std::pair<tile<Lyt>, tile<Lyt>>> entries{};
+
+        const auto clear_entries = [&obstr, &entries]
+        {
+            std::for_each(entries.cbegin(), entries.cend(),
+                          [&obstr](const auto& e) { obstr.clear_obstructed_connection(e.first, e.second); });
+        };
+
+        for (const auto& src : sources)
+        {
+            const auto path = a_star<layout_coordinate_path<obstruction_layout<Lyt>>>(
+                obstr, {src, t}, manhattan_distance_fn<uint64_t>{}, unit_cost_fn<uint8_t>{}, astar_ps);
+
+            if (path.empty())
+            {
+                std::for_each(wires.crbegin(), wires.crend(), [&work](const auto& w) { work.clear_tile(w); });
+                wires.clear();
+                clear_entries();
+
+                return std::nullopt;
+            }
+
+            auto incoming_signal = static_cast<mockturtle::signal<Lyt>>(src);
+
+            // exclude source and target
+            std::for_each(path.cbegin() + 1, path.cend() - 1,
+                          [&work, &wires, &incoming_signal](const auto& coord)
+                          {
+                              const auto w    = work.is_empty_tile(coord) ? coord : work.above(coord);
+                              incoming_signal = work.create_buf(incoming_signal, w);
+                              wires.push_back(w);
+                          });
+
+            children.push_back(incoming_signal);
+
+            // subsequent fanins must enter t from another side
+            const auto entry = *(path.cend() - 2);
+            for (const auto& e : {work.below(entry), work.above(entry)})
+            {
+                obstr.obstruct_connection(e, t);
+                entries.emplace_back(e, t);
+            }
+        }
+
+        clear_entries();
+
+        return children;
+    }
+    /**
+     * Checks whether a wire leaving tile `src` towards the adjacent clocked zone `c` can reach a free tile, i.e., an
+     * empty one that is not reserved as an exit of another node. This is the case if `c` is free itself or if, in a
+     * layout with a crossing layer, `c` hosts a crossable wire segment (see `is_crossable_wire`) whose crossing layer
+     * is empty and from which a free tile can be reached within the given number of further crossings.
+     *
+     * @param work Layout to consider.
+     * @param src Tile to leave.
+     * @param c Clocked zone adjacent to `src` to leave towards.
+     * @param depth Maximum number of crossings.
+     * @return `true` iff a free tile can be reached from `src` via `c`.
+     */
+    [[nodiscard]] bool leads_to_free_tile(const Lyt& work, const tile<Lyt>& src, const tile<Lyt>& c,
+                                          const uint32_t depth) const noexcept
+    {
+        const auto gc = work.below(c);
+
+        if (work.is_empty_tile(gc))
+        {
+            return !is_reserved(work, gc);
+        }
+
+        const auto ac = work.above(gc);
+
+        if (depth == 0u || ac == gc || !work.is_empty_tile(ac) || !is_crossable_wire(work, src, gc))
+        {
+            return false;
+        }
+
+        bool reachable = false;
+        work.foreach_outgoing_clocked_zone(gc,
+                                           [this, &work, &ac, &depth, &reachable](const auto& out)
+                                           {
+                                               reachable =
+                                                   reachable || leads_to_free_tile(work, ac, out, depth - 1u);
+                                           });
+
+        return reachable;
+    }
+    /**
+     * Counts the outgoing clocked zones of the given tile that can still be used to leave it, i.e., those that are not
+     * yet connected to it and that are either reserved as its exits or from which a free tile can be reached (see
+     * `leads_to_free_tile`).
+     *
+     * @param work Layout to consider.
+     * @param t Tile whose free exits are to be counted.
+     * @return Number of free exits of `t`.
+     */
+    [[nodiscard]] uint32_t num_free_exits(const Lyt& work, const tile<Lyt>& t) const noexcept
+    {
+        // bounds the look-ahead through crossings
+        static constexpr const uint32_t max_crossings = 3u;
+
+        const auto& exits = reserved_exits[work.node_to_index(work.get_node(t))];
+
+        uint32_t num_exits = 0u;
+
+        work.foreach_outgoing_clocked_zone(
+            t,
+            [this, &work, &t, &exits, &num_exits](const auto& out)
+            {
+                if (work.is_outgoing_signal(t, static_cast<mockturtle::signal<Lyt>>(out)))
+                {
+                    return;
+                }
+
+                if (std::find(exits.cbegin(), exits.cend(), work.below(out)) != exits.cend() ||
+                    leads_to_free_tile(work, t, out, max_crossings))
+                {
+                    ++num_exits;
+                }
+            });
+
+        return num_exits;
+    }
+    /**
+     * Checks whether the given node still has enough free exits for all of its fanouts that have not been placed yet.
+     *
+     * @param work Layout to consider.
+     * @param t Tile to check.
+     * @return `true` iff `t` is empty or hosts a node that can still reach all of its unplaced fanouts.
+     */
+    [[nodiscard]] bool has_sufficient_exits(const Lyt& work, const tile<Lyt>& t) const noexcept
+    {
+        const auto gt = work.below(t);
+
+        if (work.is_empty_tile(gt))
+        {
+            return true;
+        }
+
+        const auto index = work.node_to_index(work.get_node(gt));
+
+        return index >= num_unplaced_fanouts.size() || num_unplaced_fanouts[index] == 0u ||
+               num_free_exits(work, gt) >= num_unplaced_fanouts[index];
+    }
+    /**
+     * Computes the index of the given ground tile in `num_reservations`.
+     *
+     * @param work Layout to consider.
+     * @param t Ground tile.
+     * @return Index of `t`.
+     */
+    [[nodiscard]] static std::size_t reservation_index(const Lyt& work, const tile<Lyt>& t) noexcept
+    {
+        return static_cast<std::size_t>(t.y) * static_cast<std::size_t>(work.x() + 1) + static_cast<std::size_t>(t.x);
+    }
+    /**
+     * Checks whether the given ground tile is reserved as an exit of any node.
+     *
+     * @param work Layout to consider.
+     * @param t Ground tile to check.
+     * @return `true` iff `t` is reserved.
+     */
+    [[nodiscard]] bool is_reserved(const Lyt& work, const tile<Lyt>& t) const noexcept
+    {
+        return num_reservations[reservation_index(work, t)] > 0u;
+    }
+    /**
+     * Checks whether the given ground tile is reserved as an exit of any node other than the given ones.
+     *
+     * @param work Layout to consider.
+     * @param t Ground tile to check.
+     * @param sources Tiles of the nodes whose reservations are to be ignored.
+     * @return `true` iff `t` is reserved by a node that is not located on any of `sources`.
+     */
+    [[nodiscard]] bool is_reserved_by_others(const Lyt& work, const tile<Lyt>& t,
+                                             const std::vector<tile<Lyt>>& sources) const noexcept
+    {
+        const auto num_own =
+            std::count_if(sources.cbegin(), sources.cend(),
+                          [this, &work, &t](const auto& src)
+                          {
+                              const auto& exits = reserved_exits[work.node_to_index(work.get_node(src))];
+                              return std::find(exits.cbegin(), exits.cend(), t) != exits.cend();
+                          });
+
+        return num_reservations[reservation_index(work, t)] > static_cast<uint32_t>(num_own);
+    }
+    /**
+     * Reserves all empty outgoing clocked zones of the node on the given tile as its exits if it has unplaced fanouts
+     * and cannot afford to lose any of them, i.e., if it has no more empty outgoing clocked zones than unplaced
+     * fanouts. Reserved tiles are obstructed such that neither other nodes nor wires of other nodes can occupy them.
+     * Nothing is reserved unless `reserve_pending_exits` is set.
+     *
+     * @param work Layout to consider.
+     * @param obstr Obstruction view on `work`.
+     * @param t Tile of the node whose exits are to be reserved.
+     */
+    void reserve_exits(const Lyt& work, obstruction_layout<Lyt>& obstr, const tile<Lyt>& t)
+    {
+        const auto index = work.node_to_index(work.get_node(t));
+
+        if (!reserve_pending_exits || num_unplaced_fanouts[index] == 0u)
+        {
+            return;
+        }
+
+        uint32_t num_empty = 0u;
+        work.foreach_outgoing_clocked_zone(t, [&work, &num_empty](const auto& out)
+                                           { num_empty += work.is_empty_tile(work.below(out)) ? 1u : 0u; });
+
+        if (num_empty > num_unplaced_fanouts[index])
+        {
+            return;
+        }
+
+        work.foreach_outgoing_clocked_zone(t,
+                                           [this, &work, &obstr, &index](const auto& out)
+                                           {
+                                               const auto gout = work.below(out);
+
+                                               if (work.is_empty_tile(gout))
+                                               {
+                                                   reserved_exits[index].push_back(gout);
+
+                                                   if (num_reservations[reservation_index(work, gout)]++ == 0u)
+                                                   {
+                                                       obstr.obstruct_coordinate(gout);
+                                                   }
+                                               }
+                                           });
+    }
+    /**
+     * Releases all exits reserved by the node on the given tile.
+     *
+     * @param work Layout to consider.
+     * @param obstr Obstruction view on `work`.
+     * @param t Tile of the node whose exits are to be released.
+     */
+    void release_exits(const Lyt& work, obstruction_layout<Lyt>& obstr, const tile<Lyt>& t)
+    {
+        auto& exits = reserved_exits[work.node_to_index(work.get_node(t))];
+
+        for (const auto& e : exits)
+        {
+            if (--num_reservations[reservation_index(work, e)] == 0u)
+            {
+                obstr.clear_obstructed_coordinate(e);
+            }
+        }
+
+        exits.clear();
+    }
+    /**
+     * Places a node on tile `t` by routing all its fanins to `t` and creating it there via `create`. To this end, the
+     * exits reserved by the fanins are released such that they can be used by the node and its wires. Tile `t` must not
+     * be reserved by any other node. The placement is rejected and undone if it leaves any node that is adjacent to one
+     * of the newly occupied tiles without enough free exits to reach all of its unplaced fanouts. Afterward, the exits
+     * of the node and of all fanins that still have unplaced fanouts are reserved.
+     *
+     * @tparam CreateFn Functor type that creates a node from its children.
+     * @param work Layout in which the node is to be placed.
+     * @param obstr Obstruction view on `work`.
+     * @param sources Tiles in `work` that host the logic fanins of the node.
+     * @param t Tile to place the node on.
+     * @param num_fanouts Number of logic fanouts of the node.
+     * @param create Functor that creates the node on `t` given its children.
+     * @return Signal of the placed node or `std::nullopt` if it could not be placed on `t`.
+     */
+    template <typename CreateFn>
+    [[nodiscard]] std::optional<mockturtle::signal<Lyt>>
+    try_place(Lyt& work, obstruction_layout<Lyt>& obstr, const std::vector<tile<Lyt>>& sources, const tile<Lyt>& t,
+              const uint32_t num_fanouts, CreateFn&& create)
+    {
+        const auto reserve_sources = [this, &work, &obstr, &sources]
+        { std::for_each(sources.cbegin(), sources.cend(), [&](const auto& src) { reserve_exits(work, obstr, src); }); };
+
+        std::for_each(sources.cbegin(), sources.cend(), [&](const auto& src) { release_exits(work, obstr, src); });
+
+        if (is_reserved(work, t))
+        {
+            reserve_sources();
+
+            return std::nullopt;
+        }
+
+        std::vector<tile<Lyt>> wires{};
+
+        const auto children = route_fanins(work, obstr, sources, t, wires);
+
+        if (!children.has_value())
+        {
+            reserve_sources();
+
+            return std::nullopt;
+        }
+
+        const auto s = create(*children);
+
+        const auto index = work.node_to_index(work.get_node(s));
+        if (index >= num_unplaced_fanouts.size())
+        {
+            num_unplaced_fanouts.resize(static_cast<std::size_t>(index) + 1, 0u);
+            reserved_exits.resize(static_cast<std::size_t>(index) + 1);
+        }
+        num_unplaced_fanouts[index] = num_fanouts;
+
+        for (const auto& src : sources)
+        {
+            --num_unplaced_fanouts[work.node_to_index(work.get_node(src))];
+        }
+
+        // only nodes that are adjacent to newly occupied tiles can have lost exits
+        bool sufficient = has_sufficient_exits(work, t);
+
+        wires.push_back(t);
+        for (auto it = wires.cbegin(); sufficient && it != wires.cend(); ++it)
+        {
+            work.foreach_incoming_clocked_zone(*it,
+                                               [this, &work, &sufficient](const auto& in)
+                                               {
+                                                   sufficient = sufficient && has_sufficient_exits(work, in) &&
+                                                                has_sufficient_exits(work, work.above(in));
+                                               });
+        }
+        wires.pop_back();
+
+        if (sufficient)
+        {
+            reserve_exits(work, obstr, t);
+            reserve_sources();
+
+            return s;
+        }
+
+        // undo the placement
+        for (const auto& src : sources)
+        {
+            ++num_unplaced_fanouts[work.node_to_index(work.get_node(src))];
+        }
+        num_unplaced_fanouts[index] = 0u;
+
+        work.clear_tile(t);
+        std::for_each(wires.crbegin(), wires.crend(), [&work](const auto& w) { work.clear_tile(w); });
+
+        reserve_sources();
+
+        return std::nullopt;
+    }
+    /**
+     * Re-places all gates and fanouts of the layout as far north-west as their fanins permit and re-routes all of their
+     * connections. To this end, the logic elements are visited in the layout's diagonal order, which is topological
+     * under 2DDWave clocking. PIs keep their positions. Each gate and fanout is placed on the first free tile
+     * south-east of all its fanins, in order of increasing distance to them, to which all fanins can be routed. POs are
+     * placed in the column east of all other nodes to keep them at the layout's eastern border.
+     *
+     * The relocation works on a layout that is twice as large as the original one in each dimension to leave room for
+     * detours. The result is shrunk to its bounding box afterward. If `reserve_pending_exits` is set, nodes reserve
+     * their last free exits for their unplaced fanouts (see `reserve_exits`).
+     *
+     * @return The layout with relocated gates or `std::nullopt` if any node could not be placed.
+     */
+    [[nodiscard]] std::optional<Lyt> relocate_gates()
+    {
+        Lyt work{{2 * lyt.x() + 1, 2 * lyt.y() + 1, lyt.z()}, lyt.get_clocking_scheme()};
+
+        // shares its storage with work
+        obstruction_layout<Lyt> obstr{work};
+
+        mockturtle::node_map<mockturtle::signal<Lyt>, Lyt> old2new{lyt};
+
+        old2new[lyt.get_node(lyt.get_constant(false))] = work.get_constant(false);
+        old2new[lyt.get_node(lyt.get_constant(true))]  = work.get_constant(true);
+
+        std::vector<mockturtle::node<Lyt>> nodes{};
+        lyt.foreach_node(
+            [this, &nodes](const auto& n)
+            {
+                if (!lyt.is_constant(n) && !lyt.is_pi(n) && !lyt.is_po(n) && is_logic_node(n))
+                {
+                    nodes.push_back(n);
+                }
+            });
+
+        // count the logic fanouts of all logic nodes
+        mockturtle::node_map<uint32_t, Lyt> num_fanouts{lyt, 0u};
+
+        const auto count_fanouts = [this, &num_fanouts](const auto& n)
+        {
+            for (const auto& fin : logic_fanins(n))
+            {
+                ++num_fanouts[fin];
+            }
+        };
+
+        std::for_each(nodes.cbegin(), nodes.cend(), count_fanouts);
+        lyt.foreach_po([this, &count_fanouts](const auto& po) { count_fanouts(lyt.get_node(po)); });
+
+        num_unplaced_fanouts.clear();
+        reserved_exits.clear();
+        num_reservations.assign(static_cast<std::size_t>(work.x() + 1) * static_cast<std::size_t>(work.y() + 1), 0u);
+
+        lyt.foreach_pi(
+            [this, &work, &old2new, &num_fanouts](const auto& pi)
+            {
+                old2new[pi] = work.create_pi({}, lyt.get_tile(pi));
+
+                const auto index = work.node_to_index(work.get_node(old2new[pi]));
+                num_unplaced_fanouts.resize(std::max(num_unplaced_fanouts.size(), static_cast<std::size_t>(index) + 1),
+                                            0u);
+                reserved_exits.resize(num_unplaced_fanouts.size());
+                num_unplaced_fanouts[index] = num_fanouts[pi];
+            });
+
+        // the PIs' exits are reserved once all of them are placed
+        lyt.foreach_pi([this, &work, &obstr](const auto& pi) { reserve_exits(work, obstr, lyt.get_tile(pi)); });
+
+        // order the nodes diagonally, which is a topological order under 2DDWave clocking
+        std::sort(nodes.begin(), nodes.end(),
+                  [this](const auto& n1, const auto& n2)
+                  {
+                      const auto t1 = lyt.get_tile(n1), t2 = lyt.get_tile(n2);
+                      return std::make_tuple(t1.x + t1.y, t1.x, t1.z) < std::make_tuple(t2.x + t2.y, t2.x, t2.z);
+                  });
+
+        uint64_t num_relocated_gates = 0ull;
+
+        // the easternmost column is reserved for the POs
+        for (const auto& n : nodes)
+        {
+            const auto placed =
+                place_south_east(work, obstr, n, source_tiles(n, old2new), num_fanouts[n], work.x() - 1, work.y());
+
+            if (!placed.has_value())
+            {
+                return std::nullopt;
+            }
+
+            old2new[n] = *placed;
+
+            if (!lyt.is_wire(n) && static_cast<tile<Lyt>>(*placed) != lyt.get_tile(n))
+            {
+                ++num_relocated_gates;
+            }
+        }
+
+        // the POs are placed east of all other nodes
+        const auto po_x = bounding_box(work).first + 1;
+
+        bool placed_pos = true;
+        lyt.foreach_po(
+            [this, &work, &obstr, &old2new, &po_x, &placed_pos](const auto& po)
+            {
+                const auto n       = lyt.get_node(po);
+                const auto sources = source_tiles(n, old2new);
+
+                assert(sources.size() == 1);
+
+                // scan the PO column from north to south
+                for (auto y = static_cast<uint64_t>(sources.front().y); y <= work.y(); ++y)
+                {
+                    const tile<Lyt> t{po_x, y};
+
+                    if (!work.is_empty_tile(t) || t == sources.front() || is_reserved_by_others(work, t, sources))
+                    {
+                        continue;
+                    }
+
+                    if (const auto placed = try_place(work, obstr, sources, t, 0u,
+                                                      [&work, &t](const auto& children)
+                                                      { return work.create_po(children.front(), {}, t); });
+                        placed.has_value())
+                    {
+                        old2new[n] = *placed;
+
+                        return true;
+                    }
+                }
+
+                placed_pos = false;
+
+                return false;
+            });
+
+        if (!placed_pos)
+        {
+            return std::nullopt;
+        }
+
+        // shrink the layout to its bounding box
+        const auto [x_max, y_max] = bounding_box(work);
+        work.resize({x_max, y_max, lyt.z()});
+
+        restore_names(lyt, work);
+
+        pst.num_relocated_gates = num_relocated_gates;
+
+        return work;
+    }
+    /**
+     * Determines the bounding box of all nodes placed in the given layout.
+     *
+     * @param work Layout to consider.
+     * @return Maximum x- and y-coordinates of all placed nodes.
+     */
+    [[nodiscard]] static std::pair<uint64_t, uint64_t> bounding_box(const Lyt& work) noexcept
+    {
+        uint64_t x_max = 0ull, y_max = 0ull;
+
+        work.foreach_node(
+            [&work, &x_max, &y_max](const auto& n)
+            {
+                if (!work.is_constant(n))
+                {
+                    const auto t = work.get_tile(n);
+                    x_max        = std::max(x_max, static_cast<uint64_t>(t.x));
+                    y_max        = std::max(y_max, static_cast<uint64_t>(t.y));
+                }
+            });
+
+        return {x_max, y_max};
+    }
+    /**
+     * Determines the tiles that host the logic fanins of the given node in the relocated layout.
+     *
+     * @param n Logic node of the layout that is being compacted.
+     * @param old2new Mapping from nodes of the layout that is being compacted to signals of the relocated layout.
+     * @return Tiles of the logic fanins of `n` in the relocated layout.
+     */
+    [[nodiscard]] std::vector<tile<Lyt>>
+    source_tiles(const mockturtle::node<Lyt>&                              n,
+                 const mockturtle::node_map<mockturtle::signal<Lyt>, Lyt>& old2new) const noexcept
+    {
+        std::vector<tile<Lyt>> sources{};
+
+        for (const auto& fin : logic_fanins(n))
+        {
+            sources.push_back(static_cast<tile<Lyt>>(old2new[fin]));
+        }
+
+        return sources;
+    }
+    /**
+     * Places the given node on the first free tile south-east of all its fanins to which all fanins can be routed.
+     * Candidate tiles are tried along the anti-diagonals in order of increasing distance to the fanins and, within an
+     * anti-diagonal, from the center outwards such that the layout grows evenly in both dimensions. At most
+     * `max_candidates` tiles are tried.
+     *
+     * @param work Layout in which `n` is to be placed.
+     * @param obstr Obstruction view on `work`.
+     * @param n Node of the layout that is being compacted whose function is to be placed.
+     * @param sources Tiles in `work` that host the logic fanins of `n`.
+     * @param num_fanouts Number of logic fanouts of `n`.
+     * @param x_bound Maximum x-coordinate of candidate tiles.
+     * @param y_bound Maximum y-coordinate of candidate tiles.
+     * @return Signal of the placed node or `std::nullopt` if no candidate tile was feasible.
+     */
+    [[nodiscard]] std::optional<mockturtle::signal<Lyt>>
+    place_south_east(Lyt& work, obstruction_layout<Lyt>& obstr, const mockturtle::node<Lyt>& n,
+                     const std::vector<tile<Lyt>>& sources, const uint32_t num_fanouts, const uint64_t x_bound,
+                     const uint64_t y_bound)
+    {
+        uint64_t x_min = 0ull, y_min = 0ull;
+        for (const auto& src : sources)
+        {
+            x_min = std::max(x_min, static_cast<uint64_t>(src.x));
+            y_min = std::max(y_min, static_cast<uint64_t>(src.y));
+        }
+
+        const auto create = [this, &work, &n](const tile<Lyt>& t)
+        {
+            return [this, &work, &n, t](const auto& children)
+            { return work.create_node(children, lyt.node_function(n), t); };
+        };
+
+        uint32_t num_candidates = 0u;
+
+        for (auto d = 0ull; d <= (x_bound - x_min) + (y_bound - y_min); ++d)
+        {
+            // offsets (dx, dy) with dx + dy == d ordered from the center outwards
+            std::vector<std::pair<uint64_t, uint64_t>> offsets{};
+            for (auto dx = 0ull; dx <= d; ++dx)
+            {
+                if (x_min + dx <= x_bound && y_min + d - dx <= y_bound)
+                {
+                    offsets.emplace_back(dx, d - dx);
+                }
+            }
+            std::stable_sort(offsets.begin(), offsets.end(),
+                             [](const auto& o1, const auto& o2)
+                             {
+                                 const auto imbalance = [](const auto& o)
+                                 { return o.first > o.second ? o.first - o.second : o.second - o.first; };
+                                 return imbalance(o1) < imbalance(o2);
+                             });
+
+            for (const auto& [dx, dy] : offsets)
+            {
+                const tile<Lyt> t{x_min + dx, y_min + dy};
+
+                if (!work.is_empty_tile(t) || std::find(sources.cbegin(), sources.cend(), t) != sources.cend() ||
+                    is_reserved_by_others(work, t, sources))
+                {
+                    continue;
+                }
+
+                if (const auto placed = try_place(work, obstr, sources, t, num_fanouts, create(t)); placed.has_value())
+                {
+                    return placed;
+                }
+
+                if (++num_candidates >= ps.max_candidates)
+                {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Flags indicating whether the respective column or row is going to be removed in the current round.
+     */
+    std::vector<bool> remove_column{}, remove_row{};
+    /**
+     * Number of removed columns west of the respective column and number of removed rows north of the respective row.
+     */
+    std::vector<uint64_t> column_shift{}, row_shift{};
+    /**
+     * Number of logic fanouts of each node in the relocated layout that have not been placed yet, indexed by node.
+     */
+    std::vector<uint32_t> num_unplaced_fanouts{};
+    /**
+     * Flag indicating whether nodes reserve their exits during the current relocation (see `reserve_exits`).
+     */
+    bool reserve_pending_exits{false};
+    /**
+     * Empty tiles reserved as exits by each node in the relocated layout, indexed by node.
+     */
+    std::vector<std::vector<tile<Lyt>>> reserved_exits{};
+    /**
+     * Number of nodes that reserved the respective ground tile of the relocated layout as an exit.
+     */
+    std::vector<uint32_t> num_reservations{};
+    /**
+     * Checks whether the given node is a wire segment that passes straight through its tile, i.e., that has exactly
+     * one incoming signal from the west and one outgoing signal to the east (horizontal) or exactly one incoming signal
+     * from the north and one outgoing signal to the south (vertical).
+     *
+     * @param n Node to check.
+     * @param horizontal Flag to check for horizontal (`true`) or vertical (`false`) wire segments.
+     * @return `true` iff `n` is a straight wire segment in the given orientation.
+     */
+    [[nodiscard]] bool is_straight_wire(const mockturtle::node<Lyt>& n, const bool horizontal) const noexcept
+    {
+        if (!lyt.is_wire(n) || lyt.is_pi(n) || lyt.is_po(n))
+        {
+            return false;
+        }
+
+        const auto t = lyt.get_tile(n);
+
+        const auto in  = lyt.incoming_data_flow(t);
+        const auto out = lyt.outgoing_data_flow(t);
+
+        if (in.size() != 1 || out.size() != 1)
+        {
+            return false;
+        }
+
+        if (horizontal)
+        {
+            return in.front().x + 1 == t.x && in.front().y == t.y && out.front().x == t.x + 1 && out.front().y == t.y;
+        }
+
+        return in.front().y + 1 == t.y && in.front().x == t.x && out.front().y == t.y + 1 && out.front().x == t.x;
+    }
+    /**
+     * A column can be removed if all of its tiles are either empty or host horizontal straight wire segments only.
+     * Analogously, a row can be removed if all of its tiles are either empty or host vertical straight wire segments
+     * only. Since a tile cannot host both, columns and rows can be removed simultaneously without conflicts. Thereby,
+     * 2DDWave's clocking is preserved because all remaining connections are shifted towards adjacent tiles.
+     *
+     * @return `true` iff at least one column or row can be removed.
+     */
+    [[nodiscard]] bool determine_removable_lines()
+    {
+        const auto width  = static_cast<std::size_t>(lyt.x() + 1);
+        const auto height = static_cast<std::size_t>(lyt.y() + 1);
+
+        remove_column.assign(width, true);
+        remove_row.assign(height, true);
+
+        lyt.foreach_node(
+            [this](const auto& n)
+            {
+                if (lyt.is_constant(n) || lyt.is_dead(n))
+                {
+                    return;
+                }
+
+                const auto t = lyt.get_tile(n);
+
+                if (!is_straight_wire(n, true))
+                {
+                    remove_column[static_cast<std::size_t>(t.x)] = false;
+                }
+                if (!is_straight_wire(n, false))
+                {
+                    remove_row[static_cast<std::size_t>(t.y)] = false;
+                }
+            });
+
+        // at least one column and one row have to remain
+        const auto keep_one = [](auto& remove)
+        {
+            if (std::all_of(remove.cbegin(), remove.cend(), [](const auto r) { return r; }))
+            {
+                remove.front() = false;
+            }
+        };
+
+        keep_one(remove_column);
+        keep_one(remove_row);
+
+        const auto prefix_sum = [](const auto& remove, auto& shift)
+        {
+            shift.assign(remove.size(), 0ull);
+
+            for (std::size_t i = 1; i < remove.size(); ++i)
+            {
+                shift[i] = shift[i - 1] + (remove[i - 1] ? 1ull : 0ull);
+            }
+        };
+
+        prefix_sum(remove_column, column_shift);
+        prefix_sum(remove_row, row_shift);
+
+        return std::any_of(remove_column.cbegin(), remove_column.cend(), [](const auto r) { return r; }) ||
+               std::any_of(remove_row.cbegin(), remove_row.cend(), [](const auto r) { return r; });
+    }
+    /**
+     * Checks whether the given tile is located in a column or row that is going to be removed.
+     *
+     * @param t Tile to check.
+     * @return `true` iff `t` is going to be removed.
+     */
+    [[nodiscard]] bool is_removed(const tile<Lyt>& t) const noexcept
+    {
+        return remove_column[static_cast<std::size_t>(t.x)] || remove_row[static_cast<std::size_t>(t.y)];
+    }
+    /**
+     * Computes the position of the given tile after all removable columns and rows have been removed.
+     *
+     * @param t Tile whose new position is desired.
+     * @return New position of `t`.
+     */
+    [[nodiscard]] tile<Lyt> shift(const tile<Lyt>& t) const noexcept
+    {
+        return {t.x - column_shift[static_cast<std::size_t>(t.x)], t.y - row_shift[static_cast<std::size_t>(t.y)],
+                t.z};
+    }
+    /**
+     * Creates a new layout without the removable columns and rows. Wire segments located in them are bypassed by
+     * connecting their fanouts directly to their fanins, which are adjacent after the shift.
+     *
+     * @return The compacted layout.
+     */
+    [[nodiscard]] Lyt remove_lines()
+    {
+        const auto num_removed_columns =
+            static_cast<uint64_t>(std::count(remove_column.cbegin(), remove_column.cend(), true));
+        const auto num_removed_rows = static_cast<uint64_t>(std::count(remove_row.cbegin(), remove_row.cend(), true));
+
+        pst.num_removed_columns += num_removed_columns;
+        pst.num_removed_rows += num_removed_rows;
+
+        Lyt compact_lyt{{lyt.x() - num_removed_columns, lyt.y() - num_removed_rows, lyt.z()},
+                        lyt.get_clocking_scheme()};
+
+        // all nodes are committed to the compacted layout in a single pass
+        gate_level_layout_builder<Lyt> builder{compact_lyt};
+        builder.reserve(lyt.num_gates() + lyt.num_wires());
+
+        mockturtle::node_map<mockturtle::signal<Lyt>, Lyt> old2new{lyt};
+
+        old2new[lyt.get_node(lyt.get_constant(false))] = compact_lyt.get_constant(false);
+        old2new[lyt.get_node(lyt.get_constant(true))]  = compact_lyt.get_constant(true);
+
+        // PIs are created first to preserve their order
+        lyt.foreach_pi([this, &builder, &old2new](const auto& pi)
+                       { old2new[pi] = builder.create_pi({}, shift(lyt.get_tile(pi))); });
+
+        // only occupied tiles have to be visited; PIs have already been created and POs are created last to preserve
+        // their order
+        std::vector<tile<Lyt>> tiles{};
+        tiles.reserve(lyt.num_gates() + lyt.num_wires());
+        lyt.foreach_node(
+            [this, &tiles](const auto& n)
+            {
+                if (lyt.is_constant(n) || lyt.is_pi(n) || lyt.is_po(n))
+                {
+                    return;
+                }
+
+                tiles.push_back(lyt.get_tile(n));
+            });
+
+        // order the tiles diagonally, which is a topological order under 2DDWave clocking
+        std::sort(tiles.begin(), tiles.end(),
+                  [](const auto& t1, const auto& t2)
+                  { return std::make_tuple(t1.x + t1.y, t1.x, t1.z) < std::make_tuple(t2.x + t2.y, t2.x, t2.z); });
+
+        for (const auto& t : tiles)
+        {
+            const auto n = lyt.get_node(t);
+
+            std::vector<mockturtle::signal<Lyt>> children{};
+            lyt.foreach_fanin(n, [this, &children, &old2new](const auto& fi)
+                              { children.push_back(old2new[lyt.get_node(fi)]); });
+
+            // bypass wire segments in removed columns and rows
+            if (is_removed(t))
+            {
+                assert(children.size() == 1);
+
+                old2new[n] = children.front();
+                ++pst.num_removed_wires;
+
+                continue;
+            }
+
+            old2new[n] = builder.create_node(children, lyt.node_function(n), shift(t));
+        }
+
+        lyt.foreach_po(
+            [this, &builder, &old2new](const auto& po)
+            {
+                const auto n = lyt.get_node(po);
+
+                std::vector<mockturtle::signal<Lyt>> children{};
+                lyt.foreach_fanin(n, [this, &children, &old2new](const auto& fi)
+                                  { children.push_back(old2new[lyt.get_node(fi)]); });
+
+                assert(children.size() == 1);
+
+                old2new[n] = builder.create_po(children.front(), {}, shift(lyt.get_tile(n)));
+            });
+
+        builder.finalize();
+
+        restore_names(lyt, compact_lyt, old2new);
+
+        return compact_lyt;
+    }
+};
+
+}  // namespace detail
+
+/**
+ * A post-layout optimization that compacts 2DDWave-clocked Cartesian gate-level layouts by removing all columns that
+ * consist exclusively of horizontal straight wire segments and all rows that consist exclusively of vertical straight
+ * wire segments. The fanouts of the removed segments are directly connected to their fanins, which are adjacent after
+ * the remaining tiles have been shifted towards the north-west. Since 2DDWave's clock numbers only depend on the tiles'
+ * positions, all remaining connections stay properly clocked, i.e., the result is free of design rule violations if
+ * the input layout was.
+ *
+ * Such lines are particularly common in layouts generated by `orthogonal`, which claims a fresh column or row for each
+ * placed gate and routes all POs to the eastern border. Each compaction round only visits occupied tiles, i.e., its
+ * run time depends on the number of placed nodes rather than on the layout area. Rounds are repeated until no further
+ * line can be removed because removing columns can render rows removable and vice versa.
+ *
+ * Unless disabled via `ps`, the gates are relocated afterward. Therefore, all gates and fanouts are re-placed in
+ * topological order on the first free tile south-east of their fanins, i.e., as far north-west as possible, and their
+ * connections are re-routed via A*. PIs keep their positions and POs are placed at the new eastern border. The
+ * relocated layout is only returned if it is strictly smaller than the one obtained by line removal alone.
+ *
+ * @tparam Lyt Cartesian gate-level layout type.
+ * @param lyt 2DDWave-clocked gate-level layout to compact.
+ * @param ps Parameters.
+ * @param pst Statistics.
+ * @return A compacted copy of `lyt`.
+ */
+template <typename Lyt>
+Lyt compaction(const Lyt& lyt, compaction_params ps = {}, compaction_stats* pst = nullptr)
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+    static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
+    assert(lyt.is_clocking_scheme(clock_name::TWODDWAVE));
+
+    compaction_stats             st{};
+    detail::compaction_impl<Lyt> p{lyt, ps, st};
+
+    auto result = p.run();
+
+    if (pst)
+    {
+        *pst = st;
+    }
+
+    return result;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_COMPACTION_HPP
@@ -9,6 +9,7 @@
 
 #include "fiction/algorithms/iter/aspect_ratio_iterator.hpp"
 #include "fiction/algorithms/network_transformation/fanout_substitution.hpp"
+#include "fiction/algorithms/physical_design/orthogonal.hpp"
 #include "fiction/io/print_layout.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
 #include "fiction/technology/cell_ports.hpp"
@@ -30,6 +31,7 @@
 #include <mockturtle/views/depth_view.hpp>
 #include <mockturtle/views/fanout_view.hpp>
 #include <mockturtle/views/topo_view.hpp>
+#include <nlohmann/json.hpp>
 #if (PROGRESS_BARS)
 #include <mockturtle/utils/progress_bar.hpp>
 #endif
@@ -43,9 +45,12 @@
 #include <cstdint>
 #include <functional>
 #include <future>
+#include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
@@ -105,6 +110,13 @@ struct exact_physical_design_params
      * Flag to indicate that I/Os should be placed at the layout's border.
      */
     bool border_io = false;
+    /**
+     * Flag to indicate that, in combination with `border_io`, inputs of 2DDWave-clocked layouts should only be placed
+     * at the northern or western border and outputs only at the southern or eastern border, i.e., where information
+     * can enter and leave the layout. Thereby, all I/Os can be connected from outside the layout. This may increase
+     * the layout size or render instances unsatisfiable.
+     */
+    bool directional_border_io = false;
     /**
      * Flag to indicate that artificial clock latch delays should be used to balance paths (runtime expensive!).
      */
@@ -129,6 +141,30 @@ struct exact_physical_design_params
      * Sets a timeout in ms for the solving process. Standard is 4294967 seconds as defined by Z3.
      */
     unsigned timeout = 4294967u;
+    /**
+     * Sets a memory limit in MiB for the solving process. Standard is unlimited. Since Z3 does not provide a
+     * per-context memory limit, its process-wide estimated allocation size is monitored. Once the limit is exceeded,
+     * all solvers are interrupted and the exploration of further aspect ratios is aborted since smaller ones might be
+     * left undecided. In best-effort mode, the heuristic layout is returned in this case.
+     */
+    std::size_t memory_limit = std::numeric_limits<std::size_t>::max();
+    /**
+     * Flag to indicate that a best-effort (anytime) mode should be used. In this mode, a heuristic layout is created
+     * first via the orthogonal physical design algorithm. Its dimensions are used to cap `upper_bound_x` and
+     * `upper_bound_y` before the exact search starts. If the exact search runs out of time or memory or exhausts the
+     * capped bounds, the heuristic layout is returned instead of `std::nullopt`.
+     *
+     * @note The heuristic layout is only available for Cartesian layouts with 2DDWave clocking. Furthermore, it does
+     * not respect all constraints of exact, e.g., it always uses crossings. Check
+     * `exact_physical_design_stats::is_fallback` to distinguish the results.
+     */
+    bool best_effort = false;
+    /**
+     * Flag to indicate that the generation of the SMT instance should be profiled per constraint family (see
+     * `exact_physical_design_stats::constraint_profile`). Counting the added assertions requires a copy of the
+     * solver's assertions before and after each family, which is why profiling is disabled by default.
+     */
+    bool smt_profiling = false;
     /**
      * Technology-specific constraints that are only to be added for a certain target technology.
      */
@@ -143,12 +179,54 @@ struct exact_physical_design_params
  */
 struct exact_physical_design_stats
 {
+    /**
+     * Profiling information about a family of constraints, i.e., about the assertions generated by one of the
+     * constraint generating functions of the SMT encoding. Values are accumulated over all explored aspect ratios. Only
+     * collected if `exact_physical_design_params::smt_profiling` is set.
+     */
+    struct constraint_family_profile
+    {
+        /**
+         * Time spent generating the constraints.
+         */
+        mockturtle::stopwatch<>::duration time{0};
+        /**
+         * Number of variable expressions requested from the context.
+         */
+        uint64_t num_expressions{0ull};
+        /**
+         * Number of assertions and assumptions added to the solver.
+         */
+        uint64_t num_assertions{0ull};
+    };
+
     mockturtle::stopwatch<>::duration time_total{0};
 
     uint64_t x_size{0ull}, y_size{0ull};
     uint64_t num_gates{0ull}, num_wires{0ull};
 
     uint32_t num_aspect_ratios{0ul};
+    /**
+     * `true` iff the returned layout was found by the SMT solver and is, thus, proven optimal under the given
+     * constraints.
+     */
+    bool is_optimal{false};
+    /**
+     * `true` iff the returned layout is the heuristic one of the best-effort mode.
+     */
+    bool is_fallback{false};
+    /**
+     * `true` iff the search was aborted because the memory limit was exceeded.
+     */
+    bool is_memory_limit_exceeded{false};
+    /**
+     * Maps the names of the constraint generating functions to their respective profiling information.
+     */
+    std::map<std::string, constraint_family_profile> constraint_profile{};
+    /**
+     * Z3's statistics of the most recent solver call, e.g., the number of conflicts, decisions, or the memory usage.
+     */
+    std::map<std::string, double> solver_statistics{};
 
     void report(std::ostream& out = std::cout) const
     {
@@ -156,6 +234,25 @@ struct exact_physical_design_stats
         out << fmt::format("[i] layout size = {} × {}\n", x_size, y_size);
         out << fmt::format("[i] num. gates  = {}\n", num_gates);
         out << fmt::format("[i] num. wires  = {}\n", num_wires);
+        out << fmt::format("[i] optimal     = {}\n", is_optimal ? "yes" : (is_fallback ? "no (heuristic)" : "no"));
+    }
+    /**
+     * Returns the profiling information about the SMT instance generation together with Z3's solver statistics as a
+     * JSON object.
+     *
+     * @return JSON object containing the constraint profile and the solver statistics.
+     */
+    [[nodiscard]] nlohmann::json smt_profile() const
+    {
+        nlohmann::json constraints{};
+        for (const auto& [family, profile] : constraint_profile)
+        {
+            constraints[family] = {{"runtime in seconds", mockturtle::to_seconds(profile.time)},
+                                   {"number of expressions", profile.num_expressions},
+                                   {"number of assertions", profile.num_assertions}};
+        }
+
+        return nlohmann::json{{"constraints", constraints}, {"solver statistics", solver_statistics}};
     }
 };
 
@@ -181,6 +278,11 @@ class exact_impl
 
         lower_bound = static_cast<decltype(lower_bound)>(ntk->num_gates() + ntk->num_pis());
 
+        if (ps.best_effort)
+        {
+            determine_heuristic_layout(src);
+        }
+
         // NOLINTNEXTLINE(*-prefer-member-initializer)
         ari = aspect_ratio_iterator<typename Lyt::aspect_ratio>{
             ps.fixed_size ? static_cast<uint64_t>(ps.upper_bound_x * ps.upper_bound_y) :
@@ -189,12 +291,18 @@ class exact_impl
 
     std::optional<Lyt> run()
     {
-        if (ps.num_threads > 1)
+        auto result = ps.num_threads > 1 ? run_asynchronously() : run_synchronously();
+
+        // fall back to the heuristic layout if the exact search did not yield any result
+        if (!result.has_value() && heuristic_layout.has_value())
         {
-            return run_asynchronously();
+            pst.is_fallback = true;
+            assign_layout_statistics(*heuristic_layout);
+
+            return heuristic_layout;
         }
 
-        return run_synchronously();
+        return result;
     }
 
   private:
@@ -231,6 +339,18 @@ class exact_impl
      * Restricts access to the aspect_ratio_iterator and the result_aspect_ratio.
      */
     std::mutex ari_mutex{}, rar_mutex{};
+    /**
+     * Restricts access to the statistics' profiling information that is shared among all SMT handlers.
+     */
+    std::mutex pst_mutex{};
+    /**
+     * Restricts access to the list of thread information that is shared among all worker threads.
+     */
+    std::mutex ti_mutex{};
+    /**
+     * Heuristic layout that is returned in best-effort mode if no exact result could be determined.
+     */
+    std::optional<Lyt> heuristic_layout{std::nullopt};
 
     using ctx_ptr      = std::shared_ptr<z3::context>;
     using solver_ptr   = std::shared_ptr<z3::solver>;
@@ -250,13 +370,17 @@ class exact_impl
          * @param ctxp The context that is used in all solvers.
          * @param lyt The empty gate-level layout that is going to contain the created layout.
          * @param ps The parameters to respect in the SMT instance generation process.
+         * @param st The statistics to store profiling information in.
+         * @param st_mutex Mutex restricting access to st as it might be shared between multiple handlers.
          */
-        smt_handler(ctx_ptr ctxp, Lyt& lyt, const topology_ntk_t& ntk,
-                    const exact_physical_design_params<Lyt>& ps) noexcept :
+        smt_handler(ctx_ptr ctxp, Lyt& lyt, const topology_ntk_t& ntk, const exact_physical_design_params<Lyt>& ps,
+                    exact_physical_design_stats& st, std::mutex& st_mutex) noexcept :
                 ctx{std::move(ctxp)},
                 layout{lyt},
                 network{ntk},
                 params{ps},
+                stats{st},
+                stats_mutex{st_mutex},
                 node2pos{ntk},
                 depth_ntk{ntk},
                 inv_levels{inverse_levels(ntk)}
@@ -355,7 +479,20 @@ class exact_impl
         {
             generate_smt_instance();
 
-            if (const auto z3_result = solver->check(check_point->assumptions); z3_result == z3::sat)
+            auto z3_result = z3::unknown;
+            try
+            {
+                z3_result = solver->check(check_point->assumptions);
+            }
+            catch (const z3::exception&)  // timed out or interrupted
+            {
+                store_solver_statistics();
+                throw;
+            }
+
+            store_solver_statistics();
+
+            if (z3_result == z3::sat)
             {
                 // optimize the generated result
                 if (auto opt = optimize(); opt != nullptr)
@@ -472,6 +609,18 @@ class exact_impl
          * Configurations specifying layout restrictions. Used in instance generation among other places.
          */
         const exact_physical_design_params<Lyt> params;
+        /**
+         * Statistics to store profiling information in.
+         */
+        exact_physical_design_stats& stats;
+        /**
+         * Restricts access to stats.
+         */
+        std::mutex& stats_mutex;
+        /**
+         * Counter for the variable expressions requested from the context. Used for profiling.
+         */
+        uint64_t num_expressions{0ull};
         /**
          * Maps nodes to tile positions when creating the layout from the SMT model.
          */
@@ -751,6 +900,8 @@ class exact_impl
          */
         [[nodiscard]] z3::expr get_tn(const typename Lyt::tile& t, const mockturtle::node<topology_ntk_t>& n)
         {
+            ++num_expressions;
+
             return ctx->bool_const(fmt::format("tn_({},{})_{}", t.x, t.y, n).c_str());
         }
         /**
@@ -762,6 +913,8 @@ class exact_impl
          */
         [[nodiscard]] z3::expr get_te(const typename Lyt::tile& t, const mockturtle::edge<topology_ntk_t>& e)
         {
+            ++num_expressions;
+
             return ctx->bool_const(fmt::format("te_({},{})_({},{})", t.x, t.y, e.source, e.target).c_str());
         }
         /**
@@ -773,6 +926,8 @@ class exact_impl
          */
         [[nodiscard]] z3::expr get_tc(const typename Lyt::tile& t1, const typename Lyt::tile& t2)
         {
+            ++num_expressions;
+
             return ctx->bool_const(fmt::format("tc_({},{})_({},{})", t1.x, t1.y, t2.x, t2.y).c_str());
         }
         /**
@@ -784,6 +939,8 @@ class exact_impl
          */
         [[nodiscard]] z3::expr get_tp(const typename Lyt::tile& t1, const typename Lyt::tile& t2)
         {
+            ++num_expressions;
+
             return ctx->bool_const(fmt::format("tp_({},{})_({},{})", t1.x, t1.y, t2.x, t2.y).c_str());
         }
         /**
@@ -794,6 +951,8 @@ class exact_impl
          */
         [[nodiscard]] z3::expr get_ncl(const mockturtle::node<topology_ntk_t>& n, const unsigned clk)
         {
+            ++num_expressions;
+
             return ctx->bool_const(fmt::format("ncl_{}_{}", n, clk).c_str());
         }
         /**
@@ -804,6 +963,8 @@ class exact_impl
          */
         [[nodiscard]] z3::expr get_tcl(const typename Lyt::tile& t, const unsigned clk)
         {
+            ++num_expressions;
+
             return ctx->bool_const(fmt::format("tcl_({},{})_{}", t.x, t.y, clk).c_str());
         }
         /**
@@ -814,6 +975,8 @@ class exact_impl
          */
         [[nodiscard]] z3::expr get_tse(const typename Lyt::tile& t)
         {
+            ++num_expressions;
+
             return ctx->int_const(fmt::format("tse_({},{})", t.x, t.y).c_str());
         }
         /**
@@ -2020,6 +2183,31 @@ class exact_impl
                     });
             };
 
+            const auto assign_north_or_west = [this](const auto& n)
+            {
+                // tiles at the northern or western border remain there when the layout grows
+                apply_to_added_tiles(
+                    [this, &n](const auto& t)
+                    {
+                        if (!layout.is_at_northern_border(t) && !layout.is_at_western_border(t))
+                        {
+                            solver->add(!(get_tn(t, n)));
+                        }
+                    });
+            };
+
+            const auto assign_south_or_east = [this](const auto& n)
+            {
+                apply_to_added_and_updated_tiles(
+                    [this, &n](const auto& t)
+                    {
+                        if (!layout.is_at_southern_border(t) && !layout.is_at_eastern_border(t))
+                        {
+                            solver->add(!(get_tn(t, n)));
+                        }
+                    });
+            };
+
             const auto assign_east = [this](const auto& n)
             {
                 apply_to_added_and_updated_tiles(
@@ -2044,55 +2232,61 @@ class exact_impl
                     });
             };
 
+            // information flows eastwards and southwards in 2DDWave; hence, inputs can only be fed from the north or
+            // west and outputs can only be read from the south or east if requested
+            const auto directional_twoddwave =
+                params.directional_border_io && layout.is_clocking_scheme(clock_name::TWODDWAVE);
+
+            const auto assign_input = [this, &assign_north, &assign_west, &assign_north_or_west, &assign_border,
+                                       directional_twoddwave](const auto& n)
+            {
+                layout.is_clocking_scheme(clock_name::COLUMNAR) ? assign_west(n) :
+                layout.is_clocking_scheme(clock_name::ROW)      ? assign_north(n) :
+                directional_twoddwave                           ? assign_north_or_west(n) :
+                                                                  assign_border(n);
+            };
+
+            const auto assign_output = [this, &assign_east, &assign_south, &assign_south_or_east, &assign_border,
+                                        directional_twoddwave](const auto& n)
+            {
+                layout.is_clocking_scheme(clock_name::COLUMNAR) ? assign_east(n) :
+                layout.is_clocking_scheme(clock_name::ROW)      ? assign_south(n) :
+                directional_twoddwave                           ? assign_south_or_east(n) :
+                                                                  assign_border(n);
+            };
+
             if (params.io_pins)
             {
-                network.foreach_pi(
-                    [this, &assign_north, &assign_west, &assign_border](const auto& pi)
-                    {
-                        layout.is_clocking_scheme(clock_name::COLUMNAR) ? assign_west(pi) :
-                        layout.is_clocking_scheme(clock_name::ROW)      ? assign_north(pi) :
-                                                                          assign_border(pi);
-                    });
-                network.foreach_po(
-                    [this, &assign_east, &assign_south, &assign_border](const auto& po)
-                    {
-                        layout.is_clocking_scheme(clock_name::COLUMNAR) ? assign_east(network.get_node(po)) :
-                        layout.is_clocking_scheme(clock_name::ROW)      ? assign_south(network.get_node(po)) :
-                                                                          assign_border(network.get_node(po));
-                    });
+                network.foreach_pi([&assign_input](const auto& pi) { assign_input(pi); });
+                network.foreach_po([this, &assign_output](const auto& po) { assign_output(network.get_node(po)); });
             }
             else
             {
                 network.foreach_pi(
-                    [this, &assign_north, &assign_west, &assign_border](const auto& pi)
+                    [this, &assign_input](const auto& pi)
                     {
                         network.foreach_fanout(pi,
-                                               [this, &assign_north, &assign_west, &assign_border](const auto& fon)
+                                               [this, &assign_input](const auto& fon)
                                                {
                                                    if (!skip_const_or_io_node(fon))
                                                    {
-                                                       layout.is_clocking_scheme(clock_name::COLUMNAR) ?
-                                                           assign_west(fon) :
-                                                       layout.is_clocking_scheme(clock_name::ROW) ? assign_north(fon) :
-                                                                                                    assign_border(fon);
+                                                       assign_input(fon);
                                                    }
                                                });
                     });
 
                 network.foreach_po(
-                    [this, &assign_east, &assign_south, &assign_border](const auto& po)
+                    [this, &assign_output](const auto& po)
                     {
-                        network.foreach_fanin(
-                            po,
-                            [this, &assign_east, &assign_south, &assign_border](const auto& fi)
-                            {
-                                if (const auto fin = network.get_node(fi); !skip_const_or_io_node(fin))
-                                {
-                                    layout.is_clocking_scheme(clock_name::COLUMNAR) ? assign_east(fin) :
-                                    layout.is_clocking_scheme(clock_name::ROW)      ? assign_south(fin) :
-                                                                                      assign_border(fin);
-                                }
-                            });
+                        network.foreach_fanin(po,
+                                              [this, &assign_output](const auto& fi)
+                                              {
+                                                  if (const auto fin = network.get_node(fi);
+                                                      !skip_const_or_io_node(fin))
+                                                  {
+                                                      assign_output(fin);
+                                                  }
+                                              });
                     });
             }
         }
@@ -2476,68 +2670,122 @@ class exact_impl
             }
         }
         /**
-         * Generates the SMT instance by calling the constraint generating functions.
+         * Calls the given constraint generating function and profiles it if enabled. The time spent, the number of
+         * requested variable expressions, and the number of added assertions and assumptions are accumulated in the
+         * statistics under the given family name.
+         *
+         * @tparam Fn Functor type.
+         * @param family Name of the constraint family.
+         * @param fn Constraint generating function.
+         */
+        template <typename Fn>
+        void profile_constraints(const std::string& family, Fn&& fn)
+        {
+            if (!params.smt_profiling)
+            {
+                std::invoke(std::forward<Fn>(fn));
+
+                return;
+            }
+
+            const auto num_assertions_before  = solver->assertions().size() + check_point->assumptions.size();
+            const auto num_expressions_before = num_expressions;
+
+            mockturtle::stopwatch<>::duration time{0};
+            mockturtle::call_with_stopwatch(time, std::forward<Fn>(fn));
+
+            const auto num_assertions_after = solver->assertions().size() + check_point->assumptions.size();
+
+            std::lock_guard<std::mutex> guard(stats_mutex);
+
+            auto& profile = stats.constraint_profile[family];
+            profile.time += time;
+            profile.num_expressions += num_expressions - num_expressions_before;
+            profile.num_assertions += num_assertions_after - num_assertions_before;
+        }
+        /**
+         * Stores the statistics of the current solver in the statistics object.
+         */
+        void store_solver_statistics()
+        {
+            const auto z3_stats = get_solver_statistics();
+
+            std::map<std::string, double> solver_stats{};
+            for (auto i = 0u; i < z3_stats.size(); ++i)
+            {
+                solver_stats[z3_stats.key(i)] = z3_stats.is_uint(i) ? static_cast<double>(z3_stats.uint_value(i)) :
+                                                                      z3_stats.double_value(i);
+            }
+
+            std::lock_guard<std::mutex> guard(stats_mutex);
+
+            stats.solver_statistics = std::move(solver_stats);
+        }
+        /**
+         * Generates the SMT instance by calling the constraint generating functions. Each constraint family is
+         * profiled if enabled in the parameters.
          */
         void generate_smt_instance()
         {
             // placement constraints
-            restrict_tile_elements();
-            restrict_vertices();
+            profile_constraints("restrict_tile_elements", [this] { restrict_tile_elements(); });
+            profile_constraints("restrict_vertices", [this] { restrict_vertices(); });
 
             // local synchronization constraints
-            define_gate_fanout_tiles();
-            define_gate_fanin_tiles();
-            define_wire_fanout_tiles();
-            define_wire_fanin_tiles();
+            profile_constraints("define_gate_fanout_tiles", [this] { define_gate_fanout_tiles(); });
+            profile_constraints("define_gate_fanin_tiles", [this] { define_gate_fanin_tiles(); });
+            profile_constraints("define_wire_fanout_tiles", [this] { define_wire_fanout_tiles(); });
+            profile_constraints("define_wire_fanin_tiles", [this] { define_wire_fanin_tiles(); });
 
             // global synchronization constraints
             if (!params.desynchronize)
             {
-                assign_pi_clockings();
-                global_synchronization();
+                profile_constraints("assign_pi_clockings", [this] { assign_pi_clockings(); });
+                profile_constraints("global_synchronization", [this] { global_synchronization(); });
             }
 
             // open clocking scheme constraints
             if (!layout.is_regularly_clocked())
             {
-                restrict_clocks();
+                profile_constraints("restrict_clocks", [this] { restrict_clocks(); });
             }
 
             // path/cycle constraints
             if (!is_linear_scheme<Lyt>(layout.get_clocking_scheme()))  // linear schemes; no cycles by definition
             {
-                establish_sub_paths();
-                establish_transitive_paths();
-                eliminate_cycles();
+                profile_constraints("establish_sub_paths", [this] { establish_sub_paths(); });
+                profile_constraints("establish_transitive_paths", [this] { establish_transitive_paths(); });
+                profile_constraints("eliminate_cycles", [this] { eliminate_cycles(); });
             }
 
             // I/O pin constraints
             if (params.border_io)
             {
-                enforce_border_io();
+                profile_constraints("enforce_border_io", [this] { enforce_border_io(); });
             }
 
             // straight inverter constraints
             if (params.straight_inverters)
             {
-                enforce_straight_inverters();
+                profile_constraints("enforce_straight_inverters", [this] { enforce_straight_inverters(); });
             }
 
             // synchronization element constraints
             if (params.synchronization_elements && !params.desynchronize)
             {
-                restrict_synchronization_elements();
+                profile_constraints("restrict_synchronization_elements",
+                                    [this] { restrict_synchronization_elements(); });
             }
 
             // technology-specific constraints
-            technology_specific_constraints();
+            profile_constraints("technology_specific_constraints", [this] { technology_specific_constraints(); });
             // blacklisting constraints
-            black_list_gates();
+            profile_constraints("black_list_gates", [this] { black_list_gates(); });
 
             // symmetry breaking constraints
-            prevent_insufficiencies();
-            define_number_of_connections();
-            utilize_hierarchical_information();
+            profile_constraints("prevent_insufficiencies", [this] { prevent_insufficiencies(); });
+            profile_constraints("define_number_of_connections", [this] { define_number_of_connections(); });
+            profile_constraints("utilize_hierarchical_information", [this] { utilize_hierarchical_information(); });
         }
         /**
          * Creates and returns a z3::optimize if optimization criteria were set by the configuration. The optimize gets
@@ -2795,6 +3043,144 @@ class exact_impl
 
         handler.set_timeout(time_left);
     }
+    /**
+     * Determines a heuristic layout for the given network via the orthogonal physical design algorithm and uses its
+     * dimensions to cap the upper bounds of the exact search. This is only possible for Cartesian layouts that are to
+     * be clocked with 2DDWave. In all other cases, the function does nothing.
+     *
+     * @param src Specification network.
+     */
+    void determine_heuristic_layout(const Ntk& src)
+    {
+        if constexpr (is_cartesian_layout_v<Lyt> && !is_shifted_cartesian_layout_v<Lyt>)
+        {
+            if (!(*ps.scheme == std::string{clock_name::TWODDWAVE}))
+            {
+                return;
+            }
+
+            mockturtle::stopwatch stop{pst.time_total};
+
+            orthogonal_physical_design_params ortho_ps{};
+            ortho_ps.number_of_clock_phases = ps.scheme->num_clocks == 3u ? num_clks::THREE : num_clks::FOUR;
+
+            heuristic_layout = orthogonal<Lyt>(src, ortho_ps);
+
+            // exact's aspect ratios are 0-indexed; the upper bounds are checked exclusively
+            ps.upper_bound_x = static_cast<uint16_t>(
+                std::min(static_cast<uint64_t>(ps.upper_bound_x), static_cast<uint64_t>(heuristic_layout->x()) + 1));
+            ps.upper_bound_y = static_cast<uint16_t>(
+                std::min(static_cast<uint64_t>(ps.upper_bound_y), static_cast<uint64_t>(heuristic_layout->y()) + 1));
+        }
+    }
+    /**
+     * Stores statistical information about the given layout in the statistics object.
+     *
+     * @param layout Resulting layout.
+     */
+    void assign_layout_statistics(const Lyt& layout) const noexcept
+    {
+        pst.x_size    = layout.x() + 1;
+        pst.y_size    = layout.y() + 1;
+        pst.num_gates = layout.num_gates();
+        pst.num_wires = layout.num_wires();
+    }
+    /**
+     * Monitors Z3's estimated memory consumption in a separate thread and calls a given interrupt function once the
+     * configured memory limit is exceeded. The watchdog stays tripped afterward and keeps calling the interrupt
+     * function periodically such that no solver call that is started later can run unbounded. If no memory limit is
+     * configured, no thread is launched.
+     */
+    class memory_watchdog
+    {
+      public:
+        /**
+         * Standard constructor. Launches the monitoring thread.
+         *
+         * @param lim Memory limit in MiB.
+         * @param interrupt Function to call when the memory limit is exceeded.
+         */
+        memory_watchdog(const std::size_t lim, std::function<void()> interrupt) : limit{lim}
+        {
+            if (limit == std::numeric_limits<std::size_t>::max())
+            {
+                return;
+            }
+
+            monitor = std::thread(
+                [this, interrupt = std::move(interrupt)]
+                {
+                    using namespace std::chrono_literals;
+
+                    while (!stop)
+                    {
+                        if (exceeded())
+                        {
+                            interrupt();
+                        }
+
+                        std::this_thread::sleep_for(10ms);
+                    }
+                });
+        }
+        /**
+         * Destructor. Stops the monitoring thread.
+         */
+        ~memory_watchdog()
+        {
+            stop = true;
+
+            if (monitor.joinable())
+            {
+                monitor.join();
+            }
+        }
+
+        memory_watchdog(const memory_watchdog&)            = delete;
+        memory_watchdog& operator=(const memory_watchdog&) = delete;
+        /**
+         * Checks Z3's current memory consumption against the limit and trips the watchdog if it is exceeded.
+         *
+         * @return `true` iff the memory limit is or was exceeded.
+         */
+        [[nodiscard]] bool exceeded() noexcept
+        {
+            if (!tripped && limit != std::numeric_limits<std::size_t>::max() &&
+                Z3_get_estimated_alloc_size() / (1024ull * 1024ull) >= static_cast<uint64_t>(limit))
+            {
+                tripped = true;
+            }
+
+            return tripped;
+        }
+        /**
+         * Returns whether the watchdog has tripped without checking the current memory consumption.
+         *
+         * @return `true` iff the memory limit was exceeded at some point.
+         */
+        [[nodiscard]] bool has_tripped() const noexcept
+        {
+            return tripped;
+        }
+
+      private:
+        /**
+         * Memory limit in MiB.
+         */
+        const std::size_t limit;
+        /**
+         * Flag to signal the monitoring thread to terminate.
+         */
+        std::atomic<bool> stop{false};
+        /**
+         * Flag that indicates that the memory limit was exceeded.
+         */
+        std::atomic<bool> tripped{false};
+        /**
+         * Monitoring thread.
+         */
+        std::thread monitor{};
+    };
     /**
      * Contains a context pointer and a currently worked on aspect ratio and can be shared between multiple worker
      * threads so that they can notify each other via context interrupts based on their individual results, i.e., a
@@ -2820,25 +3206,32 @@ class exact_impl
      *
      * @param t_num Thread's identifier.
      * @param ti_list Pointer to a list of shared thread info that the threads use for communication.
+     * @param watchdog Memory watchdog whose tripping aborts the exploration.
      * @return A found layout or nullptr if being interrupted.
      */
     [[nodiscard]] std::optional<Lyt> explore_asynchronously(const unsigned                                   t_num,
-                                                            const std::shared_ptr<std::vector<thread_info>>& ti_list)
+                                                            const std::shared_ptr<std::vector<thread_info>>& ti_list,
+                                                            memory_watchdog&                                 watchdog)
     {
         const auto ctx = std::make_shared<z3::context>();
 
         Lyt layout{{}, *ps.scheme};
 
-        smt_handler handler{
-            ctx,
-            layout,
-            *ntk,
-            ps,
-        };
-        (*ti_list)[t_num].ctx = ctx;
+        smt_handler handler{ctx, layout, *ntk, ps, pst, pst_mutex};
+
+        {
+            std::lock_guard<std::mutex> guard(ti_mutex);
+            (*ti_list)[t_num].ctx = ctx;
+        }
 
         while (true)
         {
+            // smaller aspect ratios might be left undecided, hence, no further ones are explored
+            if (watchdog.exceeded())
+            {
+                return std::nullopt;
+            }
+
             typename Lyt::aspect_ratio ar;
 
             // mutually exclusive access to the aspect ratio iterator
@@ -2878,7 +3271,10 @@ class exact_impl
             }
 
             // update aspect ratio in the thread_info list and the handler
-            (*ti_list)[t_num].worker_aspect_ratio = ar;
+            {
+                std::lock_guard<std::mutex> guard(ti_mutex);
+                (*ti_list)[t_num].worker_aspect_ratio = ar;
+            }
             handler.update(ar);
 
             try
@@ -2910,11 +3306,15 @@ class exact_impl
                     }
 
                     // interrupt other threads that are working on higher aspect ratios
-                    for (const auto& ti : *ti_list)
                     {
-                        if (area(ar) <= area(ti.worker_aspect_ratio))
+                        std::lock_guard<std::mutex> guard(ti_mutex);
+
+                        for (const auto& ti : *ti_list)
                         {
-                            ti.ctx->interrupt();
+                            if (ti.ctx != nullptr && area(ar) <= area(ti.worker_aspect_ratio))
+                            {
+                                ti.ctx->interrupt();
+                            }
                         }
                     }
 
@@ -2950,6 +3350,8 @@ class exact_impl
 
         Lyt layout{{}, *ps.scheme};
 
+        auto memory_limit_exceeded = false;
+
         {
             mockturtle::stopwatch stop{pst.time_total};
 
@@ -2968,9 +3370,25 @@ class exact_impl
                 "[i] some layout has been found; waiting for threads examining smaller aspect ratios to terminate");
 #endif
 
+            // interrupt all registered worker contexts if the memory limit is exceeded
+            memory_watchdog watchdog{ps.memory_limit,
+                                     [this, &ti_list]
+                                     {
+                                         std::lock_guard<std::mutex> guard(ti_mutex);
+
+                                         for (const auto& ti : *ti_list)
+                                         {
+                                             if (ti.ctx != nullptr)
+                                             {
+                                                 ti.ctx->interrupt();
+                                             }
+                                         }
+                                     }};
+
             for (auto i = 0u; i < ps.num_threads; ++i)
             {
-                fut[i] = std::async(std::launch::async, &exact_impl::explore_asynchronously, this, i, ti_list);
+                fut[i] = std::async(std::launch::async, &exact_impl::explore_asynchronously, this, i, ti_list,
+                                    std::ref(watchdog));
             }
 
             // wait for all tasks to finish running (can be made much prettier in C++20...)
@@ -3011,15 +3429,17 @@ class exact_impl
                     }
                 }
             }
+
+            memory_limit_exceeded = watchdog.has_tripped();
         }
 
+        pst.is_memory_limit_exceeded = memory_limit_exceeded;
+
         if (result_aspect_ratio.has_value())
         {
-            // statistical information
-            pst.x_size    = layout.x() + 1;
-            pst.y_size    = layout.y() + 1;
-            pst.num_gates = layout.num_gates();
-            pst.num_wires = layout.num_wires();
+            // statistical information; if the memory limit was exceeded, smaller aspect ratios might be undecided
+            pst.is_optimal = !memory_limit_exceeded;
+            assign_layout_statistics(layout);
 
             return layout;
         }
@@ -3031,15 +3451,27 @@ class exact_impl
      *
      * @return A placed and routed gate-level layout or std::nullopt in case a timeout or an upper bound was reached.
      */
-    [[nodiscard]] std::optional<Lyt> run_synchronously() noexcept
+    [[nodiscard]] std::optional<Lyt> run_synchronously()
     {
         Lyt layout{{}, *ps.scheme};
 
-        smt_handler handler{std::make_shared<z3::context>(), layout, *ntk, ps};
+        const auto ctx = std::make_shared<z3::context>();
+
+        smt_handler handler{ctx, layout, *ntk, ps, pst, pst_mutex};
+
+        // interrupt the solver if the memory limit is exceeded
+        memory_watchdog watchdog{ps.memory_limit, [&ctx] { ctx->interrupt(); }};
 
         for (; ari <= static_cast<uint64_t>(ps.upper_bound_x) * static_cast<uint64_t>(ps.upper_bound_y);
              ++ari)  // <= to prevent overflow
         {
+            // abort the search since it cannot be continued without exceeding the memory limit
+            if (watchdog.exceeded())
+            {
+                pst.is_memory_limit_exceeded = true;
+
+                return std::nullopt;
+            }
 
 #if (PROGRESS_BARS)
             mockturtle::progress_bar bar("[i] examining layout aspect ratios: {:>2} × {:<2}");
@@ -3069,10 +3501,8 @@ class exact_impl
                 if (sat)
                 {
                     // statistical information
-                    pst.x_size    = layout.x() + 1;
-                    pst.y_size    = layout.y() + 1;
-                    pst.num_gates = layout.num_gates();
-                    pst.num_wires = layout.num_wires();
+                    pst.is_optimal = true;
+                    assign_layout_statistics(layout);
 
                     return layout;
                 }
@@ -3081,8 +3511,10 @@ class exact_impl
 
                 update_timeout(handler, pst.time_total);
             }
-            catch (const z3::exception&)
+            catch (const z3::exception&)  // timed out or interrupted
             {
+                pst.is_memory_limit_exceeded = watchdog.has_tripped();
+
                 return std::nullopt;
             }
         }
@@ -3126,6 +3558,10 @@ class exact_impl
  * and `is_gate_level_layout`, respectively. It is, thereby, mostly technology-independent but can make certain
  * assumptions if needed, for instance for ToPoliNano-compliant circuits.
  *
+ * If `ps.best_effort` is set, a heuristic layout is determined via the orthogonal physical design algorithm first. Its
+ * dimensions cap the explored aspect ratios and it is returned if the exact search fails to find a result within the
+ * given time and memory budget. Statistics report whether the returned layout is proven optimal.
+ *
  * This approach requires the Z3 SMT solver to be installed on the system. Due to this circumstance, it is excluded from
  * (CLI) compilation by default. To enable it, pass `-DFICTION_Z3=ON` to the cmake call.
  *
@@ -3138,7 +3574,7 @@ class exact_impl
  * @param ps Parameters.
  * @param pst Statistics.
  * @return A gate-level layout of type `Lyt` that implements `ntk` as an FCN circuit if one is found under the given
- * parameters; `std::nullopt`, otherwise.
+ * parameters or, in best-effort mode, a heuristic one; `std::nullopt`, otherwise.
  */
 template <typename Lyt, typename Ntk>
 std::optional<Lyt> exact(const Ntk& ntk, const exact_physical_design_params<Lyt>& ps = {},
@@ -80,6 +80,13 @@ template <typename Lyt>
     // instantiate hexagonal layout
     hex_lyt hex_layout{{hex_width, hex_height, hex_depth}, fiction::row_clocking<hex_lyt>()};
 
+    // nodes are collected and committed to the hexagonal layout in a single pass
+    gate_level_layout_builder<hex_lyt> builder{hex_layout};
+    builder.reserve(lyt.num_gates() + lyt.num_wires());
+
+    const auto to_hex_signal = [&layout_height](const auto& cartesian_signal)
+    { return static_cast<mockturtle::signal<hex_lyt>>(detail::to_hex<Lyt, hex_lyt>(cartesian_signal, layout_height)); };
+
     // iterate through cartesian layout diagonally
     for (int64_t k = 0; k < layout_width + layout_height - 1; ++k)
     {
@@ -103,73 +110,70 @@ template <typename Lyt>
 
                     if (lyt.is_pi(node))
                     {
-                        hex_layout.create_pi(lyt.get_name(lyt.get_node(old_coord)), hex);
+                        builder.create_pi(lyt.get_name(lyt.get_node(old_coord)), hex);
                     }
 
                     if (const auto signals = lyt.incoming_data_flow(old_coord); signals.size() == 1)
                     {
-                        const auto signal     = signals[0];
-                        const auto hex_signal = hex_layout.make_signal(
-                            hex_layout.get_node(detail::to_hex<Lyt, hex_lyt>(signal, layout_height)));
+                        const auto hex_signal = to_hex_signal(signals[0]);
 
                         if (lyt.is_po(node))
                         {
-                            hex_layout.create_po(hex_signal, lyt.get_name(lyt.get_node(old_coord)), hex);
+                            builder.create_po(hex_signal, lyt.get_name(lyt.get_node(old_coord)), hex);
                         }
                         else if (lyt.is_wire(node))
                         {
-                            hex_layout.create_buf(hex_signal, hex);
+                            builder.create_buf(hex_signal, hex);
                         }
                         else if (lyt.is_inv(node))
                         {
-                            hex_layout.create_not(hex_signal, hex);
+                            builder.create_not(hex_signal, hex);
                         }
                     }
 
                     else if (signals.size() == 2)
                     {
-                        const auto signal_a     = signals[0];
-                        const auto signal_b     = signals[1];
-                        const auto hex_signal_a = hex_layout.make_signal(
-                            hex_layout.get_node(detail::to_hex<Lyt, hex_lyt>(signal_a, layout_height)));
-                        const auto hex_signal_b = hex_layout.make_signal(
-                            hex_layout.get_node(detail::to_hex<Lyt, hex_lyt>(signal_b, layout_height)));
+                        const auto hex_signal_a = to_hex_signal(signals[0]);
+                        const auto hex_signal_b = to_hex_signal(signals[1]);
 
                         if (lyt.is_and(node))
                         {
-                            hex_layout.create_and(hex_signal_a, hex_signal_b, hex);
+                            builder.create_and(hex_signal_a, hex_signal_b, hex);
                         }
                         else if (lyt.is_nand(node))
                         {
-                            hex_layout.create_nand(hex_signal_a, hex_signal_b, hex);
+                            builder.create_nand(hex_signal_a, hex_signal_b, hex);
                         }
                         else if (lyt.is_or(node))
                         {
-                            hex_layout.create_or(hex_signal_a, hex_signal_b, hex);
+                            builder.create_or(hex_signal_a, hex_signal_b, hex);
                         }
                         else if (lyt.is_nor(node))
                         {
-                            hex_layout.create_nor(hex_signal_a, hex_signal_b, hex);
+                            builder.create_nor(hex_signal_a, hex_signal_b, hex);
                         }
                         else if (lyt.is_xor(node))
                         {
-                            hex_layout.create_xor(hex_signal_a, hex_signal_b, hex);
+                            builder.create_xor(hex_signal_a, hex_signal_b, hex);
                         }
                         else if (lyt.is_xnor(node))
                         {
-                            hex_layout.create_xnor(hex_signal_a, hex_signal_b, hex);
+                            builder.create_xnor(hex_signal_a, hex_signal_b, hex);
                         }
                         else if (lyt.is_function(node))
                         {
                             const auto node_fun = lyt.node_function(node);
 
-                            hex_layout.create_node({hex_signal_a, hex_signal_b}, node_fun, hex);
+                            builder.create_node({hex_signal_a, hex_signal_b}, node_fun, hex);
                         }
                     }
                 }
             }
         }
     }
+
+    builder.finalize();
+
     restore_names<Lyt, hex_lyt>(lyt, hex_layout);
     return hex_layout;
 }
@@ -0,0 +1,881 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_HIERARCHICAL_EXACT_HPP
+#define FICTION_HIERARCHICAL_EXACT_HPP
+
+#if (FICTION_Z3_SOLVER)
+
+#include "fiction/algorithms/network_transformation/network_conversion.hpp"
+#include "fiction/algorithms/path_finding/a_star.hpp"
+#include "fiction/algorithms/path_finding/cost.hpp"
+#include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/algorithms/physical_design/exact.hpp"
+#include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/layouts/obstruction_layout.hpp"
+#include "fiction/networks/technology_network.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/name_utils.hpp"
+#include "fiction/utils/network_utils.hpp"
+#include "fiction/utils/placement_utils.hpp"
+#include "fiction/utils/routing_utils.hpp"
+
+#include <fmt/format.h>
+#include <mockturtle/traits.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+#include <mockturtle/views/fanout_view.hpp>
+#include <mockturtle/views/names_view.hpp>
+#include <mockturtle/views/topo_view.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Parameters for the hierarchical exact physical design algorithm.
+ *
+ * @tparam Lyt Gate-level layout type to create.
+ */
+template <typename Lyt>
+struct hierarchical_exact_params
+{
+    /**
+     * Parameters for the exact placement and routing of each partition. The clocking scheme must be 2DDWave. Border
+     * I/Os at the borders at which information enters and leaves the sub-layouts are always enforced since the
+     * stitching relies on them. Global synchronization is not supported since the wire paths between sub-layouts have
+     * arbitrary lengths such that the overall layout cannot be synchronized anyway. Therefore, `desynchronize` is
+     * enabled by default and must not be disabled.
+     */
+    exact_physical_design_params<Lyt> exact_ps = []
+    {
+        exact_physical_design_params<Lyt> exact_params{};
+        exact_params.desynchronize = true;
+
+        return exact_params;
+    }();
+    /**
+     * Maximum number of gates per partition. Larger partitions yield smaller layouts at the cost of runtime.
+     */
+    uint32_t max_partition_size = 8u;
+    /**
+     * Maximum number of refinement passes that move nodes between neighboring partitions to reduce the cut.
+     */
+    uint32_t refinement_passes = 4u;
+    /**
+     * Number of partitions to place simultaneously. Each one is handled by its own exact instance with dedicated Z3
+     * contexts.
+     */
+    std::size_t num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    /**
+     * Number of empty rows and columns to leave between sub-layouts for wiring. If the stitching fails, it is repeated
+     * with an increasing gap up to `stitching_attempts` times.
+     */
+    uint16_t routing_gap = 1u;
+    /**
+     * Number of attempts to stitch the sub-layouts together.
+     */
+    uint16_t stitching_attempts = 3u;
+};
+/**
+ * Statistics.
+ */
+struct hierarchical_exact_stats
+{
+    mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Runtime of the individual phases.
+     */
+    mockturtle::stopwatch<>::duration time_partitioning{0}, time_placement{0}, time_stitching{0};
+
+    uint64_t x_size{0ull}, y_size{0ull};
+    uint64_t num_gates{0ull}, num_wires{0ull};
+    /**
+     * Number of partitions the network was divided into.
+     */
+    std::size_t num_partitions{0ul};
+    /**
+     * Number of signal connections between partitions, i.e., the number of wire paths created during stitching.
+     */
+    std::size_t cut_size{0ul};
+    /**
+     * Statistics of the exact runs on the individual partitions.
+     */
+    std::vector<exact_physical_design_stats> partition_stats{};
+
+    void report(std::ostream& out = std::cout) const
+    {
+        out << fmt::format("[i] total time  = {:.2f} secs\n", mockturtle::to_seconds(time_total));
+        out << fmt::format("[i] partitions  = {}\n", num_partitions);
+        out << fmt::format("[i] cut size    = {}\n", cut_size);
+        out << fmt::format("[i] layout size = {} × {}\n", x_size, y_size);
+        out << fmt::format("[i] num. gates  = {}\n", num_gates);
+        out << fmt::format("[i] num. wires  = {}\n", num_wires);
+    }
+};
+
+namespace detail
+{
+
+template <typename Lyt, typename Ntk>
+class hierarchical_exact_impl
+{
+  public:
+    hierarchical_exact_impl(const Ntk& src, const hierarchical_exact_params<Lyt>& p, hierarchical_exact_stats& st) :
+            network{mockturtle::fanout_view{convert_network<mockturtle::names_view<technology_network>>(src)}},
+            ps{p},
+            pst{st}
+    {
+        // the stitching relies on I/Os being located at the sub-layouts' borders at which they can be reached
+        ps.exact_ps.border_io             = true;
+        ps.exact_ps.directional_border_io = true;
+    }
+
+    std::optional<Lyt> run()
+    {
+        mockturtle::stopwatch stop{pst.time_total};
+
+        {
+            mockturtle::stopwatch stop_partitioning{pst.time_partitioning};
+
+            partition();
+            refine();
+            assign_inputs();
+            determine_cut();
+            create_subnetworks();
+        }
+
+        pst.num_partitions = partitions.size();
+        pst.cut_size       = cut.size();
+
+        {
+            mockturtle::stopwatch stop_placement{pst.time_placement};
+
+            if (!place_partitions())
+            {
+                return std::nullopt;
+            }
+        }
+
+        mockturtle::stopwatch stop_stitching{pst.time_stitching};
+
+        for (uint16_t attempt = 0u; attempt < std::max(ps.stitching_attempts, uint16_t{1}); ++attempt)
+        {
+            if (auto layout = stitch(static_cast<uint16_t>(ps.routing_gap + attempt)); layout.has_value())
+            {
+                pst.x_size    = layout->x() + 1;
+                pst.y_size    = layout->y() + 1;
+                pst.num_gates = layout->num_gates();
+                pst.num_wires = layout->num_wires();
+
+                return layout;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+  private:
+    /**
+     * Network type for internal handling.
+     */
+    using topology_ntk_t = mockturtle::topo_view<mockturtle::fanout_view<mockturtle::names_view<technology_network>>>;
+    /**
+     * Network type of the partitions.
+     */
+    using partition_ntk_t = mockturtle::names_view<technology_network>;
+    /**
+     * A signal connection between two partitions, i.e., a driver node in one partition that is consumed by at least one
+     * node of another one.
+     */
+    struct cut_connection
+    {
+        /**
+         * Driving node in the network.
+         */
+        mockturtle::node<topology_ntk_t> driver;
+        /**
+         * Index of the consuming partition.
+         */
+        uint32_t consumer;
+    };
+    /**
+     * Describes a PI or PO of a partition either as a primary I/O of the network or as a cut connection.
+     */
+    struct io_descriptor
+    {
+        /**
+         * `true` iff the I/O represents a cut connection.
+         */
+        bool is_cut;
+        /**
+         * Index of the network's PI/PO or of the cut connection, respectively.
+         */
+        std::size_t index;
+    };
+    /**
+     * A partition of the network together with its placed and routed sub-layout.
+     */
+    struct network_partition
+    {
+        partition_ntk_t ntk{};
+
+        std::vector<io_descriptor> inputs{}, outputs{};
+
+        std::optional<Lyt> layout{};
+    };
+
+    /**
+     * The network to place and route in topological order.
+     */
+    const topology_ntk_t network;
+    /**
+     * Parameters.
+     */
+    hierarchical_exact_params<Lyt> ps;
+    /**
+     * Statistics.
+     */
+    hierarchical_exact_stats& pst;
+    /**
+     * Partition index of each network node.
+     */
+    std::vector<uint32_t> partition_of = std::vector<uint32_t>(network.size(), 0u);
+    /**
+     * Number of gates assigned to each partition.
+     */
+    std::vector<uint32_t> partition_sizes{};
+    /**
+     * All connections between partitions.
+     */
+    std::vector<cut_connection> cut{};
+    /**
+     * The partitions.
+     */
+    std::vector<network_partition> partitions{};
+
+    [[nodiscard]] uint32_t& part(const mockturtle::node<topology_ntk_t>& n) noexcept
+    {
+        return partition_of[network.node_to_index(n)];
+    }
+
+    [[nodiscard]] uint32_t part(const mockturtle::node<topology_ntk_t>& n) const noexcept
+    {
+        return partition_of[network.node_to_index(n)];
+    }
+    /**
+     * Divides the gates into chunks of at most `max_partition_size` nodes along the topological order. Thereby, every
+     * connection leads from a partition to itself or to one with a higher index.
+     */
+    void partition()
+    {
+        const auto max_size = std::max(ps.max_partition_size, 1u);
+
+        uint32_t gate_counter = 0u;
+        network.foreach_gate([this, &gate_counter, max_size](const auto& g) { part(g) = gate_counter++ / max_size; });
+
+        partition_sizes.assign(std::max((gate_counter + max_size - 1) / max_size, 1u), 0u);
+        network.foreach_gate([this](const auto& g) { ++partition_sizes[part(g)]; });
+    }
+    /**
+     * Computes the number of partitions apart from the driver's own one that consume the signal of node `d`. Primary
+     * inputs are accounted for as if they were placed in the partition of their first consumer.
+     *
+     * @param d Driver node.
+     * @return Number of cut connections that are caused by `d`.
+     */
+    [[nodiscard]] std::size_t cut_cost(const mockturtle::node<topology_ntk_t>& d) const noexcept
+    {
+        std::vector<uint32_t> consumers{};
+        network.foreach_fanout(d, [this, &consumers](const auto& fo) { consumers.push_back(part(fo)); });
+
+        std::sort(consumers.begin(), consumers.end());
+        consumers.erase(std::unique(consumers.begin(), consumers.end()), consumers.cend());
+
+        if (network.is_pi(d))
+        {
+            return consumers.empty() ? 0ul : consumers.size() - 1;
+        }
+
+        return static_cast<std::size_t>(
+            std::count_if(consumers.cbegin(), consumers.cend(), [this, &d](const auto c) { return c != part(d); }));
+    }
+    /**
+     * Checks whether gate `g` can be moved to partition `target` without creating a connection that leads from a
+     * partition to one with a lower index.
+     *
+     * @param g Gate to move.
+     * @param target Partition to move `g` to.
+     * @return `true` iff the move preserves the partition order.
+     */
+    [[nodiscard]] bool is_legal_move(const mockturtle::node<topology_ntk_t>& g, const uint32_t target) const noexcept
+    {
+        bool legal = true;
+
+        if (target < part(g))
+        {
+            network.foreach_fanin(g,
+                                  [this, &legal, target](const auto& f)
+                                  {
+                                      if (const auto fn = network.get_node(f);
+                                          network.is_constant(fn) || network.is_pi(fn) || part(fn) <= target)
+                                      {
+                                          return true;
+                                      }
+
+                                      legal = false;
+                                      return false;
+                                  });
+        }
+        else
+        {
+            network.foreach_fanout(g,
+                                   [this, &legal, target](const auto& fo)
+                                   {
+                                       if (part(fo) >= target)
+                                       {
+                                           return true;
+                                       }
+
+                                       legal = false;
+                                       return false;
+                                   });
+        }
+
+        return legal;
+    }
+    /**
+     * Greedily moves gates to neighboring partitions whenever this reduces the number of cut connections, similar to
+     * a single-node Fiduccia-Mattheyses refinement that respects the partition size bound and order.
+     */
+    void refine()
+    {
+        const auto max_size = std::max(ps.max_partition_size, 1u);
+
+        for (auto pass = 0u; pass < ps.refinement_passes; ++pass)
+        {
+            bool improved = false;
+
+            network.foreach_gate(
+                [this, &improved, max_size](const auto& g)
+                {
+                    const auto current = part(g);
+
+                    if (partition_sizes[current] <= 1)
+                    {
+                        return;
+                    }
+
+                    // all drivers whose cut cost is affected by moving g
+                    std::vector<mockturtle::node<topology_ntk_t>> drivers{g};
+                    network.foreach_fanin(g,
+                                          [this, &drivers](const auto& f)
+                                          {
+                                              if (const auto fn = network.get_node(f); !network.is_constant(fn))
+                                              {
+                                                  drivers.push_back(fn);
+                                              }
+                                          });
+                    std::sort(drivers.begin(), drivers.end());
+                    drivers.erase(std::unique(drivers.begin(), drivers.end()), drivers.cend());
+
+                    const auto cost = [this, &drivers]
+                    {
+                        std::size_t c = 0ul;
+                        for (const auto& d : drivers)
+                        {
+                            c += cut_cost(d);
+                        }
+                        return c;
+                    };
+
+                    const auto before      = cost();
+                    auto       best_cost   = before;
+                    auto       best_target = current;
+
+                    for (const auto target : {current - 1, current + 1})
+                    {
+                        // unsigned underflow of current - 1 is caught by this check as well
+                        if (target >= partition_sizes.size() || partition_sizes[target] >= max_size ||
+                            !is_legal_move(g, target))
+                        {
+                            continue;
+                        }
+
+                        part(g) = target;
+                        if (const auto after = cost(); after < best_cost)
+                        {
+                            best_cost   = after;
+                            best_target = target;
+                        }
+                        part(g) = current;
+                    }
+
+                    if (best_target != current)
+                    {
+                        part(g) = best_target;
+                        --partition_sizes[current];
+                        ++partition_sizes[best_target];
+
+                        improved = true;
+                    }
+                });
+
+            if (!improved)
+            {
+                break;
+            }
+        }
+    }
+    /**
+     * Assigns each primary input to the partition of its first consumer.
+     */
+    void assign_inputs()
+    {
+        network.foreach_pi(
+            [this](const auto& pi)
+            {
+                auto first = static_cast<uint32_t>(partition_sizes.size() - 1);
+                bool used  = false;
+
+                network.foreach_fanout(pi,
+                                       [this, &first, &used](const auto& fo)
+                                       {
+                                           first = std::min(first, part(fo));
+                                           used  = true;
+                                       });
+
+                part(pi) = used ? first : 0u;
+            });
+    }
+    /**
+     * Collects all connections between partitions in topological order of their drivers.
+     */
+    void determine_cut()
+    {
+        network.foreach_node(
+            [this](const auto& n)
+            {
+                if (network.is_constant(n))
+                {
+                    return;
+                }
+
+                std::vector<uint32_t> consumers{};
+                network.foreach_fanout(n, [this, &consumers](const auto& fo) { consumers.push_back(part(fo)); });
+
+                std::sort(consumers.begin(), consumers.end());
+                consumers.erase(std::unique(consumers.begin(), consumers.end()), consumers.cend());
+
+                for (const auto c : consumers)
+                {
+                    if (c != part(n))
+                    {
+                        cut.push_back({n, c});
+                    }
+                }
+            });
+    }
+    /**
+     * Extracts the subnetwork of each partition. Cut connections are represented by an additional PO in the driving
+     * partition and an additional PI in the consuming one.
+     */
+    void create_subnetworks()
+    {
+        partitions.resize(partition_sizes.size());
+
+        for (uint32_t p = 0u; p < partitions.size(); ++p)
+        {
+            auto& partition = partitions[p];
+
+            std::unordered_map<mockturtle::node<topology_ntk_t>, mockturtle::signal<partition_ntk_t>> old2new{};
+
+            network.foreach_pi(
+                [this, &partition, &old2new, p](const auto& pi, const auto i)
+                {
+                    if (part(pi) == p)
+                    {
+                        const auto s = network.make_signal(pi);
+                        old2new[pi]  = partition.ntk.create_pi(network.has_name(s) ? network.get_name(s) : "");
+                        partition.inputs.push_back({false, i});
+                    }
+                });
+
+            for (std::size_t c = 0ul; c < cut.size(); ++c)
+            {
+                if (cut[c].consumer == p)
+                {
+                    old2new[cut[c].driver] = partition.ntk.create_pi(fmt::format("cut{}", c));
+                    partition.inputs.push_back({true, c});
+                }
+            }
+
+            network.foreach_gate(
+                [this, &partition, &old2new, p](const auto& g)
+                {
+                    if (part(g) != p)
+                    {
+                        return;
+                    }
+
+                    std::vector<mockturtle::signal<partition_ntk_t>> children{};
+                    network.foreach_fanin(g,
+                                          [this, &partition, &old2new, &children](const auto& f)
+                                          {
+                                              const auto fn = network.get_node(f);
+                                              children.push_back(
+                                                  network.is_constant(fn) ?
+                                                      partition.ntk.get_constant(network.constant_value(fn)) :
+                                                      old2new.at(fn));
+                                          });
+
+                    old2new[g] = partition.ntk.clone_node(network, g, children);
+                });
+
+            network.foreach_po(
+                [this, &partition, &old2new, p](const auto& po, const auto i)
+                {
+                    const auto d = network.get_node(po);
+
+                    if ((network.is_constant(d) ? 0u : part(d)) == p)
+                    {
+                        partition.ntk.create_po(network.is_constant(d) ?
+                                                    partition.ntk.get_constant(network.constant_value(d)) :
+                                                    old2new.at(d),
+                                                network.has_output_name(i) ? network.get_output_name(i) : "");
+                        partition.outputs.push_back({false, i});
+                    }
+                });
+
+            for (std::size_t c = 0ul; c < cut.size(); ++c)
+            {
+                if (part(cut[c].driver) == p)
+                {
+                    partition.ntk.create_po(old2new.at(cut[c].driver), fmt::format("cut{}", c));
+                    partition.outputs.push_back({true, c});
+                }
+            }
+        }
+    }
+    /**
+     * Places and routes all partitions via exact. Partitions are distributed among the worker threads dynamically.
+     *
+     * @return `true` iff all partitions could be placed and routed.
+     */
+    bool place_partitions()
+    {
+        pst.partition_stats.resize(partitions.size());
+
+        std::atomic<std::size_t> next_partition{0ul};
+
+        const auto worker = [this, &next_partition]
+        {
+            for (auto p = next_partition++; p < partitions.size(); p = next_partition++)
+            {
+                partitions[p].layout = exact<Lyt>(partitions[p].ntk, ps.exact_ps, &pst.partition_stats[p]);
+            }
+        };
+
+        std::vector<std::thread> workers{};
+        const auto num_workers = std::clamp(ps.num_threads, std::size_t{1}, partitions.size());
+        workers.reserve(num_workers);
+
+        for (std::size_t i = 0ul; i < num_workers; ++i)
+        {
+            workers.emplace_back(worker);
+        }
+        for (auto& w : workers)
+        {
+            w.join();
+        }
+
+        return std::all_of(partitions.cbegin(), partitions.cend(), [](const auto& p) { return p.layout.has_value(); });
+    }
+    /**
+     * Arranges the sub-layouts diagonally such that all connections between partitions lead eastwards and southwards
+     * and routes them via A* search. Since exact places the inputs of each sub-layout at its northern or western border
+     * and its outputs at its southern or eastern border under 2DDWave clocking, all of them are adjacent to the routing
+     * gap. Primary inputs and outputs are recreated in their original order.
+     *
+     * @param gap Number of empty rows and columns between sub-layouts.
+     * @return The stitched layout or `std::nullopt` if some connection could not be routed.
+     */
+    std::optional<Lyt> stitch(const uint16_t gap)
+    {
+        const auto num_clocks = static_cast<uint64_t>(ps.exact_ps.scheme->num_clocks);
+
+        // offsets are chosen such that the sub-layouts' clock numbers are preserved
+        std::vector<std::pair<uint64_t, uint64_t>> offsets{};
+        offsets.reserve(partitions.size());
+
+        uint64_t ox = 0ull, oy = 0ull;
+        for (const auto& p : partitions)
+        {
+            while ((ox + oy) % num_clocks != 0)
+            {
+                ++ox;
+            }
+
+            offsets.emplace_back(ox, oy);
+
+            ox += p.layout->x() + 1 + gap;
+            oy += p.layout->y() + 1 + gap;
+        }
+
+        const auto shift = [&offsets](const tile<Lyt>& t, const std::size_t p)
+        {
+            return tile<Lyt>{static_cast<uint64_t>(t.x) + offsets[p].first,
+                             static_cast<uint64_t>(t.y) + offsets[p].second, t.z};
+        };
+
+        Lyt layout{{offsets.back().first + partitions.back().layout->x(),
+                    offsets.back().second + partitions.back().layout->y(), 1},
+                   *ps.exact_ps.scheme,
+                   get_name(network)};
+
+        // shares its storage with layout
+        obstruction_layout<Lyt> obstr{layout};
+
+        // reserve future positions of all sub-layouts
+        for (std::size_t p = 0ul; p < partitions.size(); ++p)
+        {
+            const auto& sub = *partitions[p].layout;
+            sub.foreach_node(
+                [&sub, &obstr, &shift, p](const auto& n)
+                {
+                    if (!sub.is_constant(n))
+                    {
+                        obstr.obstruct_coordinate(shift(sub.get_tile(n), p));
+                    }
+                });
+        }
+
+        const auto pis = reserve_input_nodes(layout, network);
+
+        std::vector<tile<Lyt>>                                                          cut_sources(cut.size());
+        std::vector<std::optional<std::pair<mockturtle::signal<Lyt>, tile<Lyt>>>> pos(network.num_pos());
+
+        a_star_params astar_ps{};
+        astar_ps.crossings = ps.exact_ps.crossings;
+
+        for (std::size_t p = 0ul; p < partitions.size(); ++p)
+        {
+            const auto& partition = partitions[p];
+            const auto& sub       = *partition.layout;
+
+            std::unordered_map<mockturtle::node<Lyt>, std::size_t> pi_index{};
+            sub.foreach_pi([&pi_index](const auto& pi, const auto i) { pi_index[pi] = i; });
+
+            std::unordered_map<mockturtle::signal<Lyt>, std::size_t> po_index{};
+            sub.foreach_po([&po_index](const auto& po, const auto i) { po_index[po] = i; });
+
+            // route all connections that are incoming to this partition to its input tiles
+            bool routed = true;
+            sub.foreach_pi(
+                [&](const auto& pi, const auto i)
+                {
+                    const auto& desc = partition.inputs[i];
+                    if (!desc.is_cut)
+                    {
+                        return true;
+                    }
+
+                    const auto src = cut_sources[desc.index];
+                    const auto tgt = shift(sub.get_tile(pi), p);
+
+                    const auto path = a_star<layout_coordinate_path<obstruction_layout<Lyt>>>(
+                        obstr, {src, tgt}, manhattan_distance_fn<uint64_t>{}, unit_cost_fn<uint8_t>{}, astar_ps);
+
+                    if (path.empty())
+                    {
+                        routed = false;
+                        return false;
+                    }
+
+                    // the target is populated as well since the partition's nodes will be connected to it
+                    auto incoming_signal = static_cast<mockturtle::signal<Lyt>>(src);
+                    std::for_each(path.cbegin() + 1, path.cend(),
+                                  [&layout, &incoming_signal](const auto& coord)
+                                  {
+                                      incoming_signal = layout.create_buf(
+                                          incoming_signal, layout.is_empty_tile(coord) ? coord : layout.above(coord));
+                                  });
+
+                    return true;
+                });
+
+            if (!routed)
+            {
+                return std::nullopt;
+            }
+
+            // copy the sub-layout along its anti-diagonals such that all fanins are present before their fanouts
+            const auto width = static_cast<uint64_t>(sub.x()) + 1, height = static_cast<uint64_t>(sub.y()) + 1;
+
+            for (uint64_t k = 0ull; k < width + height - 1; ++k)
+            {
+                for (uint64_t x = 0ull; x <= std::min(k, width - 1); ++x)
+                {
+                    const auto y = k - x;
+                    if (y >= height)
+                    {
+                        continue;
+                    }
+
+                    for (uint64_t z = 0ull; z <= sub.z(); ++z)
+                    {
+                        const tile<Lyt> st{x, y, z};
+
+                        if (sub.is_empty_tile(st))
+                        {
+                            continue;
+                        }
+
+                        const auto n = sub.get_node(st);
+                        const auto t = shift(st, p);
+
+                        if (sub.is_pi(n))
+                        {
+                            // cut inputs have been routed already
+                            if (const auto& desc = partition.inputs[pi_index.at(n)]; !desc.is_cut)
+                            {
+                                layout.move_node(pis[network.pi_at(static_cast<uint32_t>(desc.index))], t);
+                            }
+
+                            obstr.clear_obstructed_coordinate(t);
+                            continue;
+                        }
+
+                        std::vector<mockturtle::signal<Lyt>> children{};
+                        for (const auto& fi : sub.incoming_data_flow(st))
+                        {
+                            children.push_back(static_cast<mockturtle::signal<Lyt>>(shift(fi, p)));
+                        }
+
+                        if (sub.is_po(n))
+                        {
+                            const auto& desc = partition.outputs[po_index.at(static_cast<mockturtle::signal<Lyt>>(st))];
+
+                            if (desc.is_cut)
+                            {
+                                layout.create_buf(children.front(), t);
+                                cut_sources[desc.index] = t;
+                            }
+                            else
+                            {
+                                // primary outputs are created in the end to preserve their order; their tiles stay
+                                // obstructed until then
+                                pos[desc.index] = {children.front(), t};
+                                continue;
+                            }
+                        }
+                        else if (sub.is_wire(n))
+                        {
+                            layout.create_buf(children.front(), t);
+                        }
+                        else
+                        {
+                            layout.create_node(children, sub.node_function(n), t);
+                        }
+
+                        obstr.clear_obstructed_coordinate(t);
+                    }
+                }
+            }
+        }
+
+        for (uint32_t i = 0u; i < pos.size(); ++i)
+        {
+            if (pos[i].has_value())
+            {
+                layout.create_po(pos[i]->first, network.has_output_name(i) ? network.get_output_name(i) : "",
+                                 pos[i]->second);
+            }
+        }
+
+        return layout;
+    }
+};
+
+}  // namespace detail
+
+/**
+ * A divide-and-conquer variant of the exact physical design algorithm for networks that are too large to be handled by
+ * `exact` as a whole.
+ *
+ * The given network is divided into partitions of at most `ps.max_partition_size` gates. To this end, the gates are
+ * first chunked along a topological order such that all connections lead from a partition to itself or to one with a
+ * higher index. Afterward, gates are greedily moved between neighboring partitions to minimize the number of
+ * connections that cross partition boundaries. Each partition is then turned into a subnetwork whose cut connections
+ * are represented by additional PIs and POs. All subnetworks are placed and routed via `exact` in parallel, where each
+ * instance uses its own Z3 contexts.
+ *
+ * Finally, the sub-layouts are arranged diagonally in partition order with a routing gap in between and the cut
+ * connections are wired via A* search. Since the diagonal arrangement guarantees that every connection leads
+ * eastwards and southwards, the result is valid under 2DDWave clocking, which is, thus, required. Since these wire
+ * paths have arbitrary lengths, the overall layout cannot be globally synchronized. Therefore, the partitions have to
+ * be placed with `desynchronize` enabled, which is the default. Each sub-layout is optimal under these parameters, but
+ * the overall layout is not.
+ *
+ * If the clocking scheme is not 2DDWave or `desynchronize` is disabled, no layout is returned.
+ *
+ * May throw a high_degree_fanin_exception if `ntk` contains any node with a fan-in too large to be handled by the
+ * specified clocking scheme.
+ *
+ * @tparam Lyt Desired Cartesian gate-level layout type.
+ * @tparam Ntk Network type that acts as specification.
+ * @param ntk The network that is to place and route.
+ * @param ps Parameters.
+ * @param pst Statistics.
+ * @return A gate-level layout of type `Lyt` that implements `ntk` as an FCN circuit if all partitions could be placed
+ * and connected under the given parameters; `std::nullopt`, otherwise.
+ */
+template <typename Lyt, typename Ntk>
+std::optional<Lyt> hierarchical_exact(const Ntk& ntk, const hierarchical_exact_params<Lyt>& ps = {},
+                                      hierarchical_exact_stats* pst = nullptr)
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+    static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
+    static_assert(!is_shifted_cartesian_layout_v<Lyt>, "Lyt must not be a shifted Cartesian layout");
+    static_assert(mockturtle::is_network_type_v<Ntk>, "Ntk is not a network type");
+
+    // stitching paths have arbitrary lengths, which renders global synchronization of the sub-layouts pointless
+    if (!(*ps.exact_ps.scheme == std::string{clock_name::TWODDWAVE}) || !ps.exact_ps.desynchronize)
+    {
+        return std::nullopt;
+    }
+
+    // check for input degree
+    if (has_high_degree_fanin_nodes(ntk, ps.exact_ps.scheme->max_in_degree))
+    {
+        throw high_degree_fanin_exception();
+    }
+
+    hierarchical_exact_stats                  st{};
+    detail::hierarchical_exact_impl<Lyt, Ntk> p{ntk, ps, st};
+
+    auto result = p.run();
+
+    if (pst)
+    {
+        *pst = st;
+    }
+
+    return result;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_Z3_SOLVER
+
+#endif  // FICTION_HIERARCHICAL_EXACT_HPP
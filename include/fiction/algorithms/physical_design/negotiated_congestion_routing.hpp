@@ -0,0 +1,675 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_NEGOTIATED_CONGESTION_ROUTING_HPP
+#define FICTION_NEGOTIATED_CONGESTION_ROUTING_HPP
+
+#include "fiction/algorithms/path_finding/a_star.hpp"
+#include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/layouts/obstruction_layout.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/routing_utils.hpp"
+
+#include <fmt/format.h>
+#include <mockturtle/utils/stopwatch.hpp>
+#include <phmap.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Parameters for the negotiated congestion routing algorithm.
+ */
+struct negotiated_congestion_routing_params
+{
+    /**
+     * Do not abort if some objectives cannot be fulfilled, but partially route the layout as much as possible.
+     */
+    bool conduct_partial_routing = false;
+    /**
+     * Enable crossings.
+     */
+    bool crossings = false;
+    /**
+     * Maximum number of rip-up and reroute iterations.
+     */
+    uint32_t max_iterations = 50ul;
+    /**
+     * Initial weight of the present congestion, i.e., of the overuse that would be caused by routing through an
+     * already occupied coordinate.
+     */
+    double initial_present_factor = 0.5;
+    /**
+     * Factor by which the weight of the present congestion is multiplied after each iteration.
+     */
+    double present_factor_multiplier = 1.5;
+    /**
+     * Weight by which the overuse of a coordinate is added to its history congestion after each iteration.
+     */
+    double history_factor = 1.0;
+    /**
+     * Number of objectives that are rerouted concurrently. If set to 1, objectives are rerouted one after another as in
+     * the original PathFinder algorithm.
+     */
+    uint32_t num_threads = 1ul;
+};
+/**
+ * Statistics of the negotiated congestion routing algorithm.
+ */
+struct negotiated_congestion_routing_stats
+{
+    /**
+     * Statistics of a single rip-up and reroute iteration.
+     */
+    struct iteration_stats
+    {
+        /**
+         * Number of objectives that were (re-)routed in the iteration.
+         */
+        std::size_t num_rerouted_objectives{0};
+        /**
+         * Number of coordinates and, if crossings are enabled, connections that are used by more paths than they can
+         * host after the iteration.
+         */
+        std::size_t num_overused_resources{0};
+        /**
+         * Sum of the excess path counts over all overused resources after the iteration.
+         */
+        uint64_t total_overuse{0ull};
+    };
+    /**
+     * Runtime measurement.
+     */
+    mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Statistics of all conducted iterations in order.
+     */
+    std::vector<iteration_stats> iterations{};
+    /**
+     * For each routing objective that could not be fulfilled, this counter is incremented.
+     */
+    std::size_t number_of_unsatisfied_objectives{0};
+
+    void report(std::ostream& out = std::cout) const
+    {
+        out << fmt::format("[i] total time                 = {:.2f} secs\n", mockturtle::to_seconds(time_total));
+        out << fmt::format("[i] iterations                 = {}\n", iterations.size());
+
+        for (std::size_t i = 0; i < iterations.size(); ++i)
+        {
+            out << fmt::format("[i] iteration {:>4}: rerouted = {:>6}, overused = {:>6}, overuse = {:>6}\n", i + 1,
+                               iterations[i].num_rerouted_objectives, iterations[i].num_overused_resources,
+                               iterations[i].total_overuse);
+        }
+
+        out << fmt::format("[i] unsatisfied objectives     = {}\n", number_of_unsatisfied_objectives);
+    }
+};
+
+namespace detail
+{
+
+template <typename Lyt>
+class negotiated_congestion_routing_impl
+{
+  public:
+    negotiated_congestion_routing_impl(Lyt& lyt, const std::vector<routing_objective<Lyt>>& obj,
+                                       const negotiated_congestion_routing_params& p,
+                                       negotiated_congestion_routing_stats&        st) :
+            layout{lyt},
+            obstruction_lyt{lyt},
+            objectives{obj},
+            ps{p},
+            pst{st},
+            paths(objectives.size()),
+            unroutable(objectives.size(), false)
+    {}
+
+    bool run()
+    {
+        // measure runtime
+        mockturtle::stopwatch stop{pst.time_total};
+
+        initialize_resources();
+
+        std::vector<std::size_t> pending(objectives.size());
+        std::iota(pending.begin(), pending.end(), std::size_t{0});
+
+        present_factor = ps.initial_present_factor;
+
+        for (uint32_t i = 0; i < ps.max_iterations; ++i)
+        {
+            reroute(pending);
+
+            // if no partial routing is allowed, abort if some objectives cannot be routed even when ignoring congestion
+            if (!ps.conduct_partial_routing &&
+                std::find(unroutable.cbegin(), unroutable.cend(), true) != unroutable.cend())
+            {
+                pst.number_of_unsatisfied_objectives = objectives.size();
+
+                return false;
+            }
+
+            if (update_history(pending.size()) == 0)
+            {
+                conduct_routing();
+
+                return true;
+            }
+
+            pending = congested_objectives();
+
+            present_factor *= ps.present_factor_multiplier;
+        }
+
+        // negotiation did not converge
+        if (!ps.conduct_partial_routing)
+        {
+            pst.number_of_unsatisfied_objectives = objectives.size();
+
+            return false;
+        }
+
+        conduct_partial_routing();
+
+        return true;
+    }
+
+  private:
+    /**
+     * Path type.
+     */
+    using path = layout_coordinate_path<Lyt>;
+    /**
+     * A routing resource, i.e., a coordinate or a connection between two coordinates, that can host a limited number of
+     * paths.
+     */
+    struct resource
+    {
+        /**
+         * Number of paths that currently use the resource.
+         */
+        uint32_t occupancy{0ul};
+        /**
+         * Number of paths that can use the resource simultaneously.
+         */
+        uint32_t capacity{1ul};
+        /**
+         * Accumulated overuse of previous iterations.
+         */
+        double history{0.0};
+    };
+    /**
+     * The layout to route.
+     */
+    Lyt& layout;
+    /**
+     * The layout to route with an obstruction interface that marks all populated coordinates as obstructed.
+     */
+    const obstruction_layout<Lyt> obstruction_lyt;
+    /**
+     * The routing objectives.
+     */
+    const std::vector<routing_objective<Lyt>> objectives;
+    /**
+     * Parameters.
+     */
+    const negotiated_congestion_routing_params ps;
+    /**
+     * Statistics.
+     */
+    negotiated_congestion_routing_stats& pst;
+    /**
+     * Dense indices of all layout coordinates, which are used to address the coordinate resources.
+     */
+    dense_coordinate_index<Lyt> coordinate_index{layout};
+    /**
+     * Resources of all coordinates indexed by coordinate_index.
+     */
+    std::vector<resource> coordinate_resources{};
+    /**
+     * Resources of all connections that have been used thus far indexed by pairs of coordinate indices. Connections
+     * are only considered resources of their own if crossings are enabled. Otherwise, two paths cannot share a
+     * connection without sharing a coordinate.
+     */
+    phmap::flat_hash_map<std::pair<std::size_t, std::size_t>, resource> connection_resources{};
+    /**
+     * Current path of each objective. Paths are empty if the objective has not been routed yet.
+     */
+    std::vector<path> paths;
+    /**
+     * Flags that indicate which objectives cannot be routed at all, i.e., not even when ignoring congestion.
+     */
+    std::vector<bool> unroutable;
+    /**
+     * Current weight of the present congestion.
+     */
+    double present_factor{0.0};
+    /**
+     * Indexes all coordinates and determines their capacities. If crossings are enabled, each ground coordinate whose
+     * crossing layer is free can host two paths that cross each other. The second one will be lifted to the crossing
+     * layer when the paths are applied to the layout.
+     */
+    void initialize_resources()
+    {
+        layout.foreach_coordinate([this](const auto& c) { static_cast<void>(coordinate_index(c)); });
+
+        coordinate_resources.assign(coordinate_index.size(), resource{});
+
+        if (!ps.crossings)
+        {
+            return;
+        }
+
+        layout.foreach_ground_coordinate(
+            [this](const auto& c)
+            {
+                if (const auto above = layout.above(c); above != c && !obstruction_lyt.is_obstructed_coordinate(above))
+                {
+                    coordinate_resources[coordinate_index.at(c)].capacity = 2ul;
+                }
+            });
+    }
+    /**
+     * Computes the PathFinder cost factor of using the given resource once more, i.e., its history congestion
+     * multiplied with the overuse that would be caused.
+     *
+     * @param r Resource to use.
+     * @return Cost factor of using `r`.
+     */
+    [[nodiscard]] double congestion_cost(const resource& r) const noexcept
+    {
+        const auto overuse = r.occupancy + 1 > r.capacity ? r.occupancy + 1 - r.capacity : 0ul;
+
+        return (1.0 + r.history) * (1.0 + present_factor * static_cast<double>(overuse));
+    }
+    /**
+     * Computes the cost of a step from `current` to `successor` on a path to `target`. Since each step costs at least
+     * 1, distance heuristics that estimate the number of remaining steps stay admissible.
+     *
+     * This function does not modify any state and can, thus, be called concurrently.
+     *
+     * @param current Coordinate that is currently examined.
+     * @param successor Successor coordinate of `current`.
+     * @param target Target coordinate of the current objective.
+     * @return Cost of the step from `current` to `successor`.
+     */
+    [[nodiscard]] double step_cost(const coordinate<Lyt>& current, const coordinate<Lyt>& successor,
+                                   const coordinate<Lyt>& target) const noexcept
+    {
+        // the target is populated by a gate and, thus, no resource
+        auto cost = successor == target ? 1.0 : congestion_cost(coordinate_resources[coordinate_index.at(successor)]);
+
+        if (ps.crossings)
+        {
+            if (const auto it =
+                    connection_resources.find({coordinate_index.at(current), coordinate_index.at(successor)});
+                it != connection_resources.cend())
+            {
+                cost *= congestion_cost(it->second);
+            }
+        }
+
+        return cost;
+    }
+    /**
+     * Routes the objective with the given index with respect to the current congestion.
+     *
+     * This function does not modify any state and can, thus, be called concurrently.
+     *
+     * @param i Index of the objective to route.
+     * @return Path that fulfills objective `i` at the least cost or an empty path if there is none.
+     */
+    [[nodiscard]] path route(const std::size_t i) const noexcept
+    {
+        const auto& obj = objectives[i];
+
+        const auto cost = [this, &obj](const auto& current, const auto& successor)
+        { return step_cost(current, successor, obj.target); };
+
+        return a_star<path>(obstruction_lyt, {obj.source, obj.target}, manhattan_distance_fn<uint64_t>{}, cost,
+                            {ps.crossings});
+    }
+    /**
+     * Adds the given path to the occupancies of all resources it uses or removes it from them.
+     *
+     * @param p Path to add or remove.
+     * @param add Flag to add (`true`) or remove (`false`) the path.
+     */
+    void update_occupancy(const path& p, const bool add) noexcept
+    {
+        foreach_resource(p,
+                         [add](auto& r)
+                         {
+                             if (add)
+                             {
+                                 ++r.occupancy;
+                             }
+                             else
+                             {
+                                 --r.occupancy;
+                             }
+                         });
+    }
+    /**
+     * Applies the given function to all resources used by the given path, i.e., to its coordinates except for source
+     * and target and, if crossings are enabled, to all of its connections.
+     *
+     * @tparam Fn Functor type that receives a resource reference.
+     * @param p Path whose resources are to be visited.
+     * @param fn Functor to apply to each resource.
+     */
+    template <typename Fn>
+    void foreach_resource(const path& p, Fn&& fn)
+    {
+        if (p.size() < 2)
+        {
+            return;
+        }
+
+        std::for_each(p.cbegin() + 1, p.cend() - 1, [this, &fn](const auto& c)
+                      { fn(coordinate_resources[coordinate_index.at(c)]); });
+
+        if (ps.crossings)
+        {
+            for (auto it = p.cbegin(); it + 1 != p.cend(); ++it)
+            {
+                fn(connection_resources[{coordinate_index.at(*it), coordinate_index.at(*(it + 1))}]);
+            }
+        }
+    }
+    /**
+     * Rips up the current paths of the given objectives.
+     *
+     * @param begin Iterator to the index of the first objective to rip up.
+     * @param end Iterator past the index of the last objective to rip up.
+     */
+    void rip_up(const std::vector<std::size_t>::const_iterator begin,
+                const std::vector<std::size_t>::const_iterator end) noexcept
+    {
+        std::for_each(begin, end, [this](const auto i) { update_occupancy(paths[i], false); });
+    }
+    /**
+     * Stores the given path as the current one of the objective with the given index and adds it to the occupancies.
+     *
+     * @param i Index of the routed objective.
+     * @param p New path of objective `i`.
+     */
+    void commit(const std::size_t i, path&& p) noexcept
+    {
+        paths[i] = std::move(p);
+
+        if (paths[i].empty())
+        {
+            unroutable[i] = true;
+        }
+
+        update_occupancy(paths[i], true);
+    }
+    /**
+     * Rips up and reroutes the given objectives in order.
+     *
+     * If multiple threads are requested, the objectives are processed in waves of `num_threads`. All objectives of a
+     * wave are ripped up and then rerouted concurrently with respect to the congestion caused by all other objectives.
+     * Once all threads of a wave have finished, their new paths are committed in order. Thereby, the result is
+     * deterministic for a fixed number of threads. The threads persist throughout all waves such that their pooled
+     * search states are reused.
+     *
+     * @param pending Indices of the objectives to reroute.
+     */
+    void reroute(const std::vector<std::size_t>& pending)
+    {
+        const auto num_workers = std::min(static_cast<std::size_t>(ps.num_threads), pending.size());
+
+        if (num_workers <= 1)
+        {
+            std::for_each(pending.cbegin(), pending.cend(),
+                          [this](const auto i)
+                          {
+                              update_occupancy(paths[i], false);
+                              commit(i, route(i));
+                          });
+
+            return;
+        }
+
+        const auto num_waves = (pending.size() + num_workers - 1) / num_workers;
+
+        // returns the index range of the given wave in pending
+        const auto wave_range = [&pending, num_workers](const std::size_t w)
+        {
+            return std::make_pair(pending.cbegin() + static_cast<int64_t>(w * num_workers),
+                                  pending.cbegin() + static_cast<int64_t>(std::min((w + 1) * num_workers,
+                                                                                   pending.size())));
+        };
+
+        std::vector<path> wave_paths(num_workers);
+
+        std::mutex              mutex{};
+        std::condition_variable wave_done{};
+        std::size_t             num_arrived{0}, current_wave{0};
+
+        rip_up(wave_range(0).first, wave_range(0).second);
+
+        std::vector<std::thread> threads{};
+        threads.reserve(num_workers);
+
+        for (std::size_t t = 0; t < num_workers; ++t)
+        {
+            threads.emplace_back(
+                [&, t]
+                {
+                    for (std::size_t w = 0; w < num_waves; ++w)
+                    {
+                        if (const auto pos = w * num_workers + t; pos < pending.size())
+                        {
+                            wave_paths[t] = route(pending[pos]);
+                        }
+
+                        std::unique_lock lock{mutex};
+
+                        // the last thread to finish commits the wave and prepares the next one
+                        if (++num_arrived == num_workers)
+                        {
+                            const auto [begin, end] = wave_range(w);
+
+                            for (auto it = begin; it != end; ++it)
+                            {
+                                commit(*it, std::move(wave_paths[static_cast<std::size_t>(it - begin)]));
+                            }
+
+                            if (w + 1 < num_waves)
+                            {
+                                rip_up(wave_range(w + 1).first, wave_range(w + 1).second);
+                            }
+
+                            num_arrived = 0;
+                            ++current_wave;
+
+                            wave_done.notify_all();
+                        }
+                        else
+                        {
+                            wave_done.wait(lock, [&current_wave, w] { return current_wave > w; });
+                        }
+                    }
+                });
+        }
+
+        std::for_each(threads.begin(), threads.end(), [](auto& t) { t.join(); });
+    }
+    /**
+     * Adds the current overuse of all resources to their history congestion and logs the statistics of the iteration.
+     *
+     * @param num_rerouted_objectives Number of objectives that were rerouted in the iteration.
+     * @return Total overuse of all resources.
+     */
+    uint64_t update_history(const std::size_t num_rerouted_objectives) noexcept
+    {
+        negotiated_congestion_routing_stats::iteration_stats it_st{};
+        it_st.num_rerouted_objectives = num_rerouted_objectives;
+
+        const auto update = [this, &it_st](auto& r)
+        {
+            if (r.occupancy > r.capacity)
+            {
+                const auto overuse = r.occupancy - r.capacity;
+
+                r.history += ps.history_factor * static_cast<double>(overuse);
+
+                ++it_st.num_overused_resources;
+                it_st.total_overuse += overuse;
+            }
+        };
+
+        std::for_each(coordinate_resources.begin(), coordinate_resources.end(), update);
+        std::for_each(connection_resources.begin(), connection_resources.end(),
+                      [&update](auto& r) { update(r.second); });
+
+        pst.iterations.push_back(it_st);
+
+        return it_st.total_overuse;
+    }
+    /**
+     * Determines all objectives whose current paths use at least one overused resource.
+     *
+     * @return Indices of all objectives that have to be rerouted in order.
+     */
+    [[nodiscard]] std::vector<std::size_t> congested_objectives()
+    {
+        std::vector<std::size_t> congested{};
+
+        for (std::size_t i = 0; i < objectives.size(); ++i)
+        {
+            bool is_congested = false;
+
+            foreach_resource(paths[i], [&is_congested](const auto& r) { is_congested |= r.occupancy > r.capacity; });
+
+            if (is_congested)
+            {
+                congested.push_back(i);
+            }
+        }
+
+        return congested;
+    }
+    /**
+     * Applies all current paths to the layout. If two paths cross each other, the latter one is routed in the crossing
+     * layer.
+     *
+     * This function logs the number of unsatisfied objectives in the statistics.
+     */
+    void conduct_routing() noexcept
+    {
+        std::for_each(paths.cbegin(), paths.cend(),
+                      [this](const auto& p)
+                      {
+                          if (p.empty())
+                          {
+                              ++pst.number_of_unsatisfied_objectives;
+                          }
+                          else
+                          {
+                              route_path(layout, p);
+                          }
+                      });
+    }
+    /**
+     * Applies a conflict-free subset of the current paths to the layout. To this end, paths are greedily accepted in
+     * order if all of their resources are still available.
+     *
+     * This function logs the number of unsatisfied objectives in the statistics.
+     */
+    void conduct_partial_routing() noexcept
+    {
+        std::for_each(paths.cbegin(), paths.cend(), [this](const auto& p) { update_occupancy(p, false); });
+
+        for (const auto& p : paths)
+        {
+            bool is_available = !p.empty();
+
+            foreach_resource(p, [&is_available](const auto& r) { is_available &= r.occupancy < r.capacity; });
+
+            if (is_available)
+            {
+                update_occupancy(p, true);
+                route_path(layout, p);
+            }
+            else
+            {
+                ++pst.number_of_unsatisfied_objectives;
+            }
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * A negotiated congestion routing approach based on the PathFinder algorithm as originally proposed in \"PathFinder: A
+ * Negotiation-Based Performance-Driven Router for FPGAs\" by L. McMurchie and C. Ebeling in FPGA 1995.
+ *
+ * Given a gate-level layout and a set of routing objectives, e.g., as extracted by `extract_routing_objectives`, this
+ * algorithm tries to fulfill all objectives by routing conflict-free wire paths. In contrast to `color_routing`, which
+ * enumerates many paths per objective and then selects a conflict-free subset, this approach determines only one path
+ * per objective at a time. Initially, all objectives are routed via A* (see `a_star`) while paths are allowed to share
+ * coordinates. In each subsequent iteration, all objectives whose paths use overused coordinates are ripped up and
+ * rerouted. Thereby, the cost of a coordinate grows with the number of paths that are already using it (present
+ * congestion) and with its overuse in previous iterations (history congestion). The former is weighted increasingly
+ * with each iteration. Thus, paths negotiate which of them have to yield until no coordinate is overused anymore.
+ * Since only a single path search per objective and iteration is needed, this approach scales to thousands of
+ * objectives.
+ *
+ * If crossings are enabled, two paths may share a single coordinate in the ground layer as long as its crossing layer
+ * is free and they do not share any connection, i.e., they cross each other at that coordinate. Furthermore, paths may
+ * cross over wires that are already present in the layout.
+ *
+ * Objectives can be rerouted concurrently in batches. Within each batch, paths do not see each other's congestion.
+ * Hence, the result depends on the number of threads but is deterministic for a fixed one.
+ *
+ * If all objectives could be fulfilled, the determined paths are applied to the layout. Otherwise, the layout is only
+ * modified if a partial routing was requested. In that case, a conflict-free subset of the last iteration's paths is
+ * applied.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @param lyt Gate-level layout to route.
+ * @param objectives Routing objectives, i.e., source-target pairs of coordinates populated by gates.
+ * @param ps Parameters.
+ * @param pst Statistics.
+ * @return `true` iff all objectives could be fulfilled or if a partial routing was conducted.
+ */
+template <typename Lyt>
+bool negotiated_congestion_routing(Lyt& lyt, const std::vector<routing_objective<Lyt>>& objectives,
+                                   negotiated_congestion_routing_params ps = {},
+                                   negotiated_congestion_routing_stats* pst = nullptr)
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+
+    negotiated_congestion_routing_stats             st{};
+    detail::negotiated_congestion_routing_impl<Lyt> p{lyt, objectives, ps, st};
+
+    auto result = p.run();
+
+    if (pst)
+    {
+        *pst = st;
+    }
+
+    return result;
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_NEGOTIATED_CONGESTION_ROUTING_HPP
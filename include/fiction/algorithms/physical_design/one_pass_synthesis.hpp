@@ -5,21 +5,27 @@
 #ifndef FICTION_ONE_PASS_SYNTHESIS_HPP
 #define FICTION_ONE_PASS_SYNTHESIS_HPP
 
-#if (MUGEN)
-
 #include "fiction/algorithms/iter/aspect_ratio_iterator.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
 #include "fiction/layouts/coordinates.hpp"
+#include "fiction/layouts/gate_level_layout.hpp"
+#include "fiction/traits.hpp"
 #include "fiction/utils/name_utils.hpp"
-#include "utils/mugen_info.hpp"
 
+#include <bill/sat/interface/common.hpp>
+#include <bill/sat/solver.hpp>
+#include <fmt/format.h>
 #include <kitty/dynamic_truth_table.hpp>
+#include <kitty/bit_operations.hpp>
 #include <kitty/print.hpp>
 #include <mockturtle/algorithms/simulation.hpp>
+#include <mockturtle/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <iostream>
@@ -28,9 +34,24 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
+#if !defined(_WIN32)
+#include <cerrno>
+#include <csignal>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#if (MUGEN)
+
+#include "utils/mugen_info.hpp"
+
 // pybind11 has quite some warnings in its code; let's silence them a little
 #pragma GCC diagnostic push  // GCC
 #pragma GCC diagnostic ignored "-Wshadow"
@@ -43,6 +64,8 @@
 #pragma GCC diagnostic pop  // GCC
 #pragma warning(pop)        // MSVC
 
+#endif  // MUGEN
+
 #if (PROGRESS_BARS)
 #include <mockturtle/utils/progress_bar.hpp>
 #endif
@@ -50,6 +73,22 @@
 namespace fiction
 {
 
+/**
+ * SAT back ends that generate and solve the one-pass synthesis instances.
+ */
+enum class one_pass_synthesis_engine
+{
+    /**
+     * Native C++ encoding that is solved via the bill SAT interface. It does not require a Python runtime.
+     */
+    BILL,
+    /**
+     * Mugen, a Python3 library by Winston Haaswijk, that is called via pybind11. Only available if fiction has been
+     * compiled with `-DFICTION_ENABLE_MUGEN=ON`.
+     */
+    MUGEN
+};
+
 /**
  * Parameters for the one-pass synthesis algorithm.
  *
@@ -103,14 +142,32 @@ struct one_pass_synthesis_params
      * Flag to indicate that I/Os should be realized by designated wire segments (preferred).
      */
     bool io_pins = true;  // TODO thus far, io_ports have to be set to true
+    /**
+     * SAT back end to use. Defaults to Mugen if it is available to preserve the original behavior.
+     */
+#if (MUGEN)
+    one_pass_synthesis_engine engine = one_pass_synthesis_engine::MUGEN;
+#else
+    one_pass_synthesis_engine engine = one_pass_synthesis_engine::BILL;
+#endif
 #if !defined(__APPLE__)
     /**
      * Number of threads to use for exploring the possible aspect ratios.
      *
-     * @note This is an unstable beta feature.
+     * @note This is an unstable beta feature that is only considered by the Mugen engine.
      */
     std::size_t num_threads = 1ul;
 #endif
+    /**
+     * Number of aspect ratios to explore simultaneously. Each one is examined by a separate worker process. In case of
+     * Mugen, each worker has its own copy of the Python interpreter such that the calls are not serialized by Python's
+     * global interpreter lock.
+     * As soon as an aspect ratio turns out to be realizable, all workers that explore larger ones are canceled. The
+     * worker that found the smallest realizable aspect ratio sends its layout back to the parent process via a pipe.
+     *
+     * @note Worker processes are only available on POSIX systems. Elsewhere, aspect ratios are explored sequentially.
+     */
+    std::size_t num_workers = 1ul;
     /**
      * Sets a timeout in seconds for the solving process, where 0 allows for unlimited time.
      */
@@ -140,40 +197,31 @@ struct one_pass_synthesis_stats
 namespace detail
 {
 /**
- * A Python interpreter instance that is necessary to call Mugen, a library written in Python. This instance is
- * scoped and only need to exist. No operations are to be performed on this object. It handles creation and proper
- * destruction of all Python objects used during this session and deals with the CPython API.
- */
-inline static const pybind11::scoped_interpreter INSTANCE{};
-
-// suppress warning 'declared with greater visibility than the type of its field'
-#pragma GCC visibility push(hidden)
-/**
- * Sub-class to handle interaction with the Python code Mugen as well as some house-keeping.
+ * Base class of the handlers that generate and solve the SAT instances of individual aspect ratios. It performs the
+ * house-keeping that is independent of the SAT back end.
  */
 template <typename Lyt, typename TT>
-class mugen_handler
+class synthesis_handler
 {
   public:
     /**
      * Standard constructor.
      *
      * @param spec The Boolean functions to synthesize.
-     * @param lyt Reference to an empty layout that serves as a floor plan for S&P&R by Mugen.
+     * @param sketch Reference to an empty layout that serves as a floor plan for S&P&R.
      * @param p The configurations to respect in the SAT instance generation process.
      */
-    mugen_handler(const std::vector<TT>& spec, Lyt& sketch, one_pass_synthesis_params<Lyt> p) :
+    synthesis_handler(const std::vector<TT>& spec, Lyt& sketch, one_pass_synthesis_params<Lyt> p) :
             tts{spec},
             num_pis{spec[0].num_vars()},  // since all tts have to have the same number of variables
             lyt{sketch},
             ps{std::move(p)},             // need a copy because timeout will be altered
-            pi_list(num_pis),
-            mugen{pybind11::module::import("mugen")}
+            pi_list(num_pis)
     {}
     /**
      * Evaluates a given aspect ratio regarding the stored configurations whether it can be skipped, i.e., does not
-     * need to be explored by Mugen. The better this function is, the more UNSAT instances can be skipped without
-     * losing the optimality guarantee. This function should never be overly restrictive!
+     * need to be explored by the SAT solver. The better this function is, the more UNSAT instances can be skipped
+     * without losing the optimality guarantee. This function should never be overly restrictive!
      *
      * @param ratio Aspect ratio to evaluate.
      * @return `true` iff ratio can safely be skipped because it is UNSAT anyways.
@@ -215,6 +263,70 @@ class mugen_handler
     {
         ps.timeout = timeout;
     }
+
+  protected:
+    /**
+     * The Boolean functions to synthesize.
+     */
+    const std::vector<TT>& tts;
+    /**
+     * Number of primary inputs according to spec.
+     */
+    const uint64_t num_pis;
+    /**
+     * The sketch that later contains the layout generated from a model.
+     */
+    Lyt& lyt;
+    /**
+     * Configurations specifying layout restrictions. Used in instance generation among other places.
+     */
+    one_pass_synthesis_params<Lyt> ps;
+    /**
+     * Pre-allocate PIs to preserve their order.
+     */
+    std::vector<mockturtle::node<Lyt>> pi_list;
+
+    void initialize_pis()
+    {
+        // a little hacky: place them all at position {0, 0} so that they can be fetched to be stored as nodes
+        // instead of as signals to not lose them as soon as their tile is overridden
+        for (auto i = 0ul; i < num_pis; ++i)
+        {
+            pi_list[i] = lyt.get_node(lyt.create_pi(fmt::format("pi{}", i), {0, 0}));
+        }
+        // finally, remove the latest created PI again (which has overridden all others) from the layout
+        lyt.move_node(pi_list[num_pis - 1], {});
+    }
+};
+
+#if (MUGEN)
+/**
+ * A Python interpreter instance that is necessary to call Mugen, a library written in Python. This instance is
+ * scoped and only need to exist. No operations are to be performed on this object. It handles creation and proper
+ * destruction of all Python objects used during this session and deals with the CPython API.
+ */
+inline static const pybind11::scoped_interpreter INSTANCE{};
+
+// suppress warning 'declared with greater visibility than the type of its field'
+#pragma GCC visibility push(hidden)
+/**
+ * Sub-class to handle interaction with the Python code Mugen as well as some house-keeping.
+ */
+template <typename Lyt, typename TT>
+class mugen_handler : public synthesis_handler<Lyt, TT>
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param spec The Boolean functions to synthesize.
+     * @param lyt Reference to an empty layout that serves as a floor plan for S&P&R by Mugen.
+     * @param p The configurations to respect in the SAT instance generation process.
+     */
+    mugen_handler(const std::vector<TT>& spec, Lyt& sketch, one_pass_synthesis_params<Lyt> p) :
+            synthesis_handler<Lyt, TT>(spec, sketch, std::move(p)),
+            mugen{pybind11::module::import("mugen")}
+    {}
     /**
      * Passes the current scheme_graph to Mugen and synthesizes it. If there is an implementation on this graph
      * realizing the specification, this function returns true.
@@ -248,26 +360,12 @@ class mugen_handler
     }
 
   private:
-    /**
-     * The Boolean functions to synthesize.
-     */
-    const std::vector<TT>& tts;
-    /**
-     * Number of primary inputs according to spec.
-     */
-    const uint64_t num_pis;
-    /**
-     * The sketch that later contains the layout generated from a model.
-     */
-    Lyt& lyt;
-    /**
-     * Configurations specifying layout restrictions. Used in instance generation among other places.
-     */
-    one_pass_synthesis_params<Lyt> ps;
-    /**
-     * Pre-allocate PIs to preserve their order.
-     */
-    std::vector<mockturtle::node<Lyt>> pi_list;
+    using synthesis_handler<Lyt, TT>::tts;
+    using synthesis_handler<Lyt, TT>::num_pis;
+    using synthesis_handler<Lyt, TT>::lyt;
+    using synthesis_handler<Lyt, TT>::ps;
+    using synthesis_handler<Lyt, TT>::pi_list;
+    using synthesis_handler<Lyt, TT>::initialize_pis;
     /**
      * The Python module named Mugen.
      */
@@ -345,18 +443,6 @@ class mugen_handler
         return scheme_graph;
     }
 
-    void initialize_pis()
-    {
-        // a little hacky: place them all at position {0, 0} so that they can be fetched to be stored as nodes
-        // instead of as signals to not lose them as soon as their tile is overridden
-        for (auto i = 0ul; i < num_pis; ++i)
-        {
-            pi_list[i] = lyt.get_node(lyt.create_pi(fmt::format("pi{}", i), {0, 0}));
-        }
-        // finally, remove the latest created PI again (which has overridden all others) from the layout
-        lyt.move_node(pi_list[num_pis - 1], {});
-    }
-
     // returns an iterator that points to the first non-PI node of the given list of nodes
     auto get_node_begin_iterator(const pybind11::handle& nodes) const
     {
@@ -704,197 +790,2067 @@ class mugen_handler
     }
 };
 
+#pragma GCC visibility pop
+
+#endif  // MUGEN
+
+/**
+ * Exception that is thrown by the native SAT back end if the solving process exceeds the configured timeout.
+ */
+class one_pass_synthesis_timeout_exception : public std::exception
+{
+  public:
+    [[nodiscard]] const char* what() const noexcept override
+    {
+        return "one-pass synthesis timeout";
+    }
+};
+/**
+ * Sub-class that encodes the one-pass synthesis problem natively in C++ and solves it via the bill SAT interface, i.e.,
+ * without the round trip through Python. The encoding mirrors the one generated by Mugen's scheme_graph such that
+ * both back ends realize the same specifications on the same aspect ratios.
+ *
+ * A single solver instance is kept alive across all explored aspect ratios. Each aspect ratio's instance is encoded
+ * over fresh variables and all of its clauses are guarded by an activation literal that is assumed during solving and
+ * permanently disabled afterwards. This merely saves re-creating the solver; no variables or clauses are shared between
+ * the instances of different aspect ratios.
+ */
 template <typename Lyt, typename TT>
-class one_pass_synthesis_impl
+class bill_handler : public synthesis_handler<Lyt, TT>
 {
   public:
-    one_pass_synthesis_impl(const std::vector<TT>& spec, const one_pass_synthesis_params<Lyt>& p,
-                            one_pass_synthesis_stats& st) :
-            tts{spec},
-            ps{p},
-            pst{st},
-            ari{ps.fixed_size ? static_cast<uint64_t>(ps.upper_bound_x * ps.upper_bound_y) : 0u}
+    /**
+     * Standard constructor.
+     *
+     * @param spec The Boolean functions to synthesize.
+     * @param sketch Reference to an empty layout that serves as a floor plan for S&P&R.
+     * @param p The configurations to respect in the SAT instance generation process.
+     */
+    bill_handler(const std::vector<TT>& spec, Lyt& sketch, one_pass_synthesis_params<Lyt> p) :
+            synthesis_handler<Lyt, TT>(spec, sketch, std::move(p)),
+            num_bits{spec[0].num_bits()}
     {}
-
-    std::optional<Lyt> run()
+    /**
+     * Encodes the synthesis problem on the layout's current aspect ratio and solves it. If there is an implementation
+     * on this aspect ratio realizing the specification, it is extracted into the layout and this function returns
+     * true.
+     *
+     * @return `true` iff the instance generated for the current configuration is SAT.
+     */
+    bool is_satisfiable()
     {
-        // test for proper installation of all required Python libraries
-        if (!test_dependencies())
-        {
-            return std::nullopt;
-        }
+        generate_instance();
 
-        // empty layout with an initial size of 1 x 1 tiles
-        Lyt layout{{0, 0}, *ps.scheme};
-
-        // handler for the Python interaction
-        mugen_handler handler{tts, layout, ps};
+        const auto sat = solve();
 
-        for (; ari <= static_cast<uint64_t>(ps.upper_bound_x) * static_cast<uint64_t>(ps.upper_bound_y);
-             ++ari)  // <= to prevent overflow
+        if (sat)
         {
-
-#if (PROGRESS_BARS)
-            mockturtle::progress_bar bar("[i] examining layout aspect ratios: {:>2} × {:<2}");
-#endif
-
-            const auto aspect_ratio = typename Lyt::aspect_ratio{(*ari).x, (*ari).y, ps.crossings ? 1 : 0};
-
-            if (handler.skippable(aspect_ratio))
-            {
-                continue;
-            }
-
-#if (PROGRESS_BARS)
-            bar(aspect_ratio.x + 1, aspect_ratio.y + 1);
-#endif
-
-            handler.update_aspect_ratio(aspect_ratio);
-
-            try
-            {
-                const auto sat =
-                    mockturtle::call_with_stopwatch(pst.time_total, [&handler] { return handler.is_satisfiable(); });
-
-                if (sat)  // solution found
-                {
-                    // statistical information
-                    pst.x_size    = layout.x() + 1;
-                    pst.y_size    = layout.y() + 1;
-                    pst.num_gates = layout.num_gates();
-                    pst.num_wires = layout.num_wires();
-
-                    // restore layout name
-                    if constexpr (has_set_layout_name_v<Lyt>)
-                    {
-                        layout.set_layout_name(ps.name);
-                    }
-
-                    return layout;
-                }
-                // update timeout and retry
-                if (ps.timeout)
-                {
-                    update_timeout(handler, pst.time_total);
-                }
-            }
-            // timeout reached
-            catch (...)
-            {
-                return std::nullopt;
-            }
+            to_gate_layout(solver.get_model().model());
         }
 
-        return std::nullopt;
+        // disable the instance of the current aspect ratio for all subsequent solver calls
+        solver.add_clause(bill::lit_type{activation, bill::negative_polarity});
+
+        return sat;
     }
 
   private:
-    const std::vector<TT> tts;
-
-    one_pass_synthesis_params<Lyt> ps;
-    one_pass_synthesis_stats&      pst;
-
+    using synthesis_handler<Lyt, TT>::tts;
+    using synthesis_handler<Lyt, TT>::num_pis;
+    using synthesis_handler<Lyt, TT>::lyt;
+    using synthesis_handler<Lyt, TT>::ps;
+    using synthesis_handler<Lyt, TT>::pi_list;
+    using synthesis_handler<Lyt, TT>::initialize_pis;
     /**
-     * Factorizes a number of layout tiles into all possible aspect ratios for iteration.
+     * Gate types that can be assigned to a tile.
      */
-    aspect_ratio_iterator<aspect_ratio<Lyt>> ari{0};
-
-    class pysat_version_mismatch_exception : public std::exception
+    enum class gate_type : uint8_t
     {
-      public:
-        explicit pysat_version_mismatch_exception(std::string v) : std::exception(), version{std::move(v)} {}
-
-        [[nodiscard]] std::string detected() const
-        {
-            return version;
-        }
-
-      private:
-        const std::string version;
+        EMPTY,
+        WIRE,
+        NOT,
+        AND,
+        OR,
+        MAJ,
+        CROSS
     };
-
     /**
-     * Tests whether all needed dependencies have been installed and can be accessed via Python.
-     *
-     * @return `true` iff all dependencies are met.
+     * Ports of a node. The cardinal directions refer to tile borders. PIs have a single, undirected port.
      */
-    [[nodiscard]] bool test_dependencies() const
+    enum port : uint8_t
     {
-        namespace py = pybind11;
-        using namespace py::literals;
-
-        // test for graphviz
-        try
-        {
-            py::exec("import graphviz");
-        }
-        catch (...)
-        {
-            std::cout << "[e] Python module 'graphviz' could not be detected" << std::endl;
-            return false;
-        }
-
+        NORTH = 0u,
+        EAST  = 1u,
+        SOUTH = 2u,
+        WEST  = 3u,
+        NONE  = 4u
+    };
+    /**
+     * A node that can serve as a fanin together with the port it provides its signal at.
+     */
+    struct fanin_option
+    {
+        uint64_t node;
+        port     out_port;
+    };
+    /**
+     * A selection variable that assigns a combination of fanins to a node. For crossings, the map from incoming to
+     * outgoing directions is stored as well.
+     */
+    struct selection
+    {
+        bill::var_type                             var;
+        std::vector<std::pair<port, fanin_option>> fanins;
+        std::array<port, 4>                        dir_map{NONE, NONE, NONE, NONE};
+    };
+    /**
+     * An output variable that assigns a primary output to the port of a border node.
+     */
+    struct output
+    {
+        bill::var_type var;
+        uint64_t       node;
+        port           out_port;
+    };
+    /**
+     * A node of the instance. The first num_pis nodes represent the primary inputs, all remaining ones the layout's
+     * tiles in row-major order.
+     */
+    struct instance_node
+    {
+        tile<Lyt> t{};
+
+        bool is_pi{false};
+        bool is_border{false};
+
+        std::vector<uint64_t> virtual_fanin{};
+        std::vector<uint64_t> virtual_fanout{};
+
+        std::vector<port> fanout_directions{};
+        std::vector<port> io_directions{};
+
+        std::vector<std::pair<port, std::vector<fanin_option>>> fanin_options{};
+
+        std::vector<std::pair<gate_type, bill::var_type>> gate_vars{};
+        std::array<std::vector<bill::var_type>, 5>        sim_vars{};
+
+        std::vector<selection> selections{};
+
+        std::vector<bill::var_type>                      ref_vars{};
+        std::vector<std::pair<bill::var_type, uint64_t>> ref_var_map{};
+        std::array<std::vector<bill::var_type>, 5>       ref_var_direction_map{};
+        std::array<std::vector<bill::var_type>, 4>       svar_direction_map{};
+    };
+    /**
+     * Number of conflicts after which the solver checks for a timeout.
+     */
+    static constexpr const uint32_t CONFLICT_BUDGET = 10000u;
+    /**
+     * Number of bits in the truth tables of the specification.
+     */
+    const uint64_t num_bits;
+    /**
+     * The SAT solver that is shared by the instances of all aspect ratios.
+     */
+    bill::solver<bill::solvers::ghack> solver{};
+    /**
+     * Activation variable of the current aspect ratio's instance.
+     */
+    bill::var_type activation{};
+    /**
+     * Constant false variable of the current aspect ratio's instance.
+     */
+    bill::var_type constant_false{};
+    /**
+     * All nodes of the current instance.
+     */
+    std::vector<instance_node> nodes{};
+    /**
+     * Output variables for each primary output.
+     */
+    std::vector<std::vector<output>> outputs{};
+    /**
+     * (node, node) --> connection variable for all virtual edges.
+     */
+    std::map<std::pair<uint64_t, uint64_t>, bill::var_type> connection_vars{};
+    /**
+     * Gate type of each node in the decoded model.
+     */
+    std::vector<gate_type> node_types{};
+    /**
+     * Selected fanins of each node in the decoded model.
+     */
+    std::vector<const selection*> node_fanins{};
+    /**
+     * Node --> Lyt signal
+     */
+    std::vector<mockturtle::signal<Lyt>> node_signals{};
+    /**
+     * (crossing node, outgoing node) --> incoming node
+     */
+    std::map<std::pair<uint64_t, uint64_t>, uint64_t> crossing_map{};
+
+    [[nodiscard]] static bill::lit_type pos(const bill::var_type v) noexcept
+    {
+        return bill::lit_type{v, bill::positive_polarity};
+    }
+
+    [[nodiscard]] static bill::lit_type neg(const bill::var_type v) noexcept
+    {
+        return bill::lit_type{v, bill::negative_polarity};
+    }
+
+    [[nodiscard]] static constexpr port opposite(const port p) noexcept
+    {
+        return static_cast<port>((p + 2u) % 4u);
+    }
+
+    [[nodiscard]] static constexpr uint64_t fanin_size(const gate_type g) noexcept
+    {
+        switch (g)
+        {
+            case gate_type::WIRE:
+            case gate_type::NOT: return 1ull;
+            case gate_type::AND:
+            case gate_type::OR:
+            case gate_type::CROSS: return 2ull;
+            case gate_type::MAJ: return 3ull;
+            default: return 0ull;
+        }
+    }
+    // evaluates gate g on the input assignment whose i-th bit represents the i-th input value
+    [[nodiscard]] static constexpr bool evaluate(const gate_type g, const uint64_t inputs) noexcept
+    {
+        switch (g)
+        {
+            case gate_type::WIRE: return (inputs & 1u) != 0u;
+            case gate_type::NOT: return (inputs & 1u) == 0u;
+            case gate_type::AND: return (inputs & 3u) == 3u;
+            case gate_type::OR: return (inputs & 3u) != 0u;
+            case gate_type::MAJ: return inputs == 3u || inputs == 5u || inputs == 6u || inputs == 7u;
+            default: return false;
+        }
+    }
+    // direction in which t2 is located when seen from the adjacent t1
+    [[nodiscard]] static port direction(const tile<Lyt>& t1, const tile<Lyt>& t2) noexcept
+    {
+        if (t2.x > t1.x)
+        {
+            return EAST;
+        }
+        if (t2.x < t1.x)
+        {
+            return WEST;
+        }
+
+        return t2.y > t1.y ? SOUTH : NORTH;
+    }
+
+    [[nodiscard]] uint64_t node_id(const tile<Lyt>& t) const noexcept
+    {
+        return num_pis + static_cast<uint64_t>(t.y) * (static_cast<uint64_t>(lyt.x()) + 1ull) +
+               static_cast<uint64_t>(t.x);
+    }
+    // the node adjacent to n in direction p
+    [[nodiscard]] uint64_t neighbor(const uint64_t n, const port p) const noexcept
+    {
+        auto t = nodes[n].t;
+
+        switch (p)
+        {
+            case NORTH: --t.y; break;
+            case EAST: ++t.x; break;
+            case SOUTH: ++t.y; break;
+            default: --t.x; break;
+        }
+
+        return node_id(t);
+    }
+
+    [[nodiscard]] std::optional<bill::var_type> gate_var(const instance_node& n, const gate_type g) const noexcept
+    {
+        for (const auto& [type, var] : n.gate_vars)
+        {
+            if (type == g)
+            {
+                return var;
+            }
+        }
+
+        return std::nullopt;
+    }
+    [[nodiscard]] std::vector<bill::var_type> add_variables(const uint64_t num)
+    {
+        std::vector<bill::var_type> vars(num);
+        std::generate(vars.begin(), vars.end(), [this] { return solver.add_variable(); });
+
+        return vars;
+    }
+    /**
+     * Adds a clause to the current instance by guarding it with the activation literal.
+     *
+     * @param clause Clause to add.
+     */
+    void add_clause(std::vector<bill::lit_type> clause)
+    {
+        clause.push_back(neg(activation));
+        solver.add_clause(clause);
+    }
+
+    void at_most_one(const std::vector<bill::var_type>& vars, const std::vector<bill::lit_type>& guard = {})
+    {
+        for (auto i = 0ul; i < vars.size(); ++i)
+        {
+            for (auto j = i + 1; j < vars.size(); ++j)
+            {
+                auto clause = guard;
+                clause.push_back(neg(vars[i]));
+                clause.push_back(neg(vars[j]));
+                add_clause(clause);
+            }
+        }
+    }
+
+    void exactly_one(const std::vector<bill::var_type>& vars, const std::vector<bill::lit_type>& guard = {})
+    {
+        auto clause = guard;
+        std::transform(vars.cbegin(), vars.cend(), std::back_inserter(clause), [](const auto v) { return pos(v); });
+        add_clause(clause);
+
+        at_most_one(vars, guard);
+    }
+    /**
+     * Restricts the number of true variables in vars to the range [lower, upper] under the given guard. A sequential
+     * counter is used for bounds larger than 1.
+     *
+     * @param vars Variables to count.
+     * @param lower Lower bound.
+     * @param upper Upper bound.
+     * @param guard Literals that disable the constraint if one of them is true.
+     */
+    void cardinality(const std::vector<bill::var_type>& vars, const uint64_t lower, const uint64_t upper,
+                     const std::vector<bill::lit_type>& guard)
+    {
+        if (upper == 1ull)
+        {
+            if (lower == 1ull)
+            {
+                exactly_one(vars, guard);
+            }
+            else
+            {
+                at_most_one(vars, guard);
+            }
+
+            return;
+        }
+
+        const auto bound = upper + 1;
+
+        // counter[j - 1] is true iff at least j of the variables processed so far are true
+        std::vector<bill::var_type> counter(bound, constant_false);
+
+        for (const auto v : vars)
+        {
+            std::vector<bill::var_type> next(bound);
+            for (auto j = 0ul; j < bound; ++j)
+            {
+                next[j] = solver.add_variable();
+
+                add_clause({neg(counter[j]), pos(next[j])});
+                add_clause({neg(next[j]), pos(counter[j]), pos(v)});
+
+                if (j == 0)
+                {
+                    add_clause({neg(v), pos(next[j])});
+                }
+                else
+                {
+                    add_clause({neg(v), neg(counter[j - 1]), pos(next[j])});
+                    add_clause({neg(next[j]), pos(counter[j]), pos(counter[j - 1])});
+                }
+            }
+
+            counter = std::move(next);
+        }
+
+        auto at_most = guard;
+        at_most.push_back(neg(counter[upper]));
+        add_clause(at_most);
+
+        if (lower > 0ull)
+        {
+            auto at_least = guard;
+            at_least.push_back(pos(counter[lower - 1]));
+            add_clause(at_least);
+        }
+    }
+    /**
+     * Generates the SAT instance for the layout's current aspect ratio.
+     */
+    void generate_instance()
+    {
+        nodes.clear();
+        outputs.clear();
+        connection_vars.clear();
+
+        activation     = solver.add_variable();
+        constant_false = solver.add_variable();
+        add_clause({neg(constant_false)});
+
+        create_nodes();
+        create_variables();
+
+        simulation_constraints();
+        fanin_constraints();
+        cycle_constraints();
+        io_constraints();
+        gate_constraints();
+        symmetry_constraints();
+    }
+
+    void create_nodes()
+    {
+        nodes.resize(num_pis + (static_cast<uint64_t>(lyt.x()) + 1ull) * (static_cast<uint64_t>(lyt.y()) + 1ull));
+
+        for (auto i = 0ul; i < num_pis; ++i)
+        {
+            nodes[i].is_pi = true;
+        }
+
+        lyt.foreach_ground_tile(
+            [this](const auto& t)
+            {
+                auto& n     = nodes[node_id(t)];
+                n.t         = t;
+                n.is_border = t.x == 0 || t.x == lyt.x() || t.y == 0 || t.y == lyt.y();
+            });
+
+        // virtual edges model the data flow of the clocking scheme
+        lyt.foreach_ground_tile(
+            [this](const auto& t)
+            {
+                lyt.foreach_outgoing_clocked_zone(t,
+                                                  [this, &t](const auto& at)
+                                                  {
+                                                      const auto gt = tile<Lyt>{at.x, at.y};
+
+                                                      if (gt == t)
+                                                      {
+                                                          return;
+                                                      }
+
+                                                      auto& fanout = nodes[node_id(t)].virtual_fanout;
+                                                      if (const auto id = node_id(gt);
+                                                          std::find(fanout.cbegin(), fanout.cend(), id) == fanout.cend())
+                                                      {
+                                                          fanout.push_back(id);
+                                                          nodes[id].virtual_fanin.push_back(node_id(t));
+                                                      }
+                                                  });
+            });
+
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            discover_connectivity(n);
+        }
+    }
+    /**
+     * Determines the fanin and fanout directions of a tile. Border tiles may receive PIs and provide POs at all of
+     * their directions that are not used by virtual edges.
+     *
+     * @param n Node representing the tile.
+     */
+    void discover_connectivity(const uint64_t n)
+    {
+        auto& node = nodes[n];
+
+        std::array<std::optional<uint64_t>, 4> fanin_at{};
+        std::array<bool, 4>                    used{};
+
+        for (const auto out : node.virtual_fanout)
+        {
+            const auto d = direction(node.t, nodes[out].t);
+            used[d]      = true;
+            node.fanout_directions.push_back(d);
+        }
+        for (const auto in : node.virtual_fanin)
+        {
+            const auto d = direction(node.t, nodes[in].t);
+            used[d]      = true;
+            fanin_at[d]  = in;
+        }
+
+        for (const auto d : {NORTH, EAST, SOUTH, WEST})
+        {
+            if (fanin_at[d].has_value())
+            {
+                node.fanin_options.push_back({d, {{*fanin_at[d], opposite(d)}}});
+            }
+            else if (!used[d] && node.is_border)
+            {
+                node.io_directions.push_back(d);
+                node.fanout_directions.push_back(d);
+
+                std::vector<fanin_option> pi_options{};
+                for (auto i = 0ul; i < num_pis; ++i)
+                {
+                    pi_options.push_back({i, NONE});
+                }
+
+                node.fanin_options.push_back({d, pi_options});
+            }
+        }
+    }
+
+    void create_variables()
+    {
+        // simulation variables
+        for (auto& n : nodes)
+        {
+            if (n.is_pi)
+            {
+                n.sim_vars[NONE] = add_variables(num_bits);
+            }
+            else
+            {
+                for (const auto d : n.fanout_directions)
+                {
+                    n.sim_vars[d] = add_variables(num_bits);
+                }
+            }
+        }
+
+        // gate type variables
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            auto& node = nodes[n];
+
+            std::vector<gate_type> enabled{gate_type::EMPTY};
+            if (ps.enable_wires)
+            {
+                enabled.push_back(gate_type::WIRE);
+            }
+            if (ps.enable_not)
+            {
+                enabled.push_back(gate_type::NOT);
+            }
+            if (ps.enable_and)
+            {
+                enabled.push_back(gate_type::AND);
+            }
+            if (ps.enable_or)
+            {
+                enabled.push_back(gate_type::OR);
+            }
+            if (ps.enable_maj && node.fanin_options.size() > 2)
+            {
+                enabled.push_back(gate_type::MAJ);
+            }
+            if (ps.crossings && !node.is_border && node.virtual_fanin.size() == 2)
+            {
+                enabled.push_back(gate_type::CROSS);
+            }
+
+            for (const auto g : enabled)
+            {
+                node.gate_vars.emplace_back(g, solver.add_variable());
+            }
+        }
+
+        // selection variables
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            std::array<bool, 4> sizes{};
+            for (const auto& [g, var] : nodes[n].gate_vars)
+            {
+                sizes[fanin_size(g)] = true;
+            }
+
+            for (auto size = 1ul; size < sizes.size(); ++size)
+            {
+                if (sizes[size])
+                {
+                    std::vector<std::pair<port, fanin_option>> combination{};
+                    enumerate_fanin_combinations(n, size, 0ul, combination);
+                }
+            }
+        }
+
+        // output variables
+        outputs.resize(tts.size());
+        for (auto& houtvars : outputs)
+        {
+            for (auto n = num_pis; n < nodes.size(); ++n)
+            {
+                for (const auto d : nodes[n].io_directions)
+                {
+                    const auto var = solver.add_variable();
+
+                    nodes[n].ref_vars.push_back(var);
+                    nodes[n].ref_var_direction_map[d].push_back(var);
+
+                    houtvars.push_back({var, n, d});
+                }
+            }
+        }
+
+        // connection variables
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            for (const auto in : nodes[n].virtual_fanin)
+            {
+                connection_vars[{in, n}] = solver.add_variable();
+            }
+        }
+    }
+    /**
+     * Recursively enumerates all combinations of size fanin directions of node n together with all possible fanins
+     * in these directions.
+     */
+    void enumerate_fanin_combinations(const uint64_t n, const uint64_t size, const uint64_t start,
+                                      std::vector<std::pair<port, fanin_option>>& combination)
+    {
+        if (combination.size() == size)
+        {
+            add_selections(n, combination);
+            return;
+        }
+
+        for (auto i = start; i < nodes[n].fanin_options.size(); ++i)
+        {
+            const auto& [d, options] = nodes[n].fanin_options[i];
+
+            for (const auto& option : options)
+            {
+                combination.emplace_back(d, option);
+                enumerate_fanin_combinations(n, size, i + 1, combination);
+                combination.pop_back();
+            }
+        }
+    }
+
+    void add_selections(const uint64_t n, const std::vector<std::pair<port, fanin_option>>& combination)
+    {
+        // filter out redundant combinations
+        for (auto i = 0ul; i < combination.size(); ++i)
+        {
+            for (auto j = i + 1; j < combination.size(); ++j)
+            {
+                if (combination[i].second.node == combination[j].second.node)
+                {
+                    return;
+                }
+            }
+        }
+        // if designated PIs are enabled, gates with more than 1 fanin may not refer to PIs
+        if (ps.io_pins && combination.size() > 1 &&
+            std::any_of(combination.cbegin(), combination.cend(),
+                        [this](const auto& c) { return nodes[c.second.node].is_pi; }))
+        {
+            return;
+        }
+
+        const auto add = [this, &n, &combination](const std::array<port, 4>& dir_map)
+        {
+            const auto var = solver.add_variable();
+
+            for (const auto& [d, option] : combination)
+            {
+                auto& fanin = nodes[option.node];
+
+                fanin.ref_vars.push_back(var);
+                fanin.ref_var_direction_map[option.out_port].push_back(var);
+                fanin.ref_var_map.emplace_back(var, n);
+
+                nodes[n].svar_direction_map[d].push_back(var);
+            }
+
+            nodes[n].selections.push_back({var, combination, dir_map});
+        };
+
+        if (ps.crossings && combination.size() == 2)
+        {
+            // crossings need a separate selection variable for each mapping of input to output directions
+            const auto in1 = combination[0].first;
+            const auto in2 = combination[1].first;
+
+            std::vector<port> out_directions{};
+            for (const auto d : {NORTH, EAST, SOUTH, WEST})
+            {
+                if (d != in1 && d != in2)
+                {
+                    out_directions.push_back(d);
+                }
+            }
+
+            for (auto i = 0ul; i < 2; ++i)
+            {
+                std::array<port, 4> dir_map{NONE, NONE, NONE, NONE};
+                dir_map[in1] = out_directions[i];
+                dir_map[in2] = out_directions[1 - i];
+
+                add(dir_map);
+            }
+        }
+        else
+        {
+            add({NONE, NONE, NONE, NONE});
+        }
+    }
+    /**
+     * Propagates the simulation values through the gates according to their types and selected fanins.
+     */
+    void simulation_constraints()
+    {
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            const auto& node = nodes[n];
+
+            for (const auto& [g, gate] : node.gate_vars)
+            {
+                if (g == gate_type::EMPTY)
+                {
+                    continue;
+                }
+
+                for (const auto& sel : node.selections)
+                {
+                    if (sel.fanins.size() != fanin_size(g))
+                    {
+                        continue;
+                    }
+
+                    if (g == gate_type::CROSS)
+                    {
+                        // crossings cannot have PI fanin
+                        if (nodes[sel.fanins[0].second.node].is_pi || nodes[sel.fanins[1].second.node].is_pi)
+                        {
+                            add_clause({neg(gate), neg(sel.var)});
+                            continue;
+                        }
+
+                        // each incoming signal is passed on to its mapped outgoing direction
+                        for (const auto& [d, option] : sel.fanins)
+                        {
+                            const auto& in_sim  = nodes[option.node].sim_vars[option.out_port];
+                            const auto& out_sim = node.sim_vars[sel.dir_map[d]];
+
+                            for (auto idx = 0ul; idx < num_bits; ++idx)
+                            {
+                                add_clause({neg(sel.var), neg(gate), pos(in_sim[idx]), neg(out_sim[idx])});
+                                add_clause({neg(sel.var), neg(gate), neg(in_sim[idx]), pos(out_sim[idx])});
+                            }
+                        }
+
+                        continue;
+                    }
+
+                    const auto num_fanins = sel.fanins.size();
+
+                    for (const auto d : node.fanout_directions)
+                    {
+                        for (auto idx = 0ul; idx < num_bits; ++idx)
+                        {
+                            for (auto inputs = 0ull; inputs < (1ull << num_fanins); ++inputs)
+                            {
+                                std::vector<bill::lit_type> clause{neg(sel.var), neg(gate)};
+
+                                for (auto i = 0ul; i < num_fanins; ++i)
+                                {
+                                    const auto& option = sel.fanins[i].second;
+                                    const auto  in_var = nodes[option.node].sim_vars[option.out_port][idx];
+
+                                    clause.push_back(((inputs >> i) & 1u) != 0u ? neg(in_var) : pos(in_var));
+                                }
+
+                                const auto out_var = node.sim_vars[d][idx];
+                                clause.push_back(evaluate(g, inputs) ? pos(out_var) : neg(out_var));
+
+                                add_clause(clause);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    /**
+     * Ensures that every port is used at most once, that PIs are used at most once, and that every non-empty gate
+     * selects fanins matching its type.
+     */
+    void fanin_constraints()
+    {
+        for (const auto& node : nodes)
+        {
+            if (node.is_pi)
+            {
+                at_most_one(node.ref_vars);
+                continue;
+            }
+
+            std::vector<bill::var_type> svars{};
+            std::transform(node.selections.cbegin(), node.selections.cend(), std::back_inserter(svars),
+                           [](const auto& sel) { return sel.var; });
+
+            at_most_one(svars);
+
+            for (const auto d : {NORTH, EAST, SOUTH, WEST})
+            {
+                at_most_one(node.ref_var_direction_map[d]);
+            }
+
+            const auto empty = *gate_var(node, gate_type::EMPTY);
+
+            for (const auto& [g, gate] : node.gate_vars)
+            {
+                if (g == gate_type::EMPTY)
+                {
+                    continue;
+                }
+
+                std::vector<bill::lit_type> clause{pos(empty), neg(gate)};
+                for (const auto& sel : node.selections)
+                {
+                    if (sel.fanins.size() == fanin_size(g))
+                    {
+                        clause.push_back(pos(sel.var));
+                    }
+                }
+
+                add_clause(clause);
+            }
+        }
+    }
+    /**
+     * Links selection variables to connection variables and prevents all cycles of the clocking scheme's data flow
+     * from being realized.
+     */
+    void cycle_constraints()
+    {
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            for (const auto& [svar, out] : nodes[n].ref_var_map)
+            {
+                add_clause({neg(svar), pos(connection_vars.at({n, out}))});
+            }
+
+            for (const auto in : nodes[n].virtual_fanin)
+            {
+                std::vector<bill::lit_type> clause{neg(connection_vars.at({in, n}))};
+                for (const auto& [svar, out] : nodes[in].ref_var_map)
+                {
+                    if (out == n)
+                    {
+                        clause.push_back(pos(svar));
+                    }
+                }
+
+                add_clause(clause);
+            }
+        }
+
+        // every simple cycle is enumerated once from its smallest node
+        std::vector<uint64_t> path{};
+        std::vector<bool>     on_path(nodes.size(), false);
+
+        std::function<void(uint64_t, uint64_t)> find_cycles = [&](const uint64_t start, const uint64_t n)
+        {
+            path.push_back(n);
+            on_path[n] = true;
+
+            for (const auto out : nodes[n].virtual_fanout)
+            {
+                if (out == start)
+                {
+                    std::vector<bill::lit_type> clause{};
+                    for (auto i = 0ul; i < path.size(); ++i)
+                    {
+                        clause.push_back(neg(connection_vars.at({path[i], path[(i + 1) % path.size()]})));
+                    }
+
+                    add_clause(clause);
+                }
+                else if (out > start && !on_path[out])
+                {
+                    find_cycles(start, out);
+                }
+            }
+
+            on_path[n] = false;
+            path.pop_back();
+        };
+
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            find_cycles(n, n);
+        }
+    }
+    /**
+     * Fixes the simulation values of the PIs and assigns each PO to exactly one port realizing its function.
+     */
+    void io_constraints()
+    {
+        for (auto i = 0ul; i < num_pis; ++i)
+        {
+            for (auto idx = 0ul; idx < num_bits; ++idx)
+            {
+                const auto var = nodes[i].sim_vars[NONE][idx];
+                add_clause({((idx >> i) & 1u) != 0u ? pos(var) : neg(var)});
+            }
+        }
+
+        for (auto h = 0ul; h < outputs.size(); ++h)
+        {
+            std::vector<bill::var_type> houtvars{};
+            std::transform(outputs[h].cbegin(), outputs[h].cend(), std::back_inserter(houtvars),
+                           [](const auto& o) { return o.var; });
+
+            exactly_one(houtvars);
+
+            for (const auto& [var, n, d] : outputs[h])
+            {
+                for (auto idx = 0ul; idx < num_bits; ++idx)
+                {
+                    const auto sim = nodes[n].sim_vars[d][idx];
+                    add_clause({neg(var), kitty::get_bit(tts[h], idx) ? pos(sim) : neg(sim)});
+                }
+            }
+        }
+
+        // a PI and a PO cannot share the same port
+        for (const auto& houtvars : outputs)
+        {
+            for (const auto& [var, n, d] : houtvars)
+            {
+                for (const auto svar : nodes[n].svar_direction_map[d])
+                {
+                    add_clause({neg(svar), neg(var)});
+                }
+            }
+        }
+
+        // designated I/Os: only wires can have PI fanin or PO fanout and they may not have further fanouts
+        if (ps.io_pins)
+        {
+            for (auto i = 0ul; i < num_pis; ++i)
+            {
+                for (const auto& [svar, out] : nodes[i].ref_var_map)
+                {
+                    if (const auto wire = gate_var(nodes[out], gate_type::WIRE); wire.has_value())
+                    {
+                        add_clause({neg(svar), pos(*wire)});
+                    }
+                    else
+                    {
+                        add_clause({neg(svar)});
+                    }
+
+                    at_most_one(nodes[out].ref_vars, {neg(svar)});
+                }
+            }
+
+            for (const auto& houtvars : outputs)
+            {
+                for (const auto& [var, n, d] : houtvars)
+                {
+                    if (const auto wire = gate_var(nodes[n], gate_type::WIRE); wire.has_value())
+                    {
+                        add_clause({neg(var), pos(*wire)});
+                    }
+                    else
+                    {
+                        add_clause({neg(var)});
+                    }
+
+                    at_most_one(nodes[n].ref_vars, {neg(var)});
+                }
+            }
+        }
+    }
+    /**
+     * Assigns exactly one gate type to each tile and restricts the fanouts according to it.
+     */
+    void gate_constraints()
+    {
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            const auto& node = nodes[n];
+
+            std::vector<bill::var_type> gate_type_vars{};
+            std::transform(node.gate_vars.cbegin(), node.gate_vars.cend(), std::back_inserter(gate_type_vars),
+                           [](const auto& gv) { return gv.second; });
+
+            exactly_one(gate_type_vars);
+
+            const auto empty = *gate_var(node, gate_type::EMPTY);
+
+            // every non-empty gate is used at least once
+            std::vector<bill::lit_type> used{pos(empty)};
+            std::transform(node.ref_vars.cbegin(), node.ref_vars.cend(), std::back_inserter(used),
+                           [](const auto v) { return pos(v); });
+            add_clause(used);
+
+            // fanout restrictions: wires have up to three fanouts, crossings exactly two, and all other gates one
+            for (const auto& [g, gate] : node.gate_vars)
+            {
+                switch (g)
+                {
+                    case gate_type::EMPTY: break;
+                    case gate_type::WIRE: cardinality(node.ref_vars, 0ull, 3ull, {neg(gate)}); break;
+                    case gate_type::CROSS: cardinality(node.ref_vars, 2ull, 2ull, {neg(gate)}); break;
+                    default: cardinality(node.ref_vars, 1ull, 1ull, {neg(gate)}); break;
+                }
+            }
+
+            // empty tiles neither select fanins nor are selected and do not propagate signals
+            for (const auto& sel : node.selections)
+            {
+                add_clause({neg(empty), neg(sel.var)});
+            }
+            for (const auto ref : node.ref_vars)
+            {
+                add_clause({neg(empty), neg(ref)});
+            }
+            for (const auto d : node.fanout_directions)
+            {
+                for (const auto sim : node.sim_vars[d])
+                {
+                    add_clause({neg(empty), neg(sim)});
+                }
+            }
+        }
+    }
+    /**
+     * Symmetry breaking: disallow consecutive NOT gates.
+     */
+    void symmetry_constraints()
+    {
+        if (!ps.enable_not)
+        {
+            return;
+        }
+
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            const auto not_var = *gate_var(nodes[n], gate_type::NOT);
+
+            for (const auto& sel : nodes[n].selections)
+            {
+                if (sel.fanins.size() != 1)
+                {
+                    continue;
+                }
+
+                if (const auto in = sel.fanins[0].second.node; !nodes[in].is_pi)
+                {
+                    add_clause({neg(not_var), neg(sel.var), neg(*gate_var(nodes[in], gate_type::NOT))});
+                }
+            }
+        }
+    }
+    /**
+     * Solves the current instance under the assumption of its activation literal while respecting the timeout.
+     *
+     * @return `true` iff the current instance is SAT.
+     */
+    bool solve()
+    {
+        const std::vector<bill::lit_type> assumptions{pos(activation)};
+
+        if (ps.timeout == 0)
+        {
+            return solver.solve(assumptions) == bill::result::states::satisfiable;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        while (true)
+        {
+            if (const auto result = solver.solve(assumptions, CONFLICT_BUDGET);
+                result == bill::result::states::satisfiable || result == bill::result::states::unsatisfiable)
+            {
+                return result == bill::result::states::satisfiable;
+            }
+
+            if (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count() >=
+                ps.timeout)
+            {
+                throw one_pass_synthesis_timeout_exception();
+            }
+        }
+    }
+    /**
+     * Decodes gate types and selected fanins from the given model.
+     *
+     * @param model SAT model.
+     */
+    void decode(const bill::result::model_type& model)
+    {
+        const auto is_true = [&model](const bill::var_type v) { return model[v] == bill::lbool_type::true_; };
+
+        node_types.assign(nodes.size(), gate_type::EMPTY);
+        node_fanins.assign(nodes.size(), nullptr);
+        node_signals.assign(nodes.size(), {});
+        crossing_map.clear();
+
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            for (const auto& [g, gate] : nodes[n].gate_vars)
+            {
+                if (is_true(gate))
+                {
+                    node_types[n] = g;
+                }
+            }
+            for (const auto& sel : nodes[n].selections)
+            {
+                if (is_true(sel.var))
+                {
+                    node_fanins[n] = &sel;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] std::optional<uint64_t> pi_fanin(const uint64_t n) const noexcept
+    {
+        if (node_fanins[n] != nullptr)
+        {
+            for (const auto& [d, option] : node_fanins[n]->fanins)
+            {
+                if (nodes[option.node].is_pi)
+                {
+                    return option.node;
+                }
+            }
+        }
+
+        return std::nullopt;
+    }
+    // the signal that fanin n provides to node consumer; paths through crossings are created on-the-fly
+    mockturtle::signal<Lyt> fanin_signal(const uint64_t n, const uint64_t consumer)
+    {
+        if (node_types[n] != gate_type::CROSS)
+        {
+            return node_signals[n];
+        }
+
+        const auto incoming = fanin_signal(crossing_map.at({n, consumer}), n);
+
+        // switch to second layer if ground is already occupied
+        auto t = nodes[n].t;
+        if (!lyt.is_empty_tile(t))
+        {
+            t = lyt.above(t);
+        }
+
+        return lyt.create_buf(incoming, t);
+    }
+
+    std::vector<mockturtle::signal<Lyt>> get_fanins(const uint64_t n)
+    {
+        std::vector<mockturtle::signal<Lyt>> fanins{};
+
+        for (const auto& [d, option] : node_fanins[n]->fanins)
+        {
+            // skip PI nodes
+            if (nodes[option.node].is_pi)
+            {
+                continue;
+            }
+
+            fanins.push_back(fanin_signal(option.node, n));
+        }
+
+        return fanins;
+    }
+    /**
+     * Extracts a Lyt from the given model in the same way as it is done for Mugen's networks.
+     *
+     * @param model SAT model.
+     */
+    void to_gate_layout(const bill::result::model_type& model)
+    {
+        decode(model);
+
+        std::vector<bool>                      is_po(nodes.size(), false);
+        std::vector<std::pair<uint64_t, port>> po_ports{};
+        for (const auto& houtvars : outputs)
+        {
+            for (const auto& [var, n, d] : houtvars)
+            {
+                if (model[var] == bill::lbool_type::true_)
+                {
+                    is_po[n] = true;
+                    po_ports.emplace_back(n, d);
+                }
+            }
+        }
+
+        initialize_pis();
+
+        // first iteration: reserve the positions of all gates without assigning their incoming signals yet
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            const auto& t = nodes[n].t;
+
+            switch (node_types[n])
+            {
+                case gate_type::EMPTY: break;
+                case gate_type::WIRE:
+                {
+                    if (const auto pi = pi_fanin(n); pi.has_value())
+                    {
+                        node_signals[n] = lyt.move_node(pi_list[*pi], t);
+                    }
+                    else if (!is_po[n])
+                    {
+                        node_signals[n] = lyt.create_buf({}, t);
+                    }
+                    break;
+                }
+                case gate_type::CROSS:
+                {
+                    // store a (crossing, fanout) --> fanin relation for both fanins of the crossing
+                    for (const auto& [d, option] : node_fanins[n]->fanins)
+                    {
+                        crossing_map[{n, neighbor(n, node_fanins[n]->dir_map[d])}] = option.node;
+                    }
+                    break;
+                }
+                case gate_type::NOT: node_signals[n] = lyt.create_not({}, t); break;
+                case gate_type::AND: node_signals[n] = lyt.create_and({}, {}, t); break;
+                case gate_type::OR: node_signals[n] = lyt.create_or({}, {}, t); break;
+                case gate_type::MAJ: node_signals[n] = lyt.create_maj({}, {}, {}, t); break;
+            }
+        }
+
+        // second iteration: draw connections between the placed gates
+        for (auto n = num_pis; n < nodes.size(); ++n)
+        {
+            const auto g = node_types[n];
+
+            if (g == gate_type::EMPTY || g == gate_type::CROSS ||
+                (g == gate_type::WIRE && (is_po[n] || pi_fanin(n).has_value())))
+            {
+                continue;
+            }
+
+            lyt.move_node(lyt.get_node(node_signals[n]), nodes[n].t, get_fanins(n));
+        }
+
+        // third iteration: create primary outputs in order
+        for (auto h = 0ul; h < po_ports.size(); ++h)
+        {
+            const auto n         = po_ports[h].first;
+            const auto po_fanins = get_fanins(n);
+            // a PO should have only a single fanin
+            assert(po_fanins.size() == 1);
+
+            lyt.create_po(po_fanins[0], fmt::format("po{}", h), nodes[n].t);
+        }
+    }
+};
+
+template <typename Lyt, typename TT>
+class one_pass_synthesis_impl
+{
+  public:
+    one_pass_synthesis_impl(const std::vector<TT>& spec, const one_pass_synthesis_params<Lyt>& p,
+                            one_pass_synthesis_stats& st) :
+            tts{spec},
+            ps{p},
+            pst{st},
+            ari{ps.fixed_size ? static_cast<uint64_t>(ps.upper_bound_x * ps.upper_bound_y) : 0u}
+    {}
+
+    std::optional<Lyt> run()
+    {
+        // empty layout with an initial size of 1 x 1 tiles
+        Lyt layout{{0, 0}, *ps.scheme};
+
+        if (ps.engine == one_pass_synthesis_engine::BILL)
+        {
+            // handler for the native SAT encoding
+            bill_handler handler{tts, layout, ps};
+
+            return explore_aspect_ratios(layout, handler);
+        }
+
+#if (MUGEN)
+        // test for proper installation of all required Python libraries
+        if (!test_dependencies())
+        {
+            return std::nullopt;
+        }
+
+        // handler for the Python interaction
+        mugen_handler handler{tts, layout, ps};
+
+        return explore_aspect_ratios(layout, handler);
+#else
+        std::cout << "[e] Mugen is not available; pass -DFICTION_ENABLE_MUGEN=ON to the cmake call to enable it"
+                  << std::endl;
+
+        return std::nullopt;
+#endif
+    }
+
+  private:
+    const std::vector<TT> tts;
+
+    one_pass_synthesis_params<Lyt> ps;
+    one_pass_synthesis_stats&      pst;
+
+    /**
+     * Factorizes a number of layout tiles into all possible aspect ratios for iteration.
+     */
+    aspect_ratio_iterator<aspect_ratio<Lyt>> ari{0};
+
+#if (MUGEN)
+    class pysat_version_mismatch_exception : public std::exception
+    {
+      public:
+        explicit pysat_version_mismatch_exception(std::string v) : std::exception(), version{std::move(v)} {}
+
+        [[nodiscard]] std::string detected() const
+        {
+            return version;
+        }
+
+      private:
+        const std::string version;
+    };
+
+    /**
+     * Tests whether all needed dependencies have been installed and can be accessed via Python.
+     *
+     * @return `true` iff all dependencies are met.
+     */
+    [[nodiscard]] bool test_dependencies() const
+    {
+        namespace py = pybind11;
+        using namespace py::literals;
+
+        // test for graphviz
+        try
+        {
+            py::exec("import graphviz");
+        }
+        catch (...)
+        {
+            std::cout << "[e] Python module 'graphviz' could not be detected" << std::endl;
+            return false;
+        }
+
         // test for PySAT
         try
         {
-            py::exec("from pysat.solvers import Glucose3");
-            py::exec("from pysat.card import *");
+            py::exec("from pysat.solvers import Glucose3");
+            py::exec("from pysat.card import *");
+        }
+        catch (...)
+        {
+            std::cout << "[e] Python module 'PySAT' could not be detected" << std::endl;
+            return false;
+        }
+        try
+        {
+            const auto installed_pysat_version = py::str(py::module::import("pysat").attr("__version__"));
+
+            if (!installed_pysat_version.equal(py::str(REQUIRED_PYSAT_VERSION)))
+            {
+                throw pysat_version_mismatch_exception(installed_pysat_version);
+            }
+        }
+        catch (const pysat_version_mismatch_exception& e)
+        {
+            std::cout << fmt::format("[e] 'PySAT' version '{}' was detected, but version '{}' is specifically needed",
+                                     e.detected(), REQUIRED_PYSAT_VERSION)
+                      << std::endl;
+            return false;
+        }
+
+        // test for wrapt_timeout_decorator
+        try
+        {
+            py::exec("from wrapt_timeout_decorator import *");
+        }
+        catch (...)
+        {
+            std::cout << "[e] Python module 'wrapt_timeout_decorator' could not be detected" << std::endl;
+            return false;
+        }
+
+        // test for Mugen
+        try
+        {
+            // add Mugen's path to Python's sys.path module scope
+            pybind11::module::import("sys").attr("path").attr("append")(MUGEN_PATH);
+            pybind11::module::import("mugen");
+        }
+        catch (...)
+        {
+            std::cout << "[e] The 'mugen' library could not be detected; it might have been moved" << std::endl;
+        }
+
+        return true;
+    }
+#endif  // MUGEN
+    /**
+     * Explores the aspect ratios in ascending order of their areas until the first one is found on which the
+     * specification can be realized.
+     *
+     * @tparam Handler SAT back end handler type.
+     * @param layout The layout that is manipulated by `handler`.
+     * @param handler Handler that generates and solves the SAT instances.
+     * @return A layout on the smallest realizable aspect ratio if one is found; `std::nullopt`, otherwise.
+     */
+    template <typename Handler>
+    std::optional<Lyt> explore_aspect_ratios(Lyt& layout, Handler& handler)
+    {
+#if !defined(_WIN32)
+        if (ps.num_workers > 1)
+        {
+            return run_in_parallel(layout, handler);
+        }
+#endif
+
+        for (auto aspect_ratio = next_aspect_ratio(handler); aspect_ratio.has_value();
+             aspect_ratio      = next_aspect_ratio(handler))
+        {
+#if (PROGRESS_BARS)
+            mockturtle::progress_bar bar("[i] examining layout aspect ratios: {:>2} × {:<2}");
+            bar(aspect_ratio->x + 1, aspect_ratio->y + 1);
+#endif
+
+            handler.update_aspect_ratio(*aspect_ratio);
+
+            try
+            {
+                const auto sat =
+                    mockturtle::call_with_stopwatch(pst.time_total, [&handler] { return handler.is_satisfiable(); });
+
+                if (sat)  // solution found
+                {
+                    assign_layout_statistics(layout);
+
+                    return layout;
+                }
+                // update timeout and retry unless the time is up
+                if (ps.timeout)
+                {
+                    if (std::chrono::duration_cast<std::chrono::seconds>(pst.time_total).count() >= ps.timeout)
+                    {
+                        return std::nullopt;
+                    }
+
+                    update_timeout(handler, pst.time_total);
+                }
+            }
+            // timeout reached
+            catch (...)
+            {
+                return std::nullopt;
+            }
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Advances the aspect ratio iterator to the next aspect ratio that cannot be skipped.
+     *
+     * @param handler Handler that decides whether an aspect ratio is skippable.
+     * @return The next aspect ratio to explore or `std::nullopt` if all aspect ratios within the upper bounds have been
+     * explored.
+     */
+    template <typename Handler>
+    std::optional<aspect_ratio<Lyt>> next_aspect_ratio(const Handler& handler) noexcept
+    {
+        for (; ari <= static_cast<uint64_t>(ps.upper_bound_x) * static_cast<uint64_t>(ps.upper_bound_y);
+             ++ari)  // <= to prevent overflow
+        {
+            if (const auto ratio = typename Lyt::aspect_ratio{(*ari).x, (*ari).y, ps.crossings ? 1 : 0};
+                !handler.skippable(ratio))
+            {
+                ++ari;
+
+                return ratio;
+            }
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Stores statistical information about the given layout in the statistics object and restores its name.
+     *
+     * @param layout Resulting layout.
+     */
+    void assign_layout_statistics(Lyt& layout) const noexcept
+    {
+        pst.x_size    = layout.x() + 1;
+        pst.y_size    = layout.y() + 1;
+        pst.num_gates = layout.num_gates();
+        pst.num_wires = layout.num_wires();
+
+        // restore layout name
+        if constexpr (has_set_layout_name_v<Lyt>)
+        {
+            layout.set_layout_name(ps.name);
+        }
+    }
+#if !defined(_WIN32)
+    /**
+     * A worker process that checks a single aspect ratio for realizability.
+     */
+    struct worker
+    {
+        /**
+         * Process ID.
+         */
+        pid_t pid;
+        /**
+         * Position of the explored aspect ratio in the order of exploration.
+         */
+        uint64_t index;
+        /**
+         * The explored aspect ratio.
+         */
+        aspect_ratio<Lyt> ratio;
+        /**
+         * Read end of the pipe via which the worker sends its layout in case the aspect ratio is realizable.
+         */
+        int fd;
+    };
+    /**
+     * Exit codes of the worker processes.
+     */
+    enum worker_status : int
+    {
+        REALIZABLE   = 0,
+        UNREALIZABLE = 1,
+        ABORTED      = 2
+    };
+    /**
+     * Appends the given string to a sequence of words as its length followed by its characters, which are padded to
+     * full words.
+     *
+     * @param words Sequence of words to extend.
+     * @param str String to append.
+     */
+    static void serialize_string(std::vector<uint64_t>& words, const std::string& str)
+    {
+        words.push_back(str.size());
+
+        const auto first = words.size();
+        words.resize(first + (str.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0ull);
+        std::copy(str.cbegin(), str.cend(), reinterpret_cast<char*>(words.data() + first));
+    }
+    /**
+     * Serializes the given layout into a sequence of words that can be sent from a worker process to its parent. PIs
+     * and POs are stored in order together with their names. Gates are stored with their functions and fanins. Each
+     * node is represented by its tile.
+     *
+     * @param lyt Layout to serialize.
+     * @return Serialized layout.
+     */
+    [[nodiscard]] static std::vector<uint64_t> serialize_layout(const Lyt& lyt)
+    {
+        std::vector<uint64_t> words{};
+
+        words.push_back(lyt.num_pis());
+        lyt.foreach_pi(
+            [&lyt, &words](const auto& pi)
+            {
+                words.push_back(lyt.make_signal(pi));
+                serialize_string(words, lyt.get_name(pi));
+            });
+
+        std::vector<uint64_t> gates{};
+        uint64_t              num_gates = 0ull;
+        lyt.foreach_node(
+            [&lyt, &gates, &num_gates](const auto& n)
+            {
+                if (lyt.is_constant(n) || lyt.is_pi(n) || lyt.is_po(n))
+                {
+                    return;
+                }
+
+                const auto tt = lyt.node_function(n);
+
+                gates.push_back(lyt.make_signal(n));
+                gates.push_back(tt.num_vars());
+                gates.insert(gates.end(), tt.cbegin(), tt.cend());
+
+                std::vector<uint64_t> fanins{};
+                lyt.foreach_fanin(n, [&fanins](const auto& fi) { fanins.push_back(fi); });
+                gates.push_back(fanins.size());
+                gates.insert(gates.end(), fanins.cbegin(), fanins.cend());
+
+                ++num_gates;
+            });
+
+        words.push_back(num_gates);
+        words.insert(words.end(), gates.cbegin(), gates.cend());
+
+        words.push_back(lyt.num_pos());
+        for (auto i = 0u; i < lyt.num_pos(); ++i)
+        {
+            const auto po = lyt.get_node(lyt.po_at(i));
+
+            words.push_back(lyt.make_signal(po));
+            lyt.foreach_fanin(po, [&words](const auto& fi) { words.push_back(fi); });
+            serialize_string(words, lyt.get_output_name(i));
         }
-        catch (...)
+
+        return words;
+    }
+    /**
+     * Recreates a layout that was serialized via `serialize_layout` on the given one, which is expected to be empty
+     * and of the same aspect ratio. All nodes are created from their actual fanins via a gate_level_layout_builder,
+     * which commits them in a single pass such that the order of the gates does not matter.
+     *
+     * @param lyt Empty layout to recreate the serialized one on.
+     * @param words Serialized layout.
+     * @return `true` iff `words` was a complete serialization.
+     */
+    [[nodiscard]] static bool deserialize_layout(Lyt& lyt, const std::vector<uint64_t>& words)
+    {
+        auto pos = 0ul;
+
+        const auto next = [&words, &pos]() -> std::optional<uint64_t>
+        {
+            if (pos >= words.size())
+            {
+                return std::nullopt;
+            }
+
+            return words[pos++];
+        };
+
+        const auto next_string = [&words, &pos, &next]() -> std::optional<std::string>
+        {
+            const auto length = next();
+            if (!length.has_value())
+            {
+                return std::nullopt;
+            }
+
+            const auto num_words = (*length + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+            if (pos + num_words > words.size())
+            {
+                return std::nullopt;
+            }
+
+            const auto* first = reinterpret_cast<const char*>(words.data() + pos);
+            pos += num_words;
+
+            return std::string(first, first + *length);
+        };
+
+        gate_level_layout_builder<Lyt> builder{lyt};
+
+        const auto num_pis = next();
+        if (!num_pis.has_value())
         {
-            std::cout << "[e] Python module 'PySAT' could not be detected" << std::endl;
             return false;
         }
-        try
+        for (auto i = 0ull; i < *num_pis; ++i)
         {
-            const auto installed_pysat_version = py::str(py::module::import("pysat").attr("__version__"));
+            const auto t    = next();
+            const auto name = next_string();
+            if (!t.has_value() || !name.has_value())
+            {
+                return false;
+            }
 
-            if (!installed_pysat_version.equal(py::str(REQUIRED_PYSAT_VERSION)))
+            builder.create_pi(*name, static_cast<tile<Lyt>>(*t));
+        }
+
+        const auto num_gates = next();
+        if (!num_gates.has_value())
+        {
+            return false;
+        }
+        for (auto i = 0ull; i < *num_gates; ++i)
+        {
+            const auto t        = next();
+            const auto num_vars = next();
+            if (!t.has_value() || !num_vars.has_value())
             {
-                throw pysat_version_mismatch_exception(installed_pysat_version);
+                return false;
+            }
+
+            kitty::dynamic_truth_table tt{static_cast<uint32_t>(*num_vars)};
+            for (auto& block : tt)
+            {
+                const auto b = next();
+                if (!b.has_value())
+                {
+                    return false;
+                }
+
+                block = *b;
+            }
+
+            const auto num_fanins = next();
+            if (!num_fanins.has_value())
+            {
+                return false;
+            }
+
+            std::vector<mockturtle::signal<Lyt>> fanins{};
+            for (auto f = 0ull; f < *num_fanins; ++f)
+            {
+                const auto fi = next();
+                if (!fi.has_value())
+                {
+                    return false;
+                }
+
+                fanins.push_back(*fi);
             }
+
+            builder.create_node(fanins, tt, static_cast<tile<Lyt>>(*t));
         }
-        catch (const pysat_version_mismatch_exception& e)
+
+        const auto num_pos = next();
+        if (!num_pos.has_value())
         {
-            std::cout << fmt::format("[e] 'PySAT' version '{}' was detected, but version '{}' is specifically needed",
-                                     e.detected(), REQUIRED_PYSAT_VERSION)
-                      << std::endl;
             return false;
         }
+        for (auto i = 0ull; i < *num_pos; ++i)
+        {
+            const auto t    = next();
+            const auto fi   = next();
+            const auto name = next_string();
+            if (!t.has_value() || !fi.has_value() || !name.has_value())
+            {
+                return false;
+            }
 
-        // test for wrapt_timeout_decorator
-        try
+            builder.create_po(*fi, *name, static_cast<tile<Lyt>>(*t));
+        }
+
+        builder.finalize();
+
+        return pos == words.size();
+    }
+    /**
+     * Writes all given words to the file descriptor `fd`.
+     *
+     * @param fd File descriptor to write to.
+     * @param words Words to write.
+     * @return `true` iff all words were written.
+     */
+    static bool write_words(const int fd, const std::vector<uint64_t>& words) noexcept
+    {
+        const auto* data      = reinterpret_cast<const char*>(words.data());
+        auto        remaining = words.size() * sizeof(uint64_t);
+
+        while (remaining > 0)
         {
-            py::exec("from wrapt_timeout_decorator import *");
+            const auto written = write(fd, data, remaining);
+
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                return false;
+            }
+
+            data += written;
+            remaining -= static_cast<std::size_t>(written);
         }
-        catch (...)
+
+        return true;
+    }
+    /**
+     * Reads words from the file descriptor `fd` until the end of file is reached.
+     *
+     * @param fd File descriptor to read from.
+     * @return All words that were read or `std::nullopt` if reading failed.
+     */
+    [[nodiscard]] static std::optional<std::vector<uint64_t>> read_words(const int fd)
+    {
+        std::vector<char> bytes{};
+        std::array<char, 4096> buffer{};
+
+        while (true)
         {
-            std::cout << "[e] Python module 'wrapt_timeout_decorator' could not be detected" << std::endl;
-            return false;
+            const auto num_read = read(fd, buffer.data(), buffer.size());
+
+            if (num_read < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                return std::nullopt;
+            }
+            if (num_read == 0)
+            {
+                break;
+            }
+
+            bytes.insert(bytes.end(), buffer.cbegin(), buffer.cbegin() + num_read);
         }
 
-        // test for Mugen
-        try
+        if (bytes.size() % sizeof(uint64_t) != 0)
         {
-            // add Mugen's path to Python's sys.path module scope
-            pybind11::module::import("sys").attr("path").attr("append")(MUGEN_PATH);
-            pybind11::module::import("mugen");
+            return std::nullopt;
         }
-        catch (...)
+
+        std::vector<uint64_t> words(bytes.size() / sizeof(uint64_t));
+        std::copy(bytes.cbegin(), bytes.cend(), reinterpret_cast<char*>(words.data()));
+
+        return words;
+    }
+    /**
+     * Explores up to `num_workers` aspect ratios simultaneously in forked worker processes. Since aspect ratios are
+     * dispatched in the same order as in the sequential exploration, a realizable aspect ratio is optimal once all
+     * previously dispatched ones have been proven unrealizable. Workers on larger aspect ratios are killed as soon as a
+     * realizable one is found. The parent process blocks until a worker finishes and takes over the layout that the
+     * worker sends back instead of solving the aspect ratio once more.
+     *
+     * @tparam Handler SAT back end handler type.
+     * @param layout The layout that is manipulated by `handler`.
+     * @param handler Handler that generates and solves the SAT instances.
+     * @return A layout on the smallest realizable aspect ratio if one is found; `std::nullopt`, otherwise.
+     */
+    template <typename Handler>
+    std::optional<Lyt> run_in_parallel(Lyt& layout, Handler& handler)
+    {
+        mockturtle::stopwatch stop{pst.time_total};
+
+        const auto start = std::chrono::steady_clock::now();
+
+        // remaining time in seconds; 0 means that the time is up
+        const auto time_left = [this, &start]() -> uint32_t
         {
-            std::cout << "[e] The 'mugen' library could not be detected; it might have been moved" << std::endl;
+            const auto time_elapsed =
+                std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count();
+
+            return ps.timeout > time_elapsed ? static_cast<uint32_t>(ps.timeout - time_elapsed) : 0u;
+        };
+
+        std::vector<worker>     workers{};
+        std::optional<worker>   realizable{};
+        std::vector<uint64_t>   realizable_layout{};
+        std::optional<uint64_t> first_aborted{};
+
+        uint64_t index       = 0ull;
+        bool     dispatching = true;
+
+        // kills and reaps all workers exploring aspect ratios after the given index
+        const auto cancel_after = [&workers](const uint64_t i)
+        {
+            workers.erase(std::remove_if(workers.begin(), workers.end(),
+                                         [i](const auto& w)
+                                         {
+                                             if (w.index > i)
+                                             {
+                                                 kill(w.pid, SIGKILL);
+                                                 waitpid(w.pid, nullptr, 0);
+                                                 close(w.fd);
+
+                                                 return true;
+                                             }
+
+                                             return false;
+                                         }),
+                          workers.end());
+        };
+
+        while (true)
+        {
+            while (dispatching && workers.size() < ps.num_workers)
+            {
+                const auto ratio = next_aspect_ratio(handler);
+
+                if (!ratio.has_value())
+                {
+                    dispatching = false;
+                    break;
+                }
+
+                if (ps.timeout)
+                {
+                    if (const auto remaining = time_left(); remaining > 0)
+                    {
+                        handler.update_timeout(remaining);
+                    }
+                    else
+                    {
+                        first_aborted = std::min(first_aborted.value_or(index), index);
+                        dispatching   = false;
+                        break;
+                    }
+                }
+
+                handler.update_aspect_ratio(*ratio);
+
+                std::array<int, 2> channel{};
+                if (pipe(channel.data()) != 0)  // no further pipe could be opened; evaluate the running workers
+                {
+                    dispatching = false;
+                    break;
+                }
+
+                // prevent buffered output from being duplicated in the child process
+                std::cout.flush();
+
+#if (MUGEN)
+                PyOS_BeforeFork();
+#endif
+                const auto pid = fork();
+
+                if (pid == 0)  // worker process
+                {
+#if (MUGEN)
+                    PyOS_AfterFork_Child();
+#endif
+                    close(channel[0]);
+
+                    auto status = worker_status::ABORTED;
+                    try
+                    {
+                        if (handler.is_satisfiable())
+                        {
+                            // send the layout to the parent process; the handler operates on `layout`
+                            status = write_words(channel[1], serialize_layout(layout)) ? worker_status::REALIZABLE :
+                                                                                         worker_status::ABORTED;
+                        }
+                        else
+                        {
+                            status = worker_status::UNREALIZABLE;
+                        }
+                    }
+                    catch (...)
+                    {}
+
+                    close(channel[1]);
+
+                    // skip all destructors and exit handlers, including the ones of the Python interpreter
+                    _exit(status);
+                }
+
+#if (MUGEN)
+                PyOS_AfterFork_Parent();
+#endif
+                close(channel[1]);
+
+                if (pid < 0)  // no further process could be spawned; evaluate the ones that are already running
+                {
+                    close(channel[0]);
+                    dispatching = false;
+                    break;
+                }
+
+                workers.push_back({pid, index++, *ratio, channel[0]});
+            }
+
+            if (workers.empty())
+            {
+                break;
+            }
+
+            // block until any of the workers closes its pipe, i.e., finishes
+            std::vector<pollfd> fds{};
+            fds.reserve(workers.size());
+            std::transform(workers.cbegin(), workers.cend(), std::back_inserter(fds),
+                           [](const auto& w) { return pollfd{w.fd, POLLIN, 0}; });
+
+            if (poll(fds.data(), fds.size(), -1) < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                // the workers cannot be observed anymore; treat all of them as aborted
+                const auto first = workers.front().index;
+                first_aborted    = std::min(first_aborted.value_or(first), first);
+
+                cancel_after(first);
+                kill(workers.front().pid, SIGKILL);
+                waitpid(workers.front().pid, nullptr, 0);
+                close(workers.front().fd);
+
+                break;
+            }
+
+            const auto ready = std::find_if(fds.cbegin(), fds.cend(), [](const auto& p) { return p.revents != 0; });
+            const auto it    = workers.begin() + std::distance(fds.cbegin(), ready);
+            const auto finished = *it;
+            workers.erase(it);
+
+            // the worker writes its entire layout before exiting; hence, reading blocks until its end
+            const auto words = read_words(finished.fd);
+            close(finished.fd);
+
+            auto status = 0;
+            waitpid(finished.pid, &status, 0);
+
+            auto exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : worker_status::ABORTED;
+            if (exit_code == worker_status::REALIZABLE && !words.has_value())
+            {
+                exit_code = worker_status::ABORTED;
+            }
+
+            if (exit_code == worker_status::REALIZABLE)
+            {
+                if (!realizable.has_value() || finished.index < realizable->index)
+                {
+                    realizable        = finished;
+                    realizable_layout = *words;
+                }
+
+                cancel_after(finished.index);
+                dispatching = false;
+            }
+            else if (exit_code != worker_status::UNREALIZABLE)
+            {
+                // no aspect ratio after this one can be proven optimal anymore
+                first_aborted = std::min(first_aborted.value_or(finished.index), finished.index);
+
+                cancel_after(finished.index);
+                dispatching = false;
+            }
         }
 
-        return true;
+        if (!realizable.has_value() || (first_aborted.has_value() && *first_aborted < realizable->index))
+        {
+            return std::nullopt;
+        }
+
+        // recreate the layout that the worker found on the smallest realizable aspect ratio
+        Lyt result{realizable->ratio, *ps.scheme};
+
+        if (!deserialize_layout(result, realizable_layout))
+        {
+            return std::nullopt;
+        }
+
+        assign_layout_statistics(result);
+
+        return result;
     }
+#endif
     /**
      * Calculates the time left for solving by subtracting the time passed from the configured timeout and updates
-     * Mugen's timeout accordingly.
+     * the handler's timeout accordingly.
      *
      * @param handler Handler whose timeout is to be updated.
      * @param time Time passed since beginning of the solving process.
      */
-    void update_timeout(mugen_handler<Lyt, TT>& handler, const mockturtle::stopwatch<>::duration time) const noexcept
+    template <typename Handler>
+    void update_timeout(Handler& handler, const mockturtle::stopwatch<>::duration time) const noexcept
     {
         const auto time_elapsed = std::chrono::duration_cast<std::chrono::seconds>(time).count();
         // remaining time must be 1 because 0 means unlimited time
@@ -904,8 +2860,6 @@ class one_pass_synthesis_impl
     }
 };
 
-#pragma GCC visibility pop
-
 }  // namespace detail
 
 /**
@@ -924,8 +2878,8 @@ class one_pass_synthesis_impl
  * are combinations of constraints for which no valid solution under the given parameters might exist. It is, thus,
  * prudent to always provide a timeout limit.
  *
- * This implementation relies on Mugen, a framework for one-pass synthesis of FCN circuit layouts developed by Winston
- * Haaswijk. It can be found on GitHub: https://github.com/whaaswijk/mugen
+ * Two SAT back ends are available. The original implementation relies on Mugen, a framework for one-pass synthesis of
+ * FCN circuit layouts developed by Winston Haaswijk. It can be found on GitHub: https://github.com/whaaswijk/mugen
  *
  * Since Mugen is written in Python3, fiction uses pybind11 for interoperability. This can lead to performance and
  * integration issues. Mugen requires the following Python3 packages to be installed:
@@ -933,8 +2887,11 @@ class one_pass_synthesis_impl
  * - `python-sat`
  * - `wrapt_timeout_decorator`
  *
- * Due to the integration hassle, possible performance issues, and its experimental status this approach is excluded
- * from (CLI) compilation by default. To enable it, pass `-DFICTION_ENABLE_MUGEN=ON` to the cmake call.
+ * Due to the integration hassle, possible performance issues, and its experimental status the Mugen back end is
+ * excluded from compilation by default. To enable it, pass `-DFICTION_ENABLE_MUGEN=ON` to the cmake call.
+ *
+ * Alternatively, the same encoding is generated natively in C++ and solved via bill (see
+ * `one_pass_synthesis_engine::BILL`), which does not require a Python runtime at all.
  *
  * @tparam Lyt Gate-level layout type to generate.
  * @tparam TT Truth table type used as specification.
@@ -1009,6 +2966,4 @@ std::optional<Lyt> one_pass_synthesis(const Ntk& ntk, const one_pass_synthesis_p
 
 }  // namespace fiction
 
-#endif  // MUGEN
-
 #endif  // FICTION_ONE_PASS_SYNTHESIS_HPP
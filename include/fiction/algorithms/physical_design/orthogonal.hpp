@@ -6,10 +6,13 @@
 #define FICTION_ORTHOGONAL_HPP
 
 #include "fiction/algorithms/network_transformation/fanout_substitution.hpp"
+#include "fiction/algorithms/physical_design/hexagonalization.hpp"
 #include "fiction/io/print_layout.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/layouts/gate_level_layout.hpp"
 #include "fiction/networks/views/edge_color_view.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/types.hpp"
 #include "fiction/utils/name_utils.hpp"
 #include "fiction/utils/network_utils.hpp"
 #include "fiction/utils/placement_utils.hpp"
@@ -22,8 +25,16 @@
 #include <mockturtle/views/topo_view.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
 #include <optional>
 #include <set>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #if (PROGRESS_BARS)
@@ -42,21 +53,30 @@ struct orthogonal_physical_design_params
      * Number of clock phases to use. 3 and 4 are supported.
      */
     num_clks number_of_clock_phases = num_clks::FOUR;
+    /**
+     * Number of threads to use for the east-south edge coloring. The result is independent of this value.
+     */
+    std::size_t num_threads = 1ul;
 };
 
 struct orthogonal_physical_design_stats
 {
     mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Time spent on the east-south edge coloring (included in `time_total`).
+     */
+    mockturtle::stopwatch<>::duration time_coloring{0};
 
     uint64_t x_size{0ull}, y_size{0ull};
     uint64_t num_gates{0ull}, num_wires{0ull};
 
     void report(std::ostream& out = std::cout) const
     {
-        out << fmt::format("[i] total time  = {:.2f} secs\n", mockturtle::to_seconds(time_total));
-        out << fmt::format("[i] layout size = {} × {}\n", x_size, y_size);
-        out << fmt::format("[i] num. gates  = {}\n", num_gates);
-        out << fmt::format("[i] num. wires  = {}\n", num_wires);
+        out << fmt::format("[i] total time    = {:.2f} secs\n", mockturtle::to_seconds(time_total));
+        out << fmt::format("[i] coloring time = {:.2f} secs\n", mockturtle::to_seconds(time_coloring));
+        out << fmt::format("[i] layout size   = {} × {}\n", x_size, y_size);
+        out << fmt::format("[i] num. gates    = {}\n", num_gates);
+        out << fmt::format("[i] num. wires    = {}\n", num_wires);
     }
 };
 
@@ -112,42 +132,69 @@ struct coloring_container
     }
 };
 
+/**
+ * Paints the given edge in the given color and propagates the opposite color to the outgoing edges of its source and
+ * the same color to the other incoming edges of its target. Since this propagation can cascade through large parts of
+ * the network, it is performed iteratively with an explicit stack in depth-first order instead of recursively.
+ *
+ * @param ctn Coloring container.
+ * @param e Edge to paint.
+ * @param c Color to paint `e` with.
+ */
 template <typename Ntk>
-void recursively_paint_edges(const coloring_container<Ntk>&                             ctn,
-                             const mockturtle::edge<out_of_place_edge_color_view<Ntk>>& e, const uint32_t c) noexcept
+void paint_edges(const coloring_container<Ntk>& ctn, const mockturtle::edge<out_of_place_edge_color_view<Ntk>>& e,
+                 const uint32_t c) noexcept
 {
-    // exit condition: edge is already painted
-    if (ctn.color_ntk.edge_color(e) != ctn.color_null)
+    using edge = mockturtle::edge<out_of_place_edge_color_view<Ntk>>;
+
+    std::vector<std::pair<edge, uint32_t>> stack{{e, c}};
+
+    while (!stack.empty())
     {
-        return;
-    }
+        // structured bindings cannot be captured by the lambdas below in C++17
+        const auto ce = stack.back().first;
+        const auto cc = stack.back().second;
+        stack.pop_back();
 
-    // paint edge with given color
-    ctn.color_ntk.paint_edge(e, c);
+        // skip edges that are already painted
+        if (ctn.color_ntk.edge_color(ce) != ctn.color_null)
+        {
+            continue;
+        }
 
-    // paint children edges
-    foreach_outgoing_edge(ctn.color_ntk, e.source,
-                          [&ctn, &e, &c](const auto& oe)
-                          {
-                              if (oe != e)
-                              {
-                                  recursively_paint_edges(ctn, oe, ctn.opposite_color(c));
-                              }
-                          });
+        // paint edge with given color
+        ctn.color_ntk.paint_edge(ce, cc);
 
-    // paint spouse edges
-    foreach_incoming_edge(ctn.color_ntk, e.target,
-                          [&ctn, &e, &c](const auto& ie)
-                          {
-                              if (ie != e)
+        // edges are pushed in reverse to visit them in the same order as a recursive traversal would; they are
+        // collected first since edges are not swappable
+        std::vector<std::pair<edge, uint32_t>> next{};
+
+        // children edges are processed first
+        foreach_outgoing_edge(ctn.color_ntk, ce.source,
+                              [&ctn, &next, &ce, &cc](const auto& oe)
+                              {
+                                  if (oe != ce)
+                                  {
+                                      next.emplace_back(oe, ctn.opposite_color(cc));
+                                  }
+                              });
+
+        // spouse edges are processed afterwards
+        foreach_incoming_edge(ctn.color_ntk, ce.target,
+                              [&next, &ce, &cc](const auto& ie)
                               {
-                                  recursively_paint_edges(ctn, ie, c);
-                              }
-                          });
+                                  if (ie != ce)
+                                  {
+                                      next.emplace_back(ie, cc);
+                                  }
+                              });
+
+        std::for_each(next.crbegin(), next.crend(), [&stack](const auto& ne) { stack.push_back(ne); });
+    }
 }
 
 template <typename Ntk>
-coloring_container<Ntk> east_south_edge_coloring(const Ntk& ntk) noexcept
+coloring_container<Ntk> sequential_east_south_edge_coloring(const Ntk& ntk) noexcept
 {
     coloring_container<Ntk> ctn{ntk};
     mockturtle::topo_view   rtv{ntk};
@@ -171,7 +218,7 @@ coloring_container<Ntk> east_south_edge_coloring(const Ntk& ntk) noexcept
                     ctn.color_south;
 
             std::for_each(finc.fanin_edges.cbegin(), finc.fanin_edges.cend(),
-                          [&ctn, &color](const auto& fe) { recursively_paint_edges(ctn, fe, color); });
+                          [&ctn, &color](const auto& fe) { paint_edges(ctn, fe, color); });
 
             // if all incoming edges are colored east, paint the node east as well
             if (std::all_of(finc.fanin_edges.cbegin(), finc.fanin_edges.cend(),
@@ -194,6 +241,288 @@ coloring_container<Ntk> east_south_edge_coloring(const Ntk& ntk) noexcept
 
     return ctn;
 }
+/**
+ * Computes the same east-south edge coloring as `sequential_east_south_edge_coloring` using multiple threads.
+ *
+ * Painting an edge cascades to its siblings (the other outgoing edges of its source) and spouses (the other incoming
+ * edges of its target) only. Hence, the edges decompose into independent components of the relation induced by shared
+ * sources and targets, and each gate's decision solely depends on edges of the component of its incoming edges. The
+ * components are processed concurrently, each in the same reverse topological order as the sequential variant, which
+ * yields an identical coloring. To this end, edges are stored densely in compressed adjacency arrays and their colors
+ * are written back to the view once all threads have finished.
+ *
+ * @tparam Ntk Logic network type.
+ * @param ntk Network to color.
+ * @param num_threads Number of threads to use.
+ * @return Coloring container that holds the colored network.
+ */
+template <typename Ntk>
+coloring_container<Ntk> parallel_east_south_edge_coloring(const Ntk& ntk, const std::size_t num_threads) noexcept
+{
+    coloring_container<Ntk> ctn{ntk};
+    mockturtle::topo_view   rtv{ntk};
+
+    const auto& cntk = ctn.color_ntk;
+
+    using edge = mockturtle::edge<out_of_place_edge_color_view<Ntk>>;
+
+    const auto num_nodes = static_cast<std::size_t>(cntk.size());
+
+    // incoming edges of each node in fanin order; duplicate edges are identified by the same ID
+    std::vector<edge>        edges{};
+    std::vector<std::size_t> in_offset(num_nodes + 1, 0ul), out_offset(num_nodes + 1, 0ul);
+    std::vector<std::size_t> in_ids{}, out_ids{};
+
+    const auto find_incoming_id = [&](const edge& e) -> std::optional<std::size_t>
+    {
+        const auto t = static_cast<std::size_t>(cntk.node_to_index(e.target));
+
+        for (auto k = in_offset[t]; k < in_offset[t + 1]; ++k)
+        {
+            if (edges[in_ids[k]] == e)
+            {
+                return in_ids[k];
+            }
+        }
+
+        return std::nullopt;
+    };
+
+    for (std::size_t i = 0; i < num_nodes; ++i)
+    {
+        in_offset[i] = in_ids.size();
+
+        foreach_incoming_edge(cntk, cntk.index_to_node(static_cast<uint32_t>(i)),
+                              [&](const auto& e)
+                              {
+                                  for (auto k = in_offset[i]; k < in_ids.size(); ++k)
+                                  {
+                                      if (edges[in_ids[k]] == e)
+                                      {
+                                          in_ids.push_back(in_ids[k]);
+                                          return;
+                                      }
+                                  }
+
+                                  in_ids.push_back(edges.size());
+                                  edges.push_back(e);
+                              });
+    }
+    in_offset[num_nodes] = in_ids.size();
+
+    // outgoing edges of each node in fanout order
+    for (std::size_t i = 0; i < num_nodes; ++i)
+    {
+        out_offset[i] = out_ids.size();
+
+        foreach_outgoing_edge(cntk, cntk.index_to_node(static_cast<uint32_t>(i)),
+                              [&](const auto& e)
+                              {
+                                  if (const auto id = find_incoming_id(e); id.has_value())
+                                  {
+                                      out_ids.push_back(*id);
+                                  }
+                              });
+    }
+    out_offset[num_nodes] = out_ids.size();
+
+    // union-find over edges that share a source or a target
+    std::vector<std::size_t> parent(edges.size());
+    std::iota(parent.begin(), parent.end(), 0ul);
+
+    const auto find = [&parent](std::size_t x)
+    {
+        while (parent[x] != x)
+        {
+            parent[x] = parent[parent[x]];
+            x         = parent[x];
+        }
+
+        return x;
+    };
+
+    const auto unite_range = [&find, &parent](const std::vector<std::size_t>& ids, const std::size_t begin,
+                                              const std::size_t end)
+    {
+        for (auto k = begin + 1; k < end; ++k)
+        {
+            parent[find(ids[k])] = find(ids[begin]);
+        }
+    };
+
+    for (std::size_t i = 0; i < num_nodes; ++i)
+    {
+        unite_range(in_ids, in_offset[i], in_offset[i + 1]);
+        unite_range(out_ids, out_offset[i], out_offset[i + 1]);
+    }
+
+    // distribute the gates in reverse topological order to the components of their incoming edges
+    std::vector<std::vector<std::size_t>> components{};
+    std::vector<std::size_t>              component_of(edges.size(), std::numeric_limits<std::size_t>::max());
+    std::vector<uint32_t>                 edge_colors(edges.size(), ctn.color_null);
+    std::vector<uint32_t>                 node_colors(num_nodes, ctn.color_null);
+
+    const auto is_constant_edge = [&cntk, &edges](const std::size_t id) { return cntk.is_constant(edges[id].source); };
+
+    rtv.foreach_gate_reverse(
+        [&](const auto& n)
+        {
+            const auto i = static_cast<std::size_t>(cntk.node_to_index(n));
+
+            const auto first = std::find_if_not(in_ids.cbegin() + static_cast<std::ptrdiff_t>(in_offset[i]),
+                                                in_ids.cbegin() + static_cast<std::ptrdiff_t>(in_offset[i + 1]),
+                                                is_constant_edge);
+
+            // gates without non-constant fanins are always colored east
+            if (first == in_ids.cbegin() + static_cast<std::ptrdiff_t>(in_offset[i + 1]))
+            {
+                node_colors[i] = ctn.color_east;
+                return;
+            }
+
+            auto& c = component_of[find(*first)];
+            if (c == std::numeric_limits<std::size_t>::max())
+            {
+                c = components.size();
+                components.emplace_back();
+            }
+
+            components[c].push_back(i);
+        });
+
+    const auto paint_edges_locally = [&](const std::size_t id, const uint32_t color)
+    {
+        std::vector<std::pair<std::size_t, uint32_t>> stack{{id, color}};
+
+        while (!stack.empty())
+        {
+            const auto [ce, cc] = stack.back();
+            stack.pop_back();
+
+            if (edge_colors[ce] != ctn.color_null)
+            {
+                continue;
+            }
+
+            edge_colors[ce] = cc;
+
+            const auto top = stack.size();
+
+            const auto src = static_cast<std::size_t>(cntk.node_to_index(edges[ce].source));
+            for (auto k = out_offset[src]; k < out_offset[src + 1]; ++k)
+            {
+                if (out_ids[k] != ce)
+                {
+                    stack.emplace_back(out_ids[k], ctn.opposite_color(cc));
+                }
+            }
+
+            const auto tgt = static_cast<std::size_t>(cntk.node_to_index(edges[ce].target));
+            for (auto k = in_offset[tgt]; k < in_offset[tgt + 1]; ++k)
+            {
+                if (in_ids[k] != ce)
+                {
+                    stack.emplace_back(in_ids[k], cc);
+                }
+            }
+
+            std::reverse(stack.begin() + static_cast<std::ptrdiff_t>(top), stack.end());
+        }
+    };
+
+    const auto color_component = [&](const std::vector<std::size_t>& gates)
+    {
+        for (const auto i : gates)
+        {
+            std::vector<std::size_t> finc{};
+            for (auto k = in_offset[i]; k < in_offset[i + 1]; ++k)
+            {
+                if (!is_constant_edge(in_ids[k]))
+                {
+                    finc.push_back(in_ids[k]);
+                }
+            }
+
+            // if any incoming edge is colored east, color them all east, and south otherwise
+            const auto color = std::any_of(finc.cbegin(), finc.cend(),
+                                           [&](const auto fe) { return edge_colors[fe] == ctn.color_east; }) ?
+                                   ctn.color_east :
+                                   ctn.color_south;
+
+            std::for_each(finc.cbegin(), finc.cend(), [&](const auto fe) { paint_edges_locally(fe, color); });
+
+            if (std::all_of(finc.cbegin(), finc.cend(),
+                            [&](const auto fe) { return edge_colors[fe] == ctn.color_east; }))
+            {
+                node_colors[i] = ctn.color_east;
+            }
+            else if (std::all_of(finc.cbegin(), finc.cend(),
+                                 [&](const auto fe) { return edge_colors[fe] == ctn.color_south; }))
+            {
+                node_colors[i] = ctn.color_south;
+            }
+        }
+    };
+
+    // components are disjoint in their edges and gates; hence, threads write to distinct elements only
+    std::atomic<std::size_t> next_component{0ul};
+
+    const auto worker = [&]
+    {
+        for (auto c = next_component++; c < components.size(); c = next_component++)
+        {
+            color_component(components[c]);
+        }
+    };
+
+    std::vector<std::thread> threads{};
+    threads.reserve(num_threads);
+    for (std::size_t t = 0; t < std::min(num_threads, components.size()); ++t)
+    {
+        threads.emplace_back(worker);
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    // write the colors back to the view
+    for (std::size_t id = 0; id < edges.size(); ++id)
+    {
+        if (edge_colors[id] != ctn.color_null)
+        {
+            cntk.paint_edge(edges[id], edge_colors[id]);
+        }
+    }
+    for (std::size_t i = 0; i < num_nodes; ++i)
+    {
+        if (node_colors[i] != ctn.color_null)
+        {
+            cntk.paint(cntk.index_to_node(static_cast<uint32_t>(i)), node_colors[i]);
+        }
+    }
+
+    return ctn;
+}
+/**
+ * Computes an east-south coloring of the given network's edges and nodes such that every gate can be placed to the
+ * east or south of its fanins in the orthogonal placement.
+ *
+ * @tparam Ntk Logic network type.
+ * @param ntk Network to color.
+ * @param num_threads Number of threads to use. The result is independent of this value.
+ * @return Coloring container that holds the colored network.
+ */
+template <typename Ntk>
+coloring_container<Ntk> east_south_edge_coloring(const Ntk& ntk, const std::size_t num_threads = 1ul) noexcept
+{
+    if (num_threads > 1)
+    {
+        return parallel_east_south_edge_coloring(ntk, num_threads);
+    }
+
+    return sequential_east_south_edge_coloring(ntk);
+}
 
 template <typename Ntk>
 bool is_east_south_colored(const Ntk& ntk) noexcept
@@ -311,47 +640,348 @@ aspect_ratio<Lyt> determine_layout_size(const coloring_container<Ntk>& ctn) noex
     return {x, y, 1};
 }
 
+/**
+ * The orthogonal placement computes all positions on a Cartesian grid. This class maps them onto the target layout. For
+ * hexagonal layouts in even row arrangement, positions are transformed via `to_hex`, which yields a ROW-clocked layout
+ * directly, i.e., in a single pass instead of placing on a Cartesian layout and applying `hexagonalization` afterward.
+ * For all other layouts, the mapping is the identity.
+ *
+ * @tparam Lyt Gate-level layout type to create.
+ */
+template <typename Lyt>
+class orthogonal_coordinate_map
+{
+  public:
+    /**
+     * `true` iff Cartesian positions are transformed into hexagonal ones.
+     */
+    static constexpr bool to_hexagonal = []
+    {
+        if constexpr (is_hexagonal_layout_v<Lyt>)
+        {
+            return has_even_row_hex_arrangement_v<Lyt>;
+        }
+        else
+        {
+            return false;
+        }
+    }();
+    /**
+     * Standard constructor.
+     *
+     * @param size Size of the Cartesian grid as determined by determine_layout_size.
+     */
+    explicit orthogonal_coordinate_map(const aspect_ratio<Lyt>& size) noexcept :
+            cartesian_size{size},
+            cartesian_height{static_cast<int64_t>(size.y) + 1}
+    {}
+    /**
+     * Maps a Cartesian position onto the target layout.
+     *
+     * @param t Cartesian position.
+     * @return Respective tile in the target layout.
+     */
+    [[nodiscard]] tile<Lyt> operator()(const tile<Lyt>& t) const noexcept
+    {
+        if constexpr (to_hexagonal)
+        {
+            return to_hex<cart_gate_clk_lyt, Lyt>(t, cartesian_height);
+        }
+        else
+        {
+            return t;
+        }
+    }
+    /**
+     * Maps a Cartesian position onto the target layout and returns a signal pointing to the respective tile.
+     *
+     * @param t Cartesian position.
+     * @return Signal pointing to the respective tile in the target layout.
+     */
+    [[nodiscard]] mockturtle::signal<Lyt> signal(const tile<Lyt>& t) const noexcept
+    {
+        return static_cast<mockturtle::signal<Lyt>>((*this)(t));
+    }
+    /**
+     * Computes the size of the target layout.
+     *
+     * @return Aspect ratio of the target layout.
+     */
+    [[nodiscard]] aspect_ratio<Lyt> layout_size() const noexcept
+    {
+        if constexpr (to_hexagonal)
+        {
+            const auto width = static_cast<int64_t>(cartesian_size.x) + 1;
+
+            const auto hex_height =
+                to_hex<cart_gate_clk_lyt, Lyt>(tile<Lyt>{width - 1, cartesian_height - 1, 0}, cartesian_height).y;
+            const auto hex_width = to_hex<cart_gate_clk_lyt, Lyt>(tile<Lyt>{width - 1, 0, 0}, cartesian_height).x;
+
+            return {hex_width, hex_height, cartesian_size.z};
+        }
+        else
+        {
+            return cartesian_size;
+        }
+    }
+    /**
+     * Returns the clocking scheme of the target layout, i.e., ROW for hexagonal layouts and 2DDWave otherwise.
+     *
+     * @param num_phases Number of clock phases.
+     * @return Clocking scheme of the target layout.
+     */
+    [[nodiscard]] auto clocking_scheme(const num_clks& num_phases) const noexcept
+    {
+        if constexpr (to_hexagonal)
+        {
+            return row_clocking<Lyt>(num_phases);
+        }
+        else
+        {
+            return twoddwave_clocking<Lyt>(num_phases);
+        }
+    }
+
+  private:
+    /**
+     * Size of the Cartesian grid.
+     */
+    const aspect_ratio<Lyt> cartesian_size;
+    /**
+     * Height of the Cartesian grid.
+     */
+    const int64_t cartesian_height;
+};
+/**
+ * Streams the nodes of the orthogonal placement into the target layout. Nodes are collected by a
+ * `gate_level_layout_builder` in the topological order of their placement and committed to the layout in chunks of
+ * bounded size such that the builder's buffers stay small. Wire runs are handed to the builder as a whole.
+ *
+ * Pending nodes cannot be looked up in the layout before they are committed. Therefore, the occupancy of the Cartesian
+ * grid's ground layer, which is required to detect wire crossings, is tracked in a bit vector that is preallocated from
+ * the layout size as determined by `determine_layout_size`. All positions are Cartesian ones that are mapped onto the
+ * layout via an `orthogonal_coordinate_map`.
+ *
+ * @tparam Lyt Gate-level layout type to create.
+ */
+template <typename Lyt>
+class orthogonal_layout_stream
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param layout Layout to stream the nodes into.
+     * @param map Mapping of Cartesian positions onto `layout`.
+     * @param size Size of the Cartesian grid as determined by `determine_layout_size`.
+     */
+    orthogonal_layout_stream(Lyt& layout, const orthogonal_coordinate_map<Lyt>& map,
+                             const aspect_ratio<Lyt>& size) :
+            lyt{layout},
+            cm{map},
+            builder{layout},
+            width{static_cast<std::size_t>(size.x) + 1},
+            occupied((static_cast<std::size_t>(size.x) + 1) * (static_cast<std::size_t>(size.y) + 1), false)
+    {
+        builder.reserve(chunk_size);
+    }
+    /**
+     * Checks whether the given Cartesian ground tile is still empty, i.e., hosts neither a committed nor a pending
+     * node.
+     *
+     * @param t Cartesian ground tile.
+     * @return `true` iff `t` is empty.
+     */
+    [[nodiscard]] bool is_empty_tile(const tile<Lyt>& t) const noexcept
+    {
+        return !occupied[index(t)];
+    }
+    /**
+     * Moves a PI node that has been reserved in the layout via `reserve_input_nodes` to its position.
+     *
+     * @param n PI node in the layout.
+     * @param t Cartesian position of the PI.
+     */
+    void place_pi(const mockturtle::node<Lyt>& n, const tile<Lyt>& t)
+    {
+        static_cast<void>(lyt.move_node(n, cm(t)));
+        occupy(t);
+    }
+
+    mockturtle::signal<Lyt> create_buf(const tile<Lyt>& a, const tile<Lyt>& t)
+    {
+        static_cast<void>(builder.create_buf(cm.signal(a), cm(t)));
+        occupy(t);
+
+        return static_cast<mockturtle::signal<Lyt>>(t);
+    }
+    /**
+     * Creates a wire segment on each of the given tiles, the first of which is fed by `src`.
+     *
+     * @param src Cartesian position of the node that feeds the wire run.
+     * @param run Cartesian positions of the wire segments in order of information flow.
+     * @return Signal to the Cartesian position of the last wire segment or `src` if `run` is empty.
+     */
+    mockturtle::signal<Lyt> create_wire_run(const tile<Lyt>& src, const std::vector<tile<Lyt>>& run)
+    {
+        if (run.empty())
+        {
+            return static_cast<mockturtle::signal<Lyt>>(src);
+        }
+
+        mapped_run.clear();
+        for (const auto& t : run)
+        {
+            mapped_run.push_back(cm(t));
+            occupy(t);
+        }
+
+        static_cast<void>(builder.create_wire_run(cm.signal(src), mapped_run));
+
+        return static_cast<mockturtle::signal<Lyt>>(run.back());
+    }
+
+    template <typename Ntk>
+    mockturtle::signal<Lyt> place(const tile<Lyt>& t, const Ntk& ntk, const mockturtle::node<Ntk>& n,
+                                  const tile<Lyt>& a)
+    {
+        static_cast<void>(fiction::place(builder, cm(t), ntk, n, cm.signal(a)));
+        occupy(t);
+
+        return static_cast<mockturtle::signal<Lyt>>(t);
+    }
+
+    template <typename Ntk>
+    mockturtle::signal<Lyt> place(const tile<Lyt>& t, const Ntk& ntk, const mockturtle::node<Ntk>& n,
+                                  const tile<Lyt>& a, const tile<Lyt>& b, const std::optional<bool>& c)
+    {
+        static_cast<void>(fiction::place(builder, cm(t), ntk, n, cm.signal(a), cm.signal(b), c));
+        occupy(t);
+
+        return static_cast<mockturtle::signal<Lyt>>(t);
+    }
+
+    void create_po(const tile<Lyt>& s, const std::string& name, const tile<Lyt>& t)
+    {
+        static_cast<void>(builder.create_po(cm.signal(s), name, cm(t)));
+        occupy(t);
+    }
+    /**
+     * Commits all pending nodes to the layout if a chunk is complete. To be called whenever all nodes of a placement
+     * step have been created.
+     */
+    void flush()
+    {
+        if (builder.num_pending() >= chunk_size)
+        {
+            builder.finalize();
+        }
+    }
+    /**
+     * Commits all remaining pending nodes to the layout.
+     */
+    void finalize()
+    {
+        builder.finalize();
+    }
+
+  private:
+    /**
+     * Number of pending nodes after which they are committed to the layout.
+     */
+    static constexpr const std::size_t chunk_size = 1ull << 16u;
+    /**
+     * The layout under construction.
+     */
+    Lyt& lyt;
+    /**
+     * Mapping of Cartesian positions onto the layout.
+     */
+    const orthogonal_coordinate_map<Lyt>& cm;
+    /**
+     * Collects the pending nodes.
+     */
+    gate_level_layout_builder<Lyt> builder;
+    /**
+     * Width of the Cartesian grid.
+     */
+    const std::size_t width;
+    /**
+     * Occupancy of the Cartesian grid's ground layer.
+     */
+    std::vector<bool> occupied;
+    /**
+     * Buffer for the mapped positions of a wire run.
+     */
+    std::vector<tile<Lyt>> mapped_run{};
+
+    [[nodiscard]] std::size_t index(const tile<Lyt>& t) const noexcept
+    {
+        return static_cast<std::size_t>(t.y) * width + static_cast<std::size_t>(t.x);
+    }
+
+    void occupy(const tile<Lyt>& t) noexcept
+    {
+        if (t.z == 0)
+        {
+            occupied[index(t)] = true;
+        }
+    }
+};
+/**
+ * Creates a horizontal wire from `src` (exclusive) to `dest` (exclusive) as a single wire run. All positions are
+ * Cartesian ones.
+ *
+ * @return Signal to the Cartesian position of the last wire segment.
+ */
 template <typename Lyt>
-mockturtle::signal<Lyt> wire_east(Lyt& lyt, const tile<Lyt>& src, const tile<Lyt>& dest)
+mockturtle::signal<Lyt> wire_east(orthogonal_layout_stream<Lyt>& strm, const tile<Lyt>& src, const tile<Lyt>& dest)
 {
-    auto a = static_cast<mockturtle::signal<Lyt>>(src);
+    std::vector<tile<Lyt>> run{};
+    run.reserve(dest.x > src.x ? static_cast<std::size_t>(dest.x - src.x) : 0ul);
 
     for (auto x = src.x + 1; x < dest.x; ++x)
     {
         auto t = tile<Lyt>{x, src.y, 0};
-        if (!lyt.is_empty_tile(t))  // crossing case
+        if (!strm.is_empty_tile(t))  // crossing case
         {
-            t = lyt.above(t);
+            t = tile<Lyt>{x, src.y, 1};
         }
 
-        a = lyt.create_buf(a, t);
+        run.push_back(t);
     }
 
-    return a;
+    return strm.create_wire_run(src, run);
 }
-
+/**
+ * Creates a vertical wire from `src` (exclusive) to `dest` (exclusive) as a single wire run. All positions are
+ * Cartesian ones.
+ *
+ * @return Signal to the Cartesian position of the last wire segment.
+ */
 template <typename Lyt>
-mockturtle::signal<Lyt> wire_south(Lyt& lyt, const tile<Lyt>& src, const tile<Lyt>& dest)
+mockturtle::signal<Lyt> wire_south(orthogonal_layout_stream<Lyt>& strm, const tile<Lyt>& src, const tile<Lyt>& dest)
 {
-    auto a = static_cast<mockturtle::signal<Lyt>>(src);
+    std::vector<tile<Lyt>> run{};
+    run.reserve(dest.y > src.y ? static_cast<std::size_t>(dest.y - src.y) : 0ul);
 
     for (auto y = src.y + 1; y < dest.y; ++y)
     {
         auto t = tile<Lyt>{src.x, y, 0};
-        if (!lyt.is_empty_tile(t))  // crossing case
+        if (!strm.is_empty_tile(t))  // crossing case
         {
-            t = lyt.above(t);
+            t = tile<Lyt>{src.x, y, 1};
         }
 
-        a = lyt.create_buf(a, t);
+        run.push_back(t);
     }
 
-    return a;
+    return strm.create_wire_run(src, run);
 }
 
 template <typename Lyt, typename Ntk>
-mockturtle::signal<Lyt> connect_and_place(Lyt& lyt, const tile<Lyt>& t, const Ntk& ntk, const mockturtle::node<Ntk>& n,
-                                          tile<Lyt> pre1_t, tile<Lyt> pre2_t,
+mockturtle::signal<Lyt> connect_and_place(orthogonal_layout_stream<Lyt>& strm, const tile<Lyt>& t, const Ntk& ntk,
+                                          const mockturtle::node<Ntk>& n, tile<Lyt> pre1_t, tile<Lyt> pre2_t,
                                           const std::optional<bool>& c = std::nullopt)
 {
     // make sure pre1_t is the northwards tile and pre2_t is the westwards one
@@ -360,20 +990,29 @@ mockturtle::signal<Lyt> connect_and_place(Lyt& lyt, const tile<Lyt>& t, const Nt
         std::swap(pre1_t, pre2_t);
     }
 
-    return place(lyt, t, ntk, n, wire_south(lyt, pre1_t, t), wire_east(lyt, pre2_t, t), c);
+    const auto a = static_cast<tile<Lyt>>(wire_south(strm, pre1_t, t));
+    const auto b = static_cast<tile<Lyt>>(wire_east(strm, pre2_t, t));
+
+    return strm.place(t, ntk, n, a, b, c);
 }
 
 template <typename Lyt, typename Ntk>
-mockturtle::signal<Lyt> connect_and_place(Lyt& lyt, const tile<Lyt>& t, const Ntk& ntk, const mockturtle::node<Ntk>& n,
-                                          const tile<Lyt>& pre_t)
+mockturtle::signal<Lyt> connect_and_place(orthogonal_layout_stream<Lyt>& strm, const tile<Lyt>& t, const Ntk& ntk,
+                                          const mockturtle::node<Ntk>& n, const tile<Lyt>& pre_t)
 {
-    if (lyt.is_westwards_of(t, pre_t))
+    // pre_t is located westwards of t
+    if (pre_t.z == t.z && pre_t.y == t.y && pre_t.x < t.x)
     {
-        return place(lyt, t, ntk, n, wire_east(lyt, pre_t, t));
+        const auto a = static_cast<tile<Lyt>>(wire_east(strm, pre_t, t));
+
+        return strm.place(t, ntk, n, a);
     }
-    if (lyt.is_northwards_of(t, pre_t))
+    // pre_t is located northwards of t
+    if (pre_t.z == t.z && pre_t.x == t.x && pre_t.y < t.y)
     {
-        return place(lyt, t, ntk, n, wire_south(lyt, pre_t, t));
+        const auto a = static_cast<tile<Lyt>>(wire_south(strm, pre_t, t));
+
+        return strm.place(t, ntk, n, a);
     }
 
     assert(false);  // gates cannot be placed elsewhere
@@ -395,16 +1034,32 @@ class orthogonal_impl
         // measure run time
         mockturtle::stopwatch stop{pst.time_total};
         // compute a coloring
-        const auto ctn = east_south_edge_coloring(ntk);
+        const auto ctn = [this]
+        {
+            mockturtle::stopwatch stop_coloring{pst.time_coloring};
+
+            return east_south_edge_coloring(ntk, ps.num_threads);
+        }();
 
         mockturtle::node_map<mockturtle::signal<Lyt>, decltype(ctn.color_ntk)> node2pos{ctn.color_ntk};
 
-        // instantiate the layout
-        Lyt layout{determine_layout_size<Lyt>(ctn), twoddwave_clocking<Lyt>(ps.number_of_clock_phases)};
+        const auto layout_size = determine_layout_size<Lyt>(ctn);
+
+        // all positions are computed on a Cartesian grid and mapped onto the layout
+        const orthogonal_coordinate_map<Lyt> cm{layout_size};
+
+        // instantiate the layout; if it uses dense tile storage, its tile array is allocated for the entire grid here
+        Lyt layout{cm.layout_size(), cm.clocking_scheme(ps.number_of_clock_phases)};
+
+        // preallocate the layout's storage for all gates and I/Os; it grows geometrically with the wire segments
+        layout.reserve(ctn.color_ntk.size() + ctn.color_ntk.num_pos());
 
         // reserve PI nodes without positions
         auto pi2node = reserve_input_nodes(layout, ctn.color_ntk);
 
+        // all further nodes are streamed into the layout in the order of their placement
+        orthogonal_layout_stream<Lyt> strm{layout, cm, layout_size};
+
         // first x-pos to use for gates is 1 because PIs take up the 0th column
         tile<Lyt> latest_pos{1, 0};
 
@@ -422,17 +1077,20 @@ class orthogonal_impl
                     // if node is a PI, move it to its correct position
                     if (ctn.color_ntk.is_pi(n))
                     {
-                        node2pos[n] = layout.move_node(pi2node[n], {0, latest_pos.y});
+                        const tile<Lyt> pi_t{0, latest_pos.y};
+                        strm.place_pi(pi2node[n], pi_t);
+                        node2pos[n] = static_cast<mockturtle::signal<Lyt>>(pi_t);
 
                         // resolve conflicting PIs
                         ctn.color_ntk.foreach_fanout(
                             n,
-                            [&ctn, &n, &layout, &node2pos, &latest_pos](const auto& fon)
+                            [&ctn, &n, &strm, &node2pos, &latest_pos](const auto& fon)
                             {
                                 if (ctn.color_ntk.color(fon) == ctn.color_south)
                                 {
-                                    node2pos[n] =
-                                        layout.create_buf(wire_east(layout, {0, latest_pos.y}, latest_pos), latest_pos);
+                                    const auto w =
+                                        static_cast<tile<Lyt>>(wire_east(strm, {0, latest_pos.y}, latest_pos));
+                                    node2pos[n] = strm.create_buf(w, latest_pos);
                                     ++latest_pos.x;
                                 }
 
@@ -453,14 +1111,14 @@ class orthogonal_impl
                         if (const auto clr = ctn.color_ntk.color(n); clr == ctn.color_east)
                         {
                             const tile<Lyt> t{latest_pos.x, pre_t.y};
-                            node2pos[n] = connect_and_place(layout, t, ctn.color_ntk, n, pre_t);
+                            node2pos[n] = connect_and_place(strm, t, ctn.color_ntk, n, pre_t);
                             ++latest_pos.x;
                         }
                         // n is colored south
                         else if (clr == ctn.color_south)
                         {
                             const tile<Lyt> t{pre_t.x, latest_pos.y};
-                            node2pos[n] = connect_and_place(layout, t, ctn.color_ntk, n, pre_t);
+                            node2pos[n] = connect_and_place(strm, t, ctn.color_ntk, n, pre_t);
                             ++latest_pos.y;
                         }
                         else
@@ -491,7 +1149,7 @@ class orthogonal_impl
                             t = {latest_pos.x, pre2_t.y};
 
                             // each 2-input gate has one incoming bent wire
-                            pre1_t = static_cast<tile<Lyt>>(wire_east(layout, pre1_t, {t.x + 1, pre1_t.y}));
+                            pre1_t = static_cast<tile<Lyt>>(wire_east(strm, pre1_t, {t.x + 1, pre1_t.y}));
 
                             ++latest_pos.x;
                         }
@@ -508,7 +1166,7 @@ class orthogonal_impl
                             t = {pre1_t.x, latest_pos.y};
 
                             // each 2-input gate has one incoming bent wire
-                            pre2_t = static_cast<tile<Lyt>>(wire_south(layout, pre2_t, {pre2_t.x, t.y + 1}));
+                            pre2_t = static_cast<tile<Lyt>>(wire_south(strm, pre2_t, {pre2_t.x, t.y + 1}));
 
                             ++latest_pos.y;
                         }
@@ -516,8 +1174,8 @@ class orthogonal_impl
                         else
                         {
                             // make sure pre1_t has an empty tile to its east and pre2_t to its south
-                            if (!layout.is_empty_tile(layout.east(pre1_t)) ||
-                                !layout.is_empty_tile(layout.south(pre2_t)))
+                            if (!strm.is_empty_tile({pre1_t.x + 1, pre1_t.y}) ||
+                                !strm.is_empty_tile({pre2_t.x, pre2_t.y + 1}))
                             {
                                 std::swap(pre1_t, pre2_t);
                             }
@@ -525,58 +1183,63 @@ class orthogonal_impl
                             t = latest_pos;
 
                             // both wires have one bent
-                            pre1_t = static_cast<tile<Lyt>>(wire_east(layout, pre1_t, {t.x + 1, pre1_t.y}));
-                            pre2_t = static_cast<tile<Lyt>>(wire_south(layout, pre2_t, {pre2_t.x, t.y + 1}));
+                            pre1_t = static_cast<tile<Lyt>>(wire_east(strm, pre1_t, {t.x + 1, pre1_t.y}));
+                            pre2_t = static_cast<tile<Lyt>>(wire_south(strm, pre2_t, {pre2_t.x, t.y + 1}));
 
                             ++latest_pos.x;
                             ++latest_pos.y;
                         }
 
-                        node2pos[n] = connect_and_place(layout, t, ctn.color_ntk, n, pre1_t, pre2_t, fc.constant_fanin);
+                        node2pos[n] = connect_and_place(strm, t, ctn.color_ntk, n, pre1_t, pre2_t, fc.constant_fanin);
                     }
 
                     // create PO at applicable position
                     if (ctn.color_ntk.is_po(n))
                     {
-                        const auto n_s = node2pos[n];
+                        const auto n_t = static_cast<tile<Lyt>>(node2pos[n]);
 
                         tile<Lyt> po_tile{};
 
                         // determine PO orientation
                         if (is_eastern_po_orientation_available(ctn, n))
                         {
-                            po_tile = layout.east(static_cast<tile<Lyt>>(n_s));
+                            po_tile = {n_t.x + 1, n_t.y};
                             ++latest_pos.x;
                         }
                         else
                         {
-                            po_tile = layout.south(static_cast<tile<Lyt>>(n_s));
+                            po_tile = {n_t.x, n_t.y + 1};
                             ++latest_pos.y;
                         }
 
-                        // check if PO position is located at the border
-                        if (layout.is_at_eastern_border(po_tile))
+                        // check if PO position is located at the (Cartesian) eastern border
+                        if (po_tile.x == layout_size.x)
                         {
-                            layout.create_po(n_s,
-                                             ctn.color_ntk.has_output_name(po_counter) ?
-                                                 ctn.color_ntk.get_output_name(po_counter++) :
-                                                 fmt::format("po{}", po_counter++),
-                                             po_tile);
+                            strm.create_po(n_t,
+                                           ctn.color_ntk.has_output_name(po_counter) ?
+                                               ctn.color_ntk.get_output_name(po_counter++) :
+                                               fmt::format("po{}", po_counter++),
+                                           po_tile);
                         }
                         // place PO at the border and connect it by wire segments
                         else
                         {
-                            const auto anker = layout.create_buf(n_s, po_tile);
+                            const auto anker = po_tile;
+                            static_cast<void>(strm.create_buf(n_t, anker));
 
-                            po_tile = layout.eastern_border_of(po_tile);
+                            po_tile = {layout_size.x, po_tile.y};
 
-                            layout.create_po(wire_east(layout, static_cast<tile<Lyt>>(anker), po_tile),
-                                             ctn.color_ntk.has_output_name(po_counter) ?
-                                                 ctn.color_ntk.get_output_name(po_counter++) :
-                                                 fmt::format("po{}", po_counter++),
-                                             po_tile);
+                            const auto w = static_cast<tile<Lyt>>(wire_east(strm, anker, po_tile));
+
+                            strm.create_po(w,
+                                           ctn.color_ntk.has_output_name(po_counter) ?
+                                               ctn.color_ntk.get_output_name(po_counter++) :
+                                               fmt::format("po{}", po_counter++),
+                                           po_tile);
                         }
                     }
+
+                    strm.flush();
                 }
 
 #if (PROGRESS_BARS)
@@ -585,6 +1248,21 @@ class orthogonal_impl
 #endif
             });
 
+        strm.finalize();
+
+        // map the Cartesian positions onto the layout
+        if constexpr (orthogonal_coordinate_map<Lyt>::to_hexagonal)
+        {
+            ctn.color_ntk.foreach_node(
+                [&ctn, &cm, &node2pos](const auto& n)
+                {
+                    if (!ctn.color_ntk.is_constant(n))
+                    {
+                        node2pos[n] = cm.signal(static_cast<tile<Lyt>>(node2pos[n]));
+                    }
+                });
+        }
+
         // restore possibly set signal names
         restore_names(ctn.color_ntk, layout, node2pos);
 
@@ -622,6 +1300,10 @@ class orthogonal_impl
  * The imposed restrictions are that the input logic network has to be a 3-graph, i.e., cannot have any node exceeding
  * degree 3 (combined input and output), and that the resulting layout is always 2DDWave-clocked.
  *
+ * If `Lyt` is a hexagonal layout in even row arrangement, e.g., `hex_even_row_gate_clk_lyt`, all positions are
+ * directly mapped as in `hexagonalization` instead. The resulting layout is then ROW-clocked and suitable for the
+ * Bestagon gate library without the detour via an intermediate Cartesian layout.
+ *
  * This algorithm is based on a modification of \"Improved orthogonal drawings of 3-graphs\" by Therese C. Biedl in
  * Canadian Conference on Computational Geometry 1996. Biedl's original algorithm works for undirected graphs only while
  * this modification respects information flow of directed logic networks. To this end, the edge directions of the logic
@@ -632,6 +1314,12 @@ class orthogonal_impl
  * network and \f$ |L| \f$ is the resulting layout size given by \f$ x \cdot y \f$, which approaches \f$
  * (\frac{|N|}{2})^2 \f$ asymptotically.
  *
+ * Nodes are placed in a single topologically ordered pass and streamed into the layout via a
+ * `gate_level_layout_builder` that commits them in chunks. Wire runs are created in bulk. Crossings are detected via a
+ * bit vector over the grid that is preallocated from the layout size. To scale to networks with hundreds of thousands
+ * of nodes, `Lyt` should use `dense_tile_storage`, e.g., `dense_cart_gate_clk_lyt`. Then, its tile array is allocated
+ * once for the entire grid and committing a node does not involve any hashing.
+ *
  * May throw a high_degree_fanin_exception if `ntk` contains any node with a fan-in larger than 2.
  *
  * @tparam Lyt Desired gate-level layout type.
@@ -12,14 +12,321 @@
 #include <mockturtle/networks/detail/foreach.hpp>
 #include <phmap.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 namespace fiction
 {
 
+namespace detail
+{
+
+/**
+ * Assignment of cell types to cell positions that is backed by a hash map. Its memory consumption scales with the
+ * number of assigned cells but iteration order is unspecified.
+ *
+ * @tparam Cell Cell position type.
+ * @tparam Technology FCN technology that provides the cell types.
+ */
+template <typename Cell, typename Technology>
+class hashed_cell_type_assignment
+{
+  public:
+    using cell_type = typename Technology::cell_type;
+
+    hashed_cell_type_assignment([[maybe_unused]] const uint16_t tile_x, [[maybe_unused]] const uint16_t tile_y) {}
+
+    [[nodiscard]] cell_type get(const Cell& c) const noexcept
+    {
+        if (const auto it = cell_type_map.find(c); it != cell_type_map.cend())
+        {
+            return it->second;
+        }
+
+        return Technology::cell_type::EMPTY;
+    }
+
+    void assign(const Cell& c, const cell_type& ct) noexcept
+    {
+        cell_type_map[c] = ct;
+    }
+
+    void erase(const Cell& c) noexcept
+    {
+        cell_type_map.erase(c);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return cell_type_map.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return cell_type_map.empty();
+    }
+
+    [[nodiscard]] auto cbegin() const noexcept
+    {
+        return cell_type_map.cbegin();
+    }
+
+    [[nodiscard]] auto cend() const noexcept
+    {
+        return cell_type_map.cend();
+    }
+
+  private:
+    phmap::parallel_flat_hash_map<Cell, cell_type> cell_type_map{};
+};
+/**
+ * Assignment of cell types to cell positions that is backed by dense chunks of `tile_x` \f$ \times \f$ `tile_y` cell
+ * types, one per clock zone. Chunks are only allocated for clock zones that contain at least one cell and are released
+ * again once they are empty. Since each cell type occupies a single byte in its chunk, layouts obtained from the
+ * application of a gate library require considerably less memory than with hash maps. Furthermore, cells are iterated
+ * in spatial order, i.e., chunk by chunk in the order of their clock zones and row by row within each chunk.
+ *
+ * @tparam Cell Cell position type.
+ * @tparam Technology FCN technology that provides the cell types.
+ */
+template <typename Cell, typename Technology>
+class chunked_cell_type_assignment
+{
+  public:
+    using cell_type = typename Technology::cell_type;
+
+    chunked_cell_type_assignment(const uint16_t tile_x, const uint16_t tile_y) :
+            chunk_x{static_cast<int64_t>(tile_x)},
+            chunk_y{static_cast<int64_t>(tile_y)}
+    {}
+
+    [[nodiscard]] cell_type get(const Cell& c) const noexcept
+    {
+        if (const auto it = chunks.find(chunk_of(c)); it != chunks.cend())
+        {
+            return it->second.types[index_in_chunk(c)];
+        }
+
+        return Technology::cell_type::EMPTY;
+    }
+
+    void assign(const Cell& c, const cell_type& ct)
+    {
+        auto it = chunks.find(chunk_of(c));
+
+        if (it == chunks.end())
+        {
+            it = chunks
+                     .emplace(chunk_of(c), chunk{std::vector<cell_type>(static_cast<std::size_t>(chunk_x * chunk_y),
+                                                                        Technology::cell_type::EMPTY),
+                                                 0ull})
+                     .first;
+        }
+
+        auto& entry = it->second.types[index_in_chunk(c)];
+
+        if (Technology::is_empty_cell(entry))
+        {
+            ++it->second.num_cells;
+            ++num_cells;
+        }
+
+        entry = ct;
+    }
+
+    void erase(const Cell& c) noexcept
+    {
+        if (const auto it = chunks.find(chunk_of(c)); it != chunks.end())
+        {
+            if (auto& entry = it->second.types[index_in_chunk(c)]; !Technology::is_empty_cell(entry))
+            {
+                entry = Technology::cell_type::EMPTY;
+                --num_cells;
+
+                if (--it->second.num_cells == 0ull)
+                {
+                    chunks.erase(it);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return num_cells;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return num_cells == 0ull;
+    }
+
+  private:
+    /**
+     * Cell types of a single clock zone stored row by row alongside the number of non-empty ones.
+     */
+    struct chunk
+    {
+        std::vector<cell_type> types;
+
+        std::size_t num_cells;
+    };
+    /**
+     * Chunk dimensions in cells.
+     */
+    const int64_t chunk_x, chunk_y;
+    /**
+     * Allocated chunks indexed by their clock zone and ordered by the coordinate's `operator<`.
+     */
+    std::map<Cell, chunk> chunks{};
+    /**
+     * Total number of non-empty cells.
+     */
+    std::size_t num_cells{0ull};
+
+    [[nodiscard]] static int64_t floor_div(const int64_t a, const int64_t b) noexcept
+    {
+        return a / b - static_cast<int64_t>((a % b != 0) && ((a < 0) != (b < 0)));
+    }
+
+    [[nodiscard]] Cell chunk_of(const Cell& c) const noexcept
+    {
+        return {floor_div(static_cast<int64_t>(c.x), chunk_x), floor_div(static_cast<int64_t>(c.y), chunk_y), c.z};
+    }
+
+    [[nodiscard]] std::size_t index_in_chunk(const Cell& c) const noexcept
+    {
+        const auto origin = chunk_of(c);
+
+        return static_cast<std::size_t>((static_cast<int64_t>(c.y) - static_cast<int64_t>(origin.y) * chunk_y) *
+                                            chunk_x +
+                                        (static_cast<int64_t>(c.x) - static_cast<int64_t>(origin.x) * chunk_x));
+    }
+
+  public:
+    /**
+     * Iterator over all non-empty cells that dereferences to pairs of cell positions and their types.
+     */
+    class const_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<Cell, cell_type>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const value_type*;
+        using reference         = value_type;
+
+        const_iterator(const chunked_cell_type_assignment& a, typename std::map<Cell, chunk>::const_iterator it) :
+                assignment{&a},
+                chunk_it{it}
+        {
+            skip_empty();
+        }
+
+        [[nodiscard]] value_type operator*() const noexcept
+        {
+            const auto lx = static_cast<int64_t>(index) % assignment->chunk_x;
+            const auto ly = static_cast<int64_t>(index) / assignment->chunk_x;
+
+            return {Cell{static_cast<int64_t>(chunk_it->first.x) * assignment->chunk_x + lx,
+                         static_cast<int64_t>(chunk_it->first.y) * assignment->chunk_y + ly, chunk_it->first.z},
+                    chunk_it->second.types[index]};
+        }
+
+        const_iterator& operator++() noexcept
+        {
+            ++index;
+            skip_empty();
+
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto result{*this};
+            ++(*this);
+
+            return result;
+        }
+
+        [[nodiscard]] bool operator==(const const_iterator& other) const noexcept
+        {
+            return chunk_it == other.chunk_it && index == other.index;
+        }
+
+        [[nodiscard]] bool operator!=(const const_iterator& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+      private:
+        const chunked_cell_type_assignment* assignment;
+
+        typename std::map<Cell, chunk>::const_iterator chunk_it;
+
+        std::size_t index{0ull};
+
+        void skip_empty() noexcept
+        {
+            while (chunk_it != assignment->chunks.cend())
+            {
+                const auto& types = chunk_it->second.types;
+
+                while (index < types.size() && Technology::is_empty_cell(types[index]))
+                {
+                    ++index;
+                }
+
+                if (index < types.size())
+                {
+                    return;
+                }
+
+                ++chunk_it;
+                index = 0ull;
+            }
+        }
+    };
+
+    [[nodiscard]] const_iterator cbegin() const noexcept
+    {
+        return const_iterator{*this, chunks.cbegin()};
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept
+    {
+        return const_iterator{*this, chunks.cend()};
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Storage policy for `cell_level_layout` that keeps cell types in a hash map. This is the default and suits layouts of
+ * arbitrary shape, e.g., SiDB layouts whose cells are not grouped into clock zones.
+ */
+struct sparse_cell_storage
+{
+    template <typename Cell, typename Technology>
+    using assignment = detail::hashed_cell_type_assignment<Cell, Technology>;
+};
+/**
+ * Storage policy for `cell_level_layout` that keeps cell types in dense per-clock-zone chunks. It is intended for
+ * layouts that are obtained from the application of a gate library, where most clock zones are occupied.
+ */
+struct chunked_cell_storage
+{
+    template <typename Cell, typename Technology>
+    using assignment = detail::chunked_cell_type_assignment<Cell, Technology>;
+};
+
 /**
  * A layout type to layer on top of a clocked layout that allows the assignment of individual cells to clock zones in
  * accordance with an FCN technology, e.g., QCA, iNML, or SiDB. This type, thereby, represents layouts on a
@@ -44,8 +351,10 @@ namespace fiction
  *
  * @tparam Technology An FCN technology that provides notions of cell types.
  * @tparam ClockedLayout The clocked layout that is to be extended by cell positions.
+ * @tparam CellStorage Storage policy for the assignment of cell types to cell positions, i.e., `sparse_cell_storage` or
+ * `chunked_cell_storage`.
  */
-template <typename Technology, typename ClockedLayout>
+template <typename Technology, typename ClockedLayout, typename CellStorage = sparse_cell_storage>
 class cell_level_layout : public ClockedLayout
 {
   public:
@@ -61,7 +370,8 @@ class cell_level_layout : public ClockedLayout
         explicit cell_level_layout_storage(const std::string_view& name, uint16_t tile_x = 1u, uint16_t tile_y = 1u) :
                 layout_name{name},
                 tile_size_x{tile_x},
-                tile_size_y{tile_y}
+                tile_size_y{tile_y},
+                cell_types{tile_x, tile_y}
         {}
 
         std::string layout_name;
@@ -69,8 +379,8 @@ class cell_level_layout : public ClockedLayout
         const uint16_t tile_size_x;
         const uint16_t tile_size_y;
 
-        phmap::parallel_flat_hash_map<Cell, cell_type> cell_type_map{};
-        phmap::parallel_flat_hash_map<Cell, cell_mode> cell_mode_map{};
+        typename CellStorage::template assignment<Cell, Technology> cell_types;
+        phmap::parallel_flat_hash_map<Cell, cell_mode>              cell_mode_map{};
 
         phmap::flat_hash_map<Cell, std::string> cell_name_map{};
 
@@ -135,7 +445,7 @@ class cell_level_layout : public ClockedLayout
     {
         if (Technology::is_empty_cell(ct))
         {
-            strg->cell_type_map.erase(c);
+            strg->cell_types.erase(c);
             strg->cell_mode_map.erase(c);
             strg->inputs.erase(c);
             strg->outputs.erase(c);
@@ -151,7 +461,7 @@ class cell_level_layout : public ClockedLayout
             strg->outputs.insert(c);
         }
 
-        strg->cell_type_map[c] = ct;
+        strg->cell_types.assign(c, ct);
     }
     /**
      * Returns the cell type assigned to cell position `c`.
@@ -161,12 +471,7 @@ class cell_level_layout : public ClockedLayout
      */
     [[nodiscard]] cell_type get_cell_type(const cell& c) const noexcept
     {
-        if (auto it = strg->cell_type_map.find(c); it != strg->cell_type_map.cend())
-        {
-            return it->second;
-        }
-
-        return Technology::cell_type::EMPTY;
+        return strg->cell_types.get(c);
     }
     /**
      * Returns `true` if no cell type is assigned to cell position `c` or if the empty type was assigned.
@@ -274,7 +579,7 @@ class cell_level_layout : public ClockedLayout
      */
     [[nodiscard]] uint64_t num_cells() const noexcept
     {
-        return static_cast<uint64_t>(strg->cell_type_map.size());
+        return static_cast<uint64_t>(strg->cell_types.size());
     }
     /**
      * Checks whether there are no cells assigned to the layout's coordinates.
@@ -283,7 +588,7 @@ class cell_level_layout : public ClockedLayout
      */
     [[nodiscard]] bool is_empty() const noexcept
     {
-        return strg->cell_type_map.empty();
+        return strg->cell_types.empty();
     }
     /**
      * Returns the number of primary input cells in the layout.
@@ -379,7 +684,8 @@ class cell_level_layout : public ClockedLayout
 #pragma region Iteration
 
     /**
-     * Applies a function to all cell positions in the layout that have non-empty cell types assigned.
+     * Applies a function to all cell positions in the layout that have non-empty cell types assigned. With
+     * `chunked_cell_storage`, cells are visited in spatial order; otherwise, the order is unspecified.
      *
      * @tparam Fn Functor type that has to comply with the restrictions imposed by
      * `mockturtle::foreach_element_transform`.
@@ -388,9 +694,9 @@ class cell_level_layout : public ClockedLayout
     template <typename Fn>
     void foreach_cell(Fn&& fn) const
     {
-        using iterator_type = decltype(strg->cell_type_map.cbegin());
+        using iterator_type = decltype(strg->cell_types.cbegin());
         mockturtle::detail::foreach_element_transform<iterator_type, cell>(
-            strg->cell_type_map.cbegin(), strg->cell_type_map.cend(),
+            strg->cell_types.cbegin(), strg->cell_types.cend(),
             [](const auto& ct) { return static_cast<cell>(ct.first); }, fn);
     }
     /**
@@ -7,6 +7,7 @@
 
 #include "fiction/algorithms/verification/design_rule_violations.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/layouts/coordinates.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/mockturtle_utils.hpp"
 #include "fiction/utils/range.hpp"
@@ -22,16 +23,374 @@
 #include <phmap.h>
 
 #include <algorithm>
+#include <cassert>
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace fiction
 {
 
+namespace detail
+{
+
+/**
+ * Assignment of nodes to tiles and vice versa that is backed by hash maps. Its memory consumption scales with the
+ * number of placed nodes only and it does not require the layout's dimensions to be known.
+ *
+ * @tparam Node Node type.
+ * @tparam Signal Signal type, i.e., the integral representation of tiles.
+ * @tparam Tile Tile type.
+ */
+template <typename Node, typename Signal, typename Tile>
+class hashed_tile_assignment
+{
+  public:
+    hashed_tile_assignment(const Signal const0, const Signal const1) :
+            tile_node_map{{const0, static_cast<Node>(0ull)}, {const1, static_cast<Node>(1ull)}},
+            node_tile_map{{static_cast<Node>(0ull), const0}, {static_cast<Node>(1ull), const1}}
+    {}
+
+    [[nodiscard]] std::optional<Node> find_node(const Signal s) const noexcept
+    {
+        if (const auto it = tile_node_map.find(s); it != tile_node_map.cend())
+        {
+            return it->second;
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<Signal> find_tile(const Node n) const noexcept
+    {
+        if (const auto it = node_tile_map.find(n); it != node_tile_map.cend())
+        {
+            return it->second;
+        }
+
+        return std::nullopt;
+    }
+
+    void assign(const Signal s, const Node n)
+    {
+        tile_node_map[s] = n;
+        node_tile_map[n] = s;
+    }
+
+    void erase(const Signal s, const Node n)
+    {
+        node_tile_map.erase(n);
+        tile_node_map.erase(s);
+    }
+
+    void reserve(const std::size_t num_nodes)
+    {
+        tile_node_map.reserve(num_nodes);
+        node_tile_map.reserve(num_nodes);
+    }
+
+    void resize([[maybe_unused]] const Tile& max) noexcept {}
+
+  private:
+    // these maps grow large! use parallel_flat_hashmap for better performance
+    phmap::parallel_flat_hash_map<Signal, Node> tile_node_map;
+    phmap::parallel_flat_hash_map<Node, Signal> node_tile_map;
+};
+/**
+ * Assignment of nodes to tiles and vice versa that is backed by a dense tile-indexed array of nodes and a
+ * node-indexed array of tiles. Lookups are plain array reads. The tile array covers the layout's entire bounding box,
+ * i.e., its memory consumption scales with the layout area. Tiles outside the bounding box, e.g., before a
+ * call to `resize`, are stored in a hash map.
+ *
+ * @tparam Node Node type.
+ * @tparam Signal Signal type, i.e., the integral representation of tiles.
+ * @tparam Tile Tile type. Must be an unsigned offset coordinate.
+ */
+template <typename Node, typename Signal, typename Tile>
+class dense_tile_assignment
+{
+  public:
+    static_assert(std::is_same_v<Tile, offset::ucoord_t>, "Dense tile assignments require offset coordinates");
+
+    dense_tile_assignment(const Signal c0, const Signal c1) : const0{c0}, const1{c1}, node_tiles{c0, c1} {}
+
+    [[nodiscard]] std::optional<Node> find_node(const Signal s) const noexcept
+    {
+        if (s == const0)
+        {
+            return static_cast<Node>(0ull);
+        }
+        if (s == const1)
+        {
+            return static_cast<Node>(1ull);
+        }
+
+        if (const auto idx = index(static_cast<Tile>(s)); idx.has_value())
+        {
+            if (const auto n = tile_nodes[*idx]; n != empty)
+            {
+                return n;
+            }
+
+            return std::nullopt;
+        }
+
+        if (const auto it = overflow.find(s); it != overflow.cend())
+        {
+            return it->second;
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<Signal> find_tile(const Node n) const noexcept
+    {
+        if (n < node_tiles.size() && node_tiles[n] != unassigned)
+        {
+            return node_tiles[n];
+        }
+
+        return std::nullopt;
+    }
+
+    void assign(const Signal s, const Node n)
+    {
+        if (const auto idx = index(static_cast<Tile>(s)); idx.has_value())
+        {
+            tile_nodes[*idx] = n;
+        }
+        else
+        {
+            overflow[s] = n;
+        }
+
+        if (n >= node_tiles.size())
+        {
+            node_tiles.resize(static_cast<std::size_t>(n) + 1, unassigned);
+        }
+        node_tiles[n] = s;
+    }
+
+    void erase(const Signal s, const Node n)
+    {
+        if (const auto idx = index(static_cast<Tile>(s)); idx.has_value())
+        {
+            tile_nodes[*idx] = empty;
+        }
+        else
+        {
+            overflow.erase(s);
+        }
+
+        if (n < node_tiles.size())
+        {
+            node_tiles[n] = unassigned;
+        }
+    }
+
+    void reserve(const std::size_t num_nodes)
+    {
+        node_tiles.reserve(num_nodes);
+    }
+    /**
+     * Adjusts the tile array to the given bounding box and re-inserts all assigned nodes.
+     *
+     * @param max Highest possible position in the layout.
+     */
+    void resize(const Tile& max)
+    {
+        width  = static_cast<std::size_t>(max.x) + 1;
+        height = static_cast<std::size_t>(max.y) + 1;
+        depth  = static_cast<std::size_t>(max.z) + 1;
+
+        tile_nodes.assign(width * height * depth, empty);
+        overflow.clear();
+
+        for (std::size_t n = 2; n < node_tiles.size(); ++n)
+        {
+            if (node_tiles[n] != unassigned)
+            {
+                const auto s = node_tiles[n];
+
+                if (const auto idx = index(static_cast<Tile>(s)); idx.has_value())
+                {
+                    tile_nodes[*idx] = static_cast<Node>(n);
+                }
+                else
+                {
+                    overflow[s] = static_cast<Node>(n);
+                }
+            }
+        }
+    }
+
+  private:
+    static constexpr Node empty = std::numeric_limits<Node>::max();
+
+    Signal unassigned = static_cast<Signal>(Tile{});
+
+    Signal const0, const1;
+
+    std::size_t width{0ul}, height{0ul}, depth{0ul};
+    /**
+     * Tile-indexed node IDs within the bounding box.
+     */
+    std::vector<Node> tile_nodes{};
+    /**
+     * Node-indexed tiles.
+     */
+    std::vector<Signal> node_tiles;
+    /**
+     * Assignments of tiles outside the bounding box.
+     */
+    phmap::flat_hash_map<Signal, Node> overflow{};
+
+    [[nodiscard]] std::optional<std::size_t> index(const Tile& t) const noexcept
+    {
+        if (t.is_dead() || t.x >= width || t.y >= height || t.z >= depth)
+        {
+            return std::nullopt;
+        }
+
+        return (static_cast<std::size_t>(t.z) * height + static_cast<std::size_t>(t.y)) * width +
+               static_cast<std::size_t>(t.x);
+    }
+};
+
+/**
+ * Fanout bookkeeping that stores nothing. Fanouts are determined by scanning the outgoing clocked zones on demand.
+ *
+ * @tparam Node Node type.
+ * @tparam Signal Signal type, i.e., the integral representation of tiles.
+ */
+template <typename Node, typename Signal>
+class no_fanout_lists
+{
+  public:
+    static constexpr bool enabled = false;  // NOLINT(*-identifier-naming)
+
+    void add([[maybe_unused]] const Signal s, [[maybe_unused]] const Node n) noexcept {}
+
+    void remove([[maybe_unused]] const Signal s, [[maybe_unused]] const Node n) noexcept {}
+
+    void reserve([[maybe_unused]] const std::size_t num_signals) noexcept {}
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return 0ull;
+    }
+};
+/**
+ * Lists of the nodes that have the respective signal as a child, stored in a hash map keyed by the signal. Since
+ * signals are tiles, the lists belong to the tile and not to the node that is currently placed on it.
+ *
+ * @tparam Node Node type.
+ * @tparam Signal Signal type, i.e., the integral representation of tiles.
+ */
+template <typename Node, typename Signal>
+class hashed_fanout_lists
+{
+  public:
+    static constexpr bool enabled = true;  // NOLINT(*-identifier-naming)
+
+    void add(const Signal s, const Node n)
+    {
+        if (auto& fos = fanouts[s]; std::find(fos.cbegin(), fos.cend(), n) == fos.cend())
+        {
+            fos.push_back(n);
+        }
+    }
+
+    void remove(const Signal s, const Node n)
+    {
+        if (const auto it = fanouts.find(s); it != fanouts.end())
+        {
+            auto& fos = it->second;
+            fos.erase(std::remove(fos.begin(), fos.end(), n), fos.end());
+
+            if (fos.empty())
+            {
+                fanouts.erase(it);
+            }
+        }
+    }
+
+    void reserve(const std::size_t num_signals)
+    {
+        fanouts.reserve(num_signals);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return fanouts.size();
+    }
+
+    [[nodiscard]] const std::vector<Node>* find(const Signal s) const noexcept
+    {
+        if (const auto it = fanouts.find(s); it != fanouts.cend())
+        {
+            return &it->second;
+        }
+
+        return nullptr;
+    }
+
+  private:
+    phmap::flat_hash_map<Signal, std::vector<Node>> fanouts{};
+};
+
+}  // namespace detail
+
+/**
+ * Storage policy for `gate_level_layout` that keeps the assignment of nodes to tiles in hash maps. This is the default.
+ */
+struct sparse_tile_storage
+{
+    template <typename Node, typename Signal, typename Tile>
+    using assignment = detail::hashed_tile_assignment<Node, Signal, Tile>;
+};
+/**
+ * Storage policy for `gate_level_layout` that keeps the assignment of nodes to tiles in dense arrays spanning the
+ * layout's bounding box. This makes lookups like `get_node`, `get_tile`, and `is_empty_tile` plain array reads and is
+ * suited best for layouts whose dimensions are known up front and whose area is not excessively larger than their
+ * number of nodes.
+ */
+struct dense_tile_storage
+{
+    template <typename Node, typename Signal, typename Tile>
+    using assignment = detail::dense_tile_assignment<Node, Signal, Tile>;
+};
+/**
+ * Fanout storage policy for `gate_level_layout` that does not store any fanouts. Instead, `foreach_fanout` scans the
+ * outgoing clocked zones of a node and checks which of their nodes have it as a child. This is the default.
+ */
+struct no_fanout_storage
+{
+    template <typename Node, typename Signal>
+    using lists = detail::no_fanout_lists<Node, Signal>;
+};
+/**
+ * Fanout storage policy for `gate_level_layout` that maintains a list of the nodes that have the respective signal as
+ * a child. `foreach_fanout` then iterates over that list instead of scanning the outgoing clocked zones. This pays off
+ * for traversal-heavy algorithms at the expense of one hash map entry per connected tile, particularly in combination
+ * with `dense_tile_storage`, which turns the tile lookups of the candidates into array reads.
+ */
+struct fanout_list_storage
+{
+    template <typename Node, typename Signal>
+    using lists = detail::hashed_fanout_lists<Node, Signal>;
+};
+
+template <typename Lyt>
+class gate_level_layout_builder;
+
 /**
  * A layout type to layer on top of a clocked layout that allows the assignment of gates to clock zones (aka tiles in
  * this context). This class represents a gate-level FCN layout and, thus, adds a notion of Boolean logic. The
@@ -76,8 +435,12 @@ namespace fiction
  * behavior might differ. Information on their functionality can be found in `mockturtle`'s docs.
  *
  * @tparam ClockedLayout The clocked layout that is to be extended by gate functions.
+ * @tparam TileStorage Storage policy for the assignment of nodes to tiles, i.e., `sparse_tile_storage` or
+ * `dense_tile_storage`.
+ * @tparam FanoutStorage Storage policy for fanouts, i.e., `no_fanout_storage` or `fanout_list_storage`.
  */
-template <typename ClockedLayout>
+template <typename ClockedLayout, typename TileStorage = sparse_tile_storage,
+          typename FanoutStorage = no_fanout_storage>
 class gate_level_layout : public ClockedLayout
 {
   public:
@@ -93,11 +456,8 @@ class gate_level_layout : public ClockedLayout
         const Tile const0{0x8000000000000000ull};
         const Tile const1{0xc000000000000000ull};
 
-        // these maps grow large! use parallel_flat_hashmap for better performance
-        phmap::parallel_flat_hash_map<Tile, Node> tile_node_map{
-            {{const0, static_cast<Node>(0ull)}, {const1, static_cast<Node>(1ull)}}};
-        phmap::parallel_flat_hash_map<Node, Tile> node_tile_map{
-            {{static_cast<Node>(0ull), const0}, {static_cast<Node>(1ull), const1}}};
+        typename TileStorage::template assignment<Node, Tile, typename ClockedLayout::clock_zone> tile_assignment{
+            const0, const1};
 
         uint32_t num_gates = 0ull;
         uint32_t num_wires = 0ull;
@@ -108,6 +468,9 @@ class gate_level_layout : public ClockedLayout
 
         // usually quite a small map, use flat_hash_map
         phmap::flat_hash_map<Node, std::string> node_names{};
+
+        // nodes that have the respective signal as a child if enabled by FanoutStorage
+        typename FanoutStorage::template lists<Node, Tile> fanouts{};
     };
 
     /*! \brief gate-level layout node
@@ -156,6 +519,7 @@ class gate_level_layout : public ClockedLayout
 
         initialize_truth_table_cache();
         strg->data.layout_name = name;
+        strg->data.tile_assignment.resize(ar);
     }
     /**
      * Standard constructor. Creates a gate-level layout of the given aspect ratio and clocks it via the given clocking
@@ -175,6 +539,7 @@ class gate_level_layout : public ClockedLayout
 
         initialize_truth_table_cache();
         strg->data.layout_name = name;
+        strg->data.tile_assignment.resize(ar);
     }
     /**
      * Copy constructor from another layout's storage.
@@ -232,6 +597,7 @@ class gate_level_layout : public ClockedLayout
         /* increase ref-count to child */
         strg->nodes[get_node(s)].data[0].h1++;
         strg->nodes[n].children.push_back(s);
+        register_fanout(s, n);
 
         return static_cast<signal>(t);
     }
@@ -472,6 +838,30 @@ class gate_level_layout : public ClockedLayout
     {
         return static_cast<uint32_t>(strg->nodes.size());
     }
+    /**
+     * Preallocates storage for the given number of nodes (excluding constants) as well as their tile assignments. This
+     * avoids repeated reallocations and rehashes when large layouts are constructed node by node.
+     *
+     * @param num_nodes Number of nodes that are expected to be created.
+     */
+    void reserve(const uint64_t num_nodes)
+    {
+        const auto total = static_cast<std::size_t>(num_nodes) + 2ull;
+
+        strg->nodes.reserve(total);
+        strg->data.tile_assignment.reserve(total);
+    }
+    /**
+     * Updates the layout's dimensions by calling `ClockedLayout`'s `resize` function and adjusts the storage of the
+     * node-tile assignment accordingly.
+     *
+     * @param ar New aspect ratio, i.e., the highest possible position in the layout.
+     */
+    void resize(const typename ClockedLayout::aspect_ratio& ar)
+    {
+        ClockedLayout::resize(ar);
+        strg->data.tile_assignment.resize(ar);
+    }
 
     [[nodiscard]] auto num_cis() const noexcept
     {
@@ -569,9 +959,9 @@ class gate_level_layout : public ClockedLayout
      */
     [[nodiscard]] node get_node(const signal& s) const noexcept
     {
-        if (const auto it = strg->data.tile_node_map.find(s); it != strg->data.tile_node_map.cend())
+        if (const auto n = strg->data.tile_assignment.find_node(s); n.has_value())
         {
-            return it->second;
+            return *n;
         }
 
         return 0;
@@ -595,9 +985,9 @@ class gate_level_layout : public ClockedLayout
      */
     [[nodiscard]] tile get_tile(const node n) const noexcept
     {
-        if (auto it = strg->data.node_tile_map.find(n); it != strg->data.node_tile_map.cend())
+        if (const auto t = strg->data.tile_assignment.find_tile(n); t.has_value())
         {
-            return static_cast<tile>(it->second);
+            return static_cast<tile>(*t);
         }
 
         return {};
@@ -642,7 +1032,8 @@ class gate_level_layout : public ClockedLayout
         // decrease ref-count of children
         std::for_each(children.cbegin(), children.cend(),
                       [this](const auto& c) { strg->nodes[get_node(c.index)].data[0].h1--; });
-        // clear n's children
+        // remove n from its children's fanout lists and clear n's children
+        unregister_fanouts(n);
         children.clear();
 
         // clear old_t only if it is different from t (this function can also be used to simply update n's children)
@@ -665,9 +1056,13 @@ class gate_level_layout : public ClockedLayout
 
         // assign new children
         std::copy(new_children.cbegin(), new_children.cend(), std::back_inserter(children));
-        // increase ref-count to new children
+        // increase ref-count to new children and add n to their fanout lists
         std::for_each(new_children.cbegin(), new_children.cend(),
-                      [this](const auto& nc) { strg->nodes[get_node(nc)].data[0].h1++; });
+                      [this, &n](const auto& nc)
+                      {
+                          strg->nodes[get_node(nc)].data[0].h1++;
+                          register_fanout(nc, n);
+                      });
 
         return static_cast<signal>(t);
     }
@@ -685,6 +1080,7 @@ class gate_level_layout : public ClockedLayout
         if (!is_constant(n))
         {
             strg->nodes[n].children.push_back(s);
+            register_fanout(s, n);
         }
 
         return make_signal(n);
@@ -701,9 +1097,9 @@ class gate_level_layout : public ClockedLayout
      */
     void clear_tile(const tile& t) noexcept
     {
-        if (const auto it = strg->data.tile_node_map.find(static_cast<signal>(t)); it != strg->data.tile_node_map.end())
+        if (const auto it = strg->data.tile_assignment.find_node(static_cast<signal>(t)); it.has_value())
         {
-            const auto n = it->second;
+            const auto n = *it;
 
             if (!t.is_dead())
             {
@@ -726,13 +1122,12 @@ class gate_level_layout : public ClockedLayout
                     strg->data.num_gates--;
                 }
             }
-            // mark node as dead
+            // mark node as dead and remove it from its children's fanout lists
             kill_node(n);
+            unregister_fanouts(n);
 
-            // remove node-tile
-            strg->data.node_tile_map.erase(n);
-            // remove tile-node
-            strg->data.tile_node_map.erase(it);
+            // remove node-tile and tile-node assignments
+            strg->data.tile_assignment.erase(static_cast<signal>(t), n);
         }
     }
     /**
@@ -1015,8 +1410,11 @@ class gate_level_layout : public ClockedLayout
      * is, the given function is applied to all nodes that are connected to the one assigned to `t` as fanouts on
      * neighboring tiles.
      *
-     * @tparam Fn Functor type that has to comply with the restrictions imposed by
-     * `mockturtle::foreach_element_transform`.
+     * If `FanoutStorage` is `fanout_list_storage`, candidate fanouts are read from a list that is maintained
+     * incrementally by `create_node`, `move_node`, `connect`, and `clear_tile`. Otherwise, the nodes on all outgoing
+     * clocked zones are checked for having `n` as a child.
+     *
+     * @tparam Fn Functor type that has to comply with the restrictions imposed by `mockturtle::foreach_element_if`.
      * @param n Node whose fanouts are desired.
      * @param fn Functor to apply to each of `n`'s fanouts.
      */
@@ -1030,39 +1428,62 @@ class gate_level_layout : public ClockedLayout
 
         const auto nt = get_tile(n);
 
-        ClockedLayout::foreach_outgoing_clocked_zone(
-            nt,
-            [this, &fn, &nt](const auto& out_t)
+        if constexpr (decltype(strg->data.fanouts)::enabled)
+        {
+            const auto* fos = strg->data.fanouts.find(static_cast<signal>(nt));
+
+            if (fos == nullptr)
             {
-                const auto apply_functor = [this, &fn](const auto& parent_t)
+                return;
+            }
+
+            using iterator_type = decltype(fos->cbegin());
+            mockturtle::detail::foreach_element_if<iterator_type>(
+                fos->cbegin(), fos->cend(),
+                [this, &nt](const auto& fo)
                 {
-                    const auto parent_index = node_to_index(parent_t);
-                    auto       parents      = mockturtle::range(parent_index, parent_index + 1);
-                    using iterator_type     = decltype(parents.begin());
-                    mockturtle::detail::foreach_element_transform<iterator_type, node>(
-                        parents.begin(), parents.end(), [this](const auto& p) -> node { return index_to_node(p); },
-                        std::forward<Fn>(fn));
-                };
-
-                const auto apply_if_parent = [this, &nt, &apply_functor](const auto& adj_t)
+                    const auto ft = get_tile(fo);
+                    return ClockedLayout::is_adjacent_elevation_of(nt, ft) &&
+                           ClockedLayout::is_outgoing_clocked(nt, ft);
+                },
+                std::forward<Fn>(fn));
+        }
+        else
+        {
+            ClockedLayout::foreach_outgoing_clocked_zone(
+                nt,
+                [this, &fn, &nt](const auto& out_t)
                 {
-                    if (const auto adj_n = get_node(adj_t); is_child(adj_n, static_cast<signal>(nt)))
+                    const auto apply_functor = [this, &fn](const auto& parent_t)
                     {
-                        apply_functor(adj_n);
-                    }
-                };
+                        const auto parent_index = node_to_index(parent_t);
+                        auto       parents      = mockturtle::range(parent_index, parent_index + 1);
+                        using iterator_type     = decltype(parents.begin());
+                        mockturtle::detail::foreach_element_transform<iterator_type, node>(
+                            parents.begin(), parents.end(), [this](const auto& p) -> node { return index_to_node(p); },
+                            std::forward<Fn>(fn));
+                    };
+
+                    const auto apply_if_parent = [this, &nt, &apply_functor](const auto& adj_t)
+                    {
+                        if (const auto adj_n = get_node(adj_t); is_child(adj_n, static_cast<signal>(nt)))
+                        {
+                            apply_functor(adj_n);
+                        }
+                    };
 
-                apply_if_parent(out_t);
+                    apply_if_parent(out_t);
 
-                if (const auto above_t = ClockedLayout::above(out_t); above_t != out_t)
-                {
-                    apply_if_parent(above_t);
-                }
-                if (const auto below_t = ClockedLayout::below(out_t); below_t != out_t)
-                {
-                    apply_if_parent(below_t);
-                }
-            });
+                    if (const auto above_t = ClockedLayout::above(out_t); above_t != out_t)
+                    {
+                        apply_if_parent(above_t);
+                    }
+                    if (const auto below_t = ClockedLayout::below(out_t); below_t != out_t)
+                    {
+                        apply_if_parent(below_t);
+                    }
+                });
+        }
     }
     /**
      * Returns a container that contains all tiles that accept information from the given one. Thereby,
@@ -1491,6 +1912,9 @@ class gate_level_layout : public ClockedLayout
     template <typename>
     friend class detail::gate_level_drvs_impl;
 
+    template <typename>
+    friend class gate_level_layout_builder;
+
     inline void initialize_truth_table_cache()
     {
         /* reserve the second node for constant 1 */
@@ -1525,9 +1949,7 @@ class gate_level_layout : public ClockedLayout
         {
             clear_tile(t);
 
-            strg->data.tile_node_map[static_cast<signal>(t)] = n;
-
-            strg->data.node_tile_map[n] = static_cast<signal>(t);
+            strg->data.tile_assignment.assign(static_cast<signal>(t), n);
 
             // keep track of number of gates and wire segments
             if (is_wire(n))
@@ -1566,10 +1988,11 @@ class gate_level_layout : public ClockedLayout
         const auto n = static_cast<node>(strg->nodes.size());
         strg->nodes.push_back(node_data);
 
-        /* increase ref-count to children */
+        /* increase ref-count to children and add n to their fanout lists */
         for (const auto& c : children)
         {
             strg->nodes[get_node(c)].data[0].h1++;
+            register_fanout(c, n);
         }
 
         set_value(n, 0);
@@ -1589,6 +2012,298 @@ class gate_level_layout : public ClockedLayout
         const auto& node_data = strg->nodes[n];
         return std::find(node_data.children.cbegin(), node_data.children.cend(), s) != node_data.children.cend();
     }
+
+    void register_fanout(const signal& s, const node n)
+    {
+        strg->data.fanouts.add(s, n);
+    }
+
+    void unregister_fanouts(const node n)
+    {
+        if constexpr (decltype(strg->data.fanouts)::enabled)
+        {
+            for (const auto& c : strg->nodes[n].children)
+            {
+                strg->data.fanouts.remove(c.index, n);
+            }
+        }
+    }
+};
+
+/**
+ * A utility to construct gate-level layouts in bulk. Instead of updating the layout's tile assignment, reference
+ * counts, fanout lists, and PO list with every created node, the builder collects all node placements and their
+ * connections in flat buffers and commits them to the layout in a single pass when `finalize` is called. Thereby,
+ * storage is reserved once and the reference counts are fixed up in one sweep after all nodes have been placed.
+ *
+ * Since signals are pointers to tiles, the builder's `create_...` functions return the same signals as the layout's
+ * would. Children are resolved only upon finalization. Hence, nodes may be created in any order as long as each tile is
+ * assigned at most one node. However, the layout must not be queried for pending nodes before `finalize` was called.
+ *
+ * Nodes are added to the layout in the order of their creation, i.e., node indices, PI order, and PO order are
+ * identical to those obtained by calling the respective functions on the layout directly.
+ *
+ * @tparam Lyt Gate-level layout type.
+ */
+template <typename Lyt>
+class gate_level_layout_builder
+{
+  public:
+    using tile   = typename Lyt::tile;
+    using node   = typename Lyt::node;
+    using signal = typename Lyt::signal;
+    /**
+     * Standard constructor.
+     *
+     * @param target Layout to which all created nodes are added upon finalization.
+     */
+    explicit gate_level_layout_builder(Lyt& target) noexcept : lyt{target}
+    {
+        static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+    }
+    /**
+     * Preallocates the builder's buffers.
+     *
+     * @param num_nodes Number of nodes that are expected to be created.
+     * @param num_children Number of connections that are expected to be created. If 0, two per node are assumed.
+     */
+    void reserve(const std::size_t num_nodes, const std::size_t num_children = 0ull)
+    {
+        pending.reserve(num_nodes);
+        children.reserve(num_children == 0ull ? 2ull * num_nodes : num_children);
+    }
+
+    signal create_pi(const std::string& name = {}, const tile& t = {})
+    {
+        return add({}, 2, node_kind::PI, t, name);
+    }
+
+    signal create_po(const signal& s, const std::string& name = {}, const tile& t = {})
+    {
+        return add({s}, 2, node_kind::PO, t, name);
+    }
+
+    signal create_buf(const signal& a, const tile& t = {})
+    {
+        return add({a}, 2, node_kind::GATE, t);
+    }
+    /**
+     * Creates a run of wire segments on the given tiles. The first segment is fed by `s` and each further one by its
+     * predecessor. The result is equivalent to calling `create_buf` for each tile. However, since the children of all
+     * but the first segment are known to be the preceding nodes, they are resolved upon finalization without looking
+     * up any tiles.
+     *
+     * @param s Signal that feeds the first wire segment.
+     * @param tiles Tiles of the wire segments in order of information flow.
+     * @return Signal of the last wire segment or `s` if `tiles` is empty.
+     */
+    signal create_wire_run(const signal& s, const std::vector<tile>& tiles)
+    {
+        auto a = s;
+
+        for (const auto& t : tiles)
+        {
+            a = add({a}, 2, node_kind::GATE, t, {}, a != s);
+        }
+
+        return a;
+    }
+
+    signal create_not(const signal& a, const tile& t = {})
+    {
+        return add({a}, 3, node_kind::GATE, t);
+    }
+
+    signal create_and(const signal& a, const signal& b, const tile& t = {})
+    {
+        return add({a, b}, 4, node_kind::GATE, t);
+    }
+
+    signal create_nand(const signal& a, const signal& b, const tile& t = {})
+    {
+        return add({a, b}, 5, node_kind::GATE, t);
+    }
+
+    signal create_or(const signal& a, const signal& b, const tile& t = {})
+    {
+        return add({a, b}, 6, node_kind::GATE, t);
+    }
+
+    signal create_nor(const signal& a, const signal& b, const tile& t = {})
+    {
+        return add({a, b}, 7, node_kind::GATE, t);
+    }
+
+    signal create_xor(const signal& a, const signal& b, const tile& t = {})
+    {
+        return add({a, b}, 8, node_kind::GATE, t);
+    }
+
+    signal create_xnor(const signal& a, const signal& b, const tile& t = {})
+    {
+        return add({a, b}, 9, node_kind::GATE, t);
+    }
+
+    signal create_maj(const signal& a, const signal& b, const signal& c, const tile& t = {})
+    {
+        return add({a, b, c}, 10, node_kind::GATE, t);
+    }
+
+    signal create_node(const std::vector<signal>& fanins, const kitty::dynamic_truth_table& function,
+                       const tile& t = {})
+    {
+        if (fanins.empty())
+        {
+            assert(function.num_vars() == 0u);
+            return lyt.get_constant(!kitty::is_const0(function));
+        }
+
+        const auto literal = lyt.strg->data.fn_cache.insert(function);
+
+        const auto first_child = static_cast<uint32_t>(children.size());
+        children.insert(children.cend(), fanins.cbegin(), fanins.cend());
+        pending.push_back({t, literal, node_kind::GATE, first_child, static_cast<uint32_t>(fanins.size()), false});
+
+        return static_cast<signal>(t);
+    }
+    /**
+     * Returns the number of nodes that have been created but not yet committed to the layout.
+     *
+     * @return Number of pending nodes.
+     */
+    [[nodiscard]] std::size_t num_pending() const noexcept
+    {
+        return pending.size();
+    }
+    /**
+     * Commits all pending nodes to the layout and resets the builder such that it can be reused.
+     */
+    void finalize()
+    {
+        auto& strg = *lyt.strg;
+
+        const auto first_node = static_cast<node>(strg.nodes.size());
+
+        // grow geometrically such that repeated finalizations, e.g., when streaming, take amortized linear time
+        if (const auto required = strg.nodes.size() + pending.size(); required > strg.nodes.capacity())
+        {
+            // reserve excludes the two constants
+            lyt.reserve(std::max(required, std::size_t{2} * strg.nodes.capacity()) - 2ull);
+            strg.data.fanouts.reserve(std::max(strg.data.fanouts.size() + children.size(), std::size_t{2} * required));
+        }
+
+        auto io_name = io_names.cbegin();
+
+        // first pass: create nodes and assign them to their tiles
+        for (std::size_t i = 0; i < pending.size(); ++i)
+        {
+            const auto& p = pending[i];
+            const auto  n = static_cast<node>(first_node + i);
+
+            auto& node_data      = strg.nodes.emplace_back();
+            node_data.data[1].h1 = p.literal;
+            std::copy(children.cbegin() + p.first_child, children.cbegin() + p.first_child + p.num_children,
+                      std::back_inserter(node_data.children));
+
+            if (p.kind == node_kind::PI)
+            {
+                strg.inputs.emplace_back(n);
+                strg.data.node_names[n] = io_name->empty() ? fmt::format("pi{}", lyt.num_pis()) : *io_name;
+                ++io_name;
+            }
+            else if (p.kind == node_kind::PO)
+            {
+                strg.outputs.emplace_back(static_cast<signal>(p.t));
+                strg.data.node_names[n] = io_name->empty() ? fmt::format("po{}", lyt.num_pos()) : *io_name;
+                ++io_name;
+            }
+
+            lyt.assign_node(p.t, n);
+        }
+
+        // second pass: all tiles are assigned now, fix up reference counts and fanout lists
+        for (std::size_t i = 0; i < pending.size(); ++i)
+        {
+            const auto& p = pending[i];
+            const auto  n = static_cast<node>(first_node + i);
+
+            for (auto c = p.first_child; c < p.first_child + p.num_children; ++c)
+            {
+                strg.nodes[p.chained ? n - 1 : lyt.get_node(children[c])].data[0].h1++;
+                lyt.register_fanout(children[c], n);
+            }
+        }
+
+        for (std::size_t i = 0; i < pending.size(); ++i)
+        {
+            if (pending[i].kind == node_kind::GATE)
+            {
+                for (auto const& fn : lyt.evnts->on_add)
+                {
+                    (*fn)(static_cast<node>(first_node + i));
+                }
+            }
+        }
+
+        pending.clear();
+        children.clear();
+        io_names.clear();
+    }
+
+  private:
+    /**
+     * Kinds of nodes that require different treatment during finalization.
+     */
+    enum class node_kind : uint8_t
+    {
+        PI,
+        PO,
+        GATE
+    };
+    /**
+     * A node that has been created but not yet committed to the layout. Its children are stored in a shared buffer.
+     * If `chained` is set, its only child is the node that was created right before it.
+     */
+    struct pending_node
+    {
+        tile      t;
+        uint32_t  literal;
+        node_kind kind;
+        uint32_t  first_child;
+        uint32_t  num_children;
+        bool      chained;
+    };
+    /**
+     * The layout under construction.
+     */
+    Lyt& lyt;
+    /**
+     * Nodes in order of their creation.
+     */
+    std::vector<pending_node> pending{};
+    /**
+     * Flat buffer of all pending nodes' children.
+     */
+    std::vector<signal> children{};
+    /**
+     * Names of all pending PIs and POs in order of their creation. Other nodes are unnamed.
+     */
+    std::vector<std::string> io_names{};
+
+    signal add(const std::initializer_list<signal> fanins, const uint32_t literal, const node_kind kind, const tile& t,
+               const std::string& name = {}, const bool chained = false)
+    {
+        const auto first_child = static_cast<uint32_t>(children.size());
+        children.insert(children.cend(), fanins.begin(), fanins.end());
+        pending.push_back({t, literal, kind, first_child, static_cast<uint32_t>(fanins.size()), chained});
+
+        if (kind != node_kind::GATE)
+        {
+            io_names.push_back(name);
+        }
+
+        return static_cast<signal>(t);
+    }
 };
 
 }  // namespace fiction
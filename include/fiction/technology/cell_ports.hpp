@@ -9,7 +9,9 @@
 
 #include <fmt/format.h>
 
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <set>
@@ -197,6 +199,98 @@ struct port_list
         return *this;
     }
 };
+/**
+ * Port masks are compact encodings of port lists. Each bit represents the presence of a port at one of a library's
+ * port slots, where the lower bits refer to input and the upper bits refer to output slots. Since gate libraries only
+ * use a few distinct ports, port masks are small integers that can be compared, combined, and used as table indices
+ * without any allocation.
+ */
+using port_mask = uint16_t;
+/**
+ * Assigns the ports of a gate library to the bits of a `port_mask` and translates between both representations.
+ *
+ * @tparam PortType A port type, e.g., port_position or port_direction.
+ * @tparam NumInputs Number of input port slots.
+ * @tparam NumOutputs Number of output port slots.
+ */
+template <typename PortType, std::size_t NumInputs, std::size_t NumOutputs>
+struct port_mask_encoding
+{
+    static_assert(NumInputs + NumOutputs <= 16, "port masks can encode at most 16 port slots");
+    /**
+     * Number of bits occupied by port masks of this encoding.
+     */
+    static constexpr std::size_t num_bits = NumInputs + NumOutputs;
+    /**
+     * Ports that are represented by the input and output slots, respectively.
+     */
+    std::array<PortType, NumInputs>  inp;
+    std::array<PortType, NumOutputs> out;
+    /**
+     * Returns the mask bit of the given input slot.
+     *
+     * @param slot Input slot index.
+     * @return Port mask with only the bit of input slot `slot` set.
+     */
+    [[nodiscard]] static constexpr port_mask input(const std::size_t slot) noexcept
+    {
+        assert(slot < NumInputs);
+
+        return static_cast<port_mask>(1u << slot);
+    }
+    /**
+     * Returns the mask bit of the given output slot.
+     *
+     * @param slot Output slot index.
+     * @return Port mask with only the bit of output slot `slot` set.
+     */
+    [[nodiscard]] static constexpr port_mask output(const std::size_t slot) noexcept
+    {
+        assert(slot < NumOutputs);
+
+        return static_cast<port_mask>(1u << (NumInputs + slot));
+    }
+    /**
+     * Concatenates two port masks of this encoding, e.g., to look up the ports of two stacked tiles at once.
+     *
+     * @param lower Port mask that occupies the lower bits.
+     * @param upper Port mask that occupies the upper bits.
+     * @return Concatenation of `upper` and `lower`.
+     */
+    [[nodiscard]] static constexpr port_mask concatenate(const port_mask lower, const port_mask upper) noexcept
+    {
+        assert(2 * num_bits <= 16);
+
+        return static_cast<port_mask>(lower | (upper << num_bits));
+    }
+    /**
+     * Expands the given port mask into a port list.
+     *
+     * @param m Port mask to expand.
+     * @return Port list that contains the ports of all slots set in `m`.
+     */
+    [[nodiscard]] port_list<PortType> decode(const port_mask m) const
+    {
+        port_list<PortType> p{};
+
+        for (std::size_t i = 0; i < NumInputs; ++i)
+        {
+            if ((m & input(i)) != 0u)
+            {
+                p.inp.insert(inp[i]);
+            }
+        }
+        for (std::size_t i = 0; i < NumOutputs; ++i)
+        {
+            if ((m & output(i)) != 0u)
+            {
+                p.out.insert(out[i]);
+            }
+        }
+
+        return p;
+    }
+};
 
 }  // namespace fiction
 
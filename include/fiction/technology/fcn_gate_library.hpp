@@ -15,8 +15,11 @@
 #include <kitty/hash.hpp>
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -73,6 +76,77 @@ class unsupported_gate_orientation_exception : public std::exception
     const port_list<PortType> ports;
 };
 
+/**
+ * A lookup table from port masks to gates that can be generated at compile time. Since port masks consist of only a
+ * few bits, they directly index a dense array of entry numbers, i.e., the table is a collision-free (perfect) hash map
+ * that neither allocates nor throws on look-up. Gate libraries can use it to replace hash maps from port lists to gates
+ * in their `set_up_gate` implementations.
+ *
+ * @tparam Gate Gate type, e.g., `fcn_gate_library::fcn_gate`.
+ * @tparam KeyBits Number of bits of the port masks that are used as keys.
+ * @tparam NumEntries Number of stored gates.
+ */
+template <typename Gate, std::size_t KeyBits, std::size_t NumEntries>
+class port_gate_table
+{
+  public:
+    static_assert(KeyBits <= 16, "port masks consist of at most 16 bits");
+    static_assert(NumEntries < 256, "entry numbers must fit into a byte");
+    /**
+     * Standard constructor. If a port mask occurs multiple times in `entries`, its last occurrence is stored.
+     *
+     * @param entries Pairs of port masks and the gates that realize them.
+     */
+    constexpr explicit port_gate_table(const std::pair<port_mask, Gate> (&entries)[NumEntries]) noexcept
+    {
+        for (std::size_t i = 0; i < NumEntries; ++i)
+        {
+            gates[i]                = entries[i].second;
+            index[entries[i].first] = static_cast<uint8_t>(i + 1);
+        }
+    }
+    /**
+     * Looks up the gate that is stored for the given port mask.
+     *
+     * @param m Port mask to look up.
+     * @return Pointer to the gate stored for `m` or `nullptr` if there is none.
+     */
+    [[nodiscard]] constexpr const Gate* find(const port_mask m) const noexcept
+    {
+        if (m >= index.size() || index[m] == 0)
+        {
+            return nullptr;
+        }
+
+        return &gates[index[m] - 1];
+    }
+
+  private:
+    /**
+     * Stored gates.
+     */
+    std::array<Gate, NumEntries> gates{};
+    /**
+     * Maps each port mask to its entry number in `gates` offset by 1. 0 indicates that no gate is stored.
+     */
+    std::array<uint8_t, std::size_t{1} << KeyBits> index{};
+};
+/**
+ * Creates a `port_gate_table` whose size is deduced from the given entries.
+ *
+ * @tparam KeyBits Number of bits of the port masks that are used as keys.
+ * @tparam Gate Gate type.
+ * @tparam NumEntries Number of stored gates.
+ * @param entries Pairs of port masks and the gates that realize them.
+ * @return Lookup table that contains all `entries`.
+ */
+template <std::size_t KeyBits, typename Gate, std::size_t NumEntries>
+constexpr port_gate_table<Gate, KeyBits, NumEntries>
+make_port_gate_table(const std::pair<port_mask, Gate> (&entries)[NumEntries]) noexcept
+{
+    return port_gate_table<Gate, KeyBits, NumEntries>{entries};
+}
+
 /**
  * Base class for various FCN libraries used to map gate-level layouts to cell-level ones. Any new gate library can
  * extend `fcn_gate_library` if it benefits from its features but does not have to. The only requirement is that it must
@@ -292,8 +366,14 @@ class fcn_gate_library
     {
         fcn_gate rev_cols = g;
 
-        std::for_each(std::begin(rev_cols), std::end(rev_cols),
-                      [](auto& i) { std::reverse(std::begin(i), std::end(i)); });
+        // index-based instead of std::reverse, which is not constexpr before C++20
+        for (auto y = 0ul; y < GateSizeY; ++y)
+        {
+            for (auto x = 0ul; x < GateSizeX; ++x)
+            {
+                rev_cols[y][x] = g[y][GateSizeX - 1 - x];
+            }
+        }
 
         return rev_cols;
     }
@@ -307,7 +387,10 @@ class fcn_gate_library
     {
         fcn_gate rev_rows = g;
 
-        std::reverse(std::begin(rev_rows), std::end(rev_rows));
+        for (auto y = 0ul; y < GateSizeY; ++y)
+        {
+            rev_rows[y] = g[GateSizeY - 1 - y];
+        }
 
         return rev_rows;
     }
@@ -13,8 +13,8 @@
 
 #include <fmt/format.h>
 #include <mockturtle/traits.hpp>
-#include <phmap.h>
 
+#include <cstddef>
 #include <vector>
 
 namespace fiction
@@ -48,63 +48,56 @@ class qca_one_library : public fcn_gate_library<qca_technology, 5, 5>
         static_assert(is_gate_level_layout_v<GateLyt>, "Lyt must be a gate-level layout");
 
         const auto n = lyt.get_node(t);
-        const auto p = determine_port_routing(lyt, t);
+        const auto p = determine_port_mask(lyt, t);
 
-        try
+        if constexpr (fiction::has_is_fanout_v<GateLyt>)
         {
-            if constexpr (fiction::has_is_fanout_v<GateLyt>)
+            if (lyt.is_fanout(n))
             {
-                if (lyt.is_fanout(n))
+                if (lyt.fanout_size(n) == 2)
                 {
-                    if (lyt.fanout_size(n) == 2)
-                    {
-                        return FANOUT_MAP.at(p);
-                    }
-                    if (lyt.fanout_size(n) == 3)
-                    {
-                        return FAN_OUT_1_3;
-                    }
+                    return look_up(FANOUT_TABLE, p, t);
                 }
-            }
-            if constexpr (fiction::has_is_buf_v<GateLyt>)
-            {
-                if (lyt.is_buf(n))
+                if (lyt.fanout_size(n) == 3)
                 {
-                    return WIRE_MAP.at(p);
+                    return FAN_OUT_1_3;
                 }
             }
-            if constexpr (fiction::has_is_inv_v<GateLyt>)
+        }
+        if constexpr (fiction::has_is_buf_v<GateLyt>)
+        {
+            if (lyt.is_buf(n))
             {
-                if (lyt.is_inv(n))
-                {
-                    return INVERTER_MAP.at(p);
-                }
+                return look_up(WIRE_TABLE, p, t);
             }
-            if constexpr (mockturtle::has_is_and_v<GateLyt>)
+        }
+        if constexpr (fiction::has_is_inv_v<GateLyt>)
+        {
+            if (lyt.is_inv(n))
             {
-                if (lyt.is_and(n))
-                {
-                    return CONJUNCTION_MAP.at(p);
-                }
+                return look_up(INVERTER_TABLE, p, t);
             }
-            if constexpr (mockturtle::has_is_or_v<GateLyt>)
+        }
+        if constexpr (mockturtle::has_is_and_v<GateLyt>)
+        {
+            if (lyt.is_and(n))
             {
-                if (lyt.is_or(n))
-                {
-                    return DISJUNCTION_MAP.at(p);
-                }
+                return look_up(CONJUNCTION_TABLE, p, t);
             }
-            if constexpr (mockturtle::has_is_maj_v<GateLyt>)
+        }
+        if constexpr (mockturtle::has_is_or_v<GateLyt>)
+        {
+            if (lyt.is_or(n))
             {
-                if (lyt.is_maj(n))
-                {
-                    return MAJORITY;
-                }
+                return look_up(DISJUNCTION_TABLE, p, t);
             }
         }
-        catch (const std::out_of_range&)
+        if constexpr (mockturtle::has_is_maj_v<GateLyt>)
         {
-            throw unsupported_gate_orientation_exception(t, p);
+            if (lyt.is_maj(n))
+            {
+                return MAJORITY;
+            }
         }
 
         throw unsupported_gate_type_exception(t);
@@ -147,45 +140,54 @@ class qca_one_library : public fcn_gate_library<qca_technology, 5, 5>
     }
 
   private:
+    /**
+     * Determines the ports of the given tile as a compact port mask over the tile's four border centers, which serve as
+     * input and output slots of `port_encoding`. Gates without incoming or outgoing signals are assigned default ports.
+     *
+     * @tparam Lyt Cartesian gate-level layout type.
+     * @param lyt Layout that hosts tile `t`.
+     * @param t Tile whose ports are to be determined.
+     * @return Port mask of `t`.
+     */
     template <typename Lyt>
-    [[nodiscard]] static port_list<port_position> determine_port_routing(const Lyt& lyt, const tile<Lyt>& t) noexcept
+    [[nodiscard]] static port_mask determine_port_mask(const Lyt& lyt, const tile<Lyt>& t) noexcept
     {
-        port_list<port_position> p{};
+        port_mask p{0};
 
         // determine incoming connector ports
         if (lyt.has_northern_incoming_signal(t))
         {
-            p.inp.emplace(2u, 0u);
+            p |= IN_N;
         }
         if (lyt.has_eastern_incoming_signal(t))
         {
-            p.inp.emplace(4u, 2u);
+            p |= IN_E;
         }
         if (lyt.has_southern_incoming_signal(t))
         {
-            p.inp.emplace(2u, 4u);
+            p |= IN_S;
         }
         if (lyt.has_western_incoming_signal(t))
         {
-            p.inp.emplace(0u, 2u);
+            p |= IN_W;
         }
 
         // determine outgoing connector ports
         if (lyt.has_northern_outgoing_signal(t))
         {
-            p.out.emplace(2u, 0u);
+            p |= OUT_N;
         }
         if (lyt.has_eastern_outgoing_signal(t))
         {
-            p.out.emplace(4u, 2u);
+            p |= OUT_E;
         }
         if (lyt.has_southern_outgoing_signal(t))
         {
-            p.out.emplace(2u, 4u);
+            p |= OUT_S;
         }
         if (lyt.has_western_outgoing_signal(t))
         {
-            p.out.emplace(0u, 2u);
+            p |= OUT_W;
         }
 
         // has no connector ports
@@ -193,17 +195,38 @@ class qca_one_library : public fcn_gate_library<qca_technology, 5, 5>
         {
             if (lyt.has_no_incoming_signal(t))
             {
-                p.inp.emplace(0u, 2u);
+                p |= IN_W;
             }
 
             if (lyt.has_no_outgoing_signal(t))
             {
-                p.out.emplace(4u, 2u);
+                p |= OUT_E;
             }
         }
 
         return p;
     }
+    /**
+     * Looks up the gate that realizes the given port mask in the given table.
+     *
+     * @tparam Table `port_gate_table` type.
+     * @tparam CoordinateType Type of the tile coordinates.
+     * @param table Table to search.
+     * @param p Port mask to look up.
+     * @param t Tile that is to be realized.
+     * @return Gate that is stored for `p` in `table`.
+     * @throws unsupported_gate_orientation_exception If `table` does not contain a gate for `p`.
+     */
+    template <typename Table, typename CoordinateType>
+    [[nodiscard]] static fcn_gate look_up(const Table& table, const port_mask p, const CoordinateType& t)
+    {
+        if (const auto* const g = table.find(p); g != nullptr)
+        {
+            return *g;
+        }
+
+        throw unsupported_gate_orientation_exception(t, PORT_ENCODING.decode(p));
+    }
 
     // clang-format off
 
@@ -390,140 +413,154 @@ class qca_one_library : public fcn_gate_library<qca_technology, 5, 5>
 
     // clang-format on
 
-    using port_gate_map = phmap::flat_hash_map<port_list<port_position>, fcn_gate>;
+    /**
+     * Port mask encoding over the centers of the northern, eastern, southern, and western tile borders, each of which
+     * can serve as input and output port.
+     */
+    using port_encoding = port_mask_encoding<port_position, 4, 4>;
+    /**
+     * Assignment of the library's connector ports to port mask bits.
+     */
+    static constexpr const port_encoding PORT_ENCODING{
+        {{port_position(2, 0), port_position(4, 2), port_position(2, 4), port_position(0, 2)}},
+        {{port_position(2, 0), port_position(4, 2), port_position(2, 4), port_position(0, 2)}}};
+    /**
+     * Port mask bits of the individual connector ports.
+     */
+    static constexpr const port_mask IN_N  = port_encoding::input(0);
+    static constexpr const port_mask IN_E  = port_encoding::input(1);
+    static constexpr const port_mask IN_S  = port_encoding::input(2);
+    static constexpr const port_mask IN_W  = port_encoding::input(3);
+    static constexpr const port_mask OUT_N = port_encoding::output(0);
+    static constexpr const port_mask OUT_E = port_encoding::output(1);
+    static constexpr const port_mask OUT_S = port_encoding::output(2);
+    static constexpr const port_mask OUT_W = port_encoding::output(3);
+    /**
+     * Number of bits of the port masks that are used as keys.
+     */
+    static constexpr const std::size_t KEY_BITS = port_encoding::num_bits;
     /**
      * Lookup table for wire rotations. Maps ports to corresponding wires.
+     *
+     * Since the port masks only encode the centers of the tile borders, wires that enter or leave a tile off-center,
+     * i.e., the inner and outer side wires for tiles that host multiple wires, cannot be looked up and are thus not
+     * part of this table.
      */
-    static inline const port_gate_map WIRE_MAP = {
+    static constexpr const auto WIRE_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
         // primary inputs
-        {{{}, {port_position(2, 0)}}, PRIMARY_INPUT_PORT},
-        {{{}, {port_position(4, 2)}}, rotate_90(PRIMARY_INPUT_PORT)},
-        {{{}, {port_position(2, 4)}}, rotate_180(PRIMARY_INPUT_PORT)},
-        {{{}, {port_position(0, 2)}}, rotate_270(PRIMARY_INPUT_PORT)},
+        {OUT_N, PRIMARY_INPUT_PORT},
+        {OUT_E, rotate_90(PRIMARY_INPUT_PORT)},
+        {OUT_S, rotate_180(PRIMARY_INPUT_PORT)},
+        {OUT_W, rotate_270(PRIMARY_INPUT_PORT)},
         // primary outputs
-        {{{port_position(2, 0)}, {}}, PRIMARY_OUTPUT_PORT},
-        {{{port_position(4, 2)}, {}}, rotate_90(PRIMARY_OUTPUT_PORT)},
-        {{{port_position(2, 4)}, {}}, rotate_180(PRIMARY_OUTPUT_PORT)},
-        {{{port_position(0, 2)}, {}}, rotate_270(PRIMARY_OUTPUT_PORT)},
+        {IN_N, PRIMARY_OUTPUT_PORT},
+        {IN_E, rotate_90(PRIMARY_OUTPUT_PORT)},
+        {IN_S, rotate_180(PRIMARY_OUTPUT_PORT)},
+        {IN_W, rotate_270(PRIMARY_OUTPUT_PORT)},
         // center wire
-        {{{port_position(2, 0)}, {port_position(2, 4)}}, CENTER_WIRE},
-        {{{port_position(2, 4)}, {port_position(2, 0)}}, CENTER_WIRE},
-        {{{port_position(0, 2)}, {port_position(4, 2)}}, rotate_90(CENTER_WIRE)},
-        {{{port_position(4, 2)}, {port_position(0, 2)}}, rotate_90(CENTER_WIRE)},
-        // inner side wire
-        {{{port_position(3, 0)}, {port_position(3, 4)}}, INNER_SIDE_WIRE},
-        {{{port_position(3, 4)}, {port_position(3, 0)}}, INNER_SIDE_WIRE},
-        {{{port_position(0, 3)}, {port_position(4, 3)}}, rotate_90(INNER_SIDE_WIRE)},
-        {{{port_position(4, 3)}, {port_position(0, 3)}}, rotate_90(INNER_SIDE_WIRE)},
-        {{{port_position(1, 0)}, {port_position(1, 4)}}, rotate_180(INNER_SIDE_WIRE)},
-        {{{port_position(1, 4)}, {port_position(1, 0)}}, rotate_180(INNER_SIDE_WIRE)},
-        {{{port_position(0, 1)}, {port_position(4, 1)}}, rotate_270(INNER_SIDE_WIRE)},
-        {{{port_position(4, 1)}, {port_position(0, 1)}}, rotate_270(INNER_SIDE_WIRE)},
-        // outer side wire
-        {{{port_position(4, 0)}, {port_position(4, 4)}}, OUTER_SIDE_WIRE},
-        {{{port_position(4, 4)}, {port_position(4, 0)}}, OUTER_SIDE_WIRE},
-        {{{port_position(0, 4)}, {port_position(4, 4)}}, rotate_90(OUTER_SIDE_WIRE)},
-        {{{port_position(4, 4)}, {port_position(0, 4)}}, rotate_90(OUTER_SIDE_WIRE)},
-        {{{port_position(0, 0)}, {port_position(0, 4)}}, rotate_180(OUTER_SIDE_WIRE)},
-        {{{port_position(0, 4)}, {port_position(0, 0)}}, rotate_180(OUTER_SIDE_WIRE)},
-        {{{port_position(0, 0)}, {port_position(4, 0)}}, rotate_270(OUTER_SIDE_WIRE)},
-        {{{port_position(4, 0)}, {port_position(0, 0)}}, rotate_270(OUTER_SIDE_WIRE)},
+        {IN_N | OUT_S, CENTER_WIRE},
+        {IN_S | OUT_N, CENTER_WIRE},
+        {IN_W | OUT_E, rotate_90(CENTER_WIRE)},
+        {IN_E | OUT_W, rotate_90(CENTER_WIRE)},
         // center bent wire
-        {{{port_position(2, 0)}, {port_position(4, 2)}}, CENTER_BENT_WIRE},
-        {{{port_position(4, 2)}, {port_position(2, 0)}}, CENTER_BENT_WIRE},
-        {{{port_position(4, 2)}, {port_position(2, 4)}}, rotate_90(CENTER_BENT_WIRE)},
-        {{{port_position(2, 4)}, {port_position(4, 2)}}, rotate_90(CENTER_BENT_WIRE)},
-        {{{port_position(0, 2)}, {port_position(2, 4)}}, rotate_180(CENTER_BENT_WIRE)},
-        {{{port_position(2, 4)}, {port_position(0, 2)}}, rotate_180(CENTER_BENT_WIRE)},
-        {{{port_position(2, 0)}, {port_position(0, 2)}}, rotate_270(CENTER_BENT_WIRE)},
-        {{{port_position(0, 2)}, {port_position(2, 0)}}, rotate_270(CENTER_BENT_WIRE)}
-        // TODO more wires go here!
-    };
+        {IN_N | OUT_E, CENTER_BENT_WIRE},
+        {IN_E | OUT_N, CENTER_BENT_WIRE},
+        {IN_E | OUT_S, rotate_90(CENTER_BENT_WIRE)},
+        {IN_S | OUT_E, rotate_90(CENTER_BENT_WIRE)},
+        {IN_W | OUT_S, rotate_180(CENTER_BENT_WIRE)},
+        {IN_S | OUT_W, rotate_180(CENTER_BENT_WIRE)},
+        {IN_N | OUT_W, rotate_270(CENTER_BENT_WIRE)},
+        {IN_W | OUT_N, rotate_270(CENTER_BENT_WIRE)},
+    });
     /**
      * Lookup table for inverter rotations. Maps ports to corresponding inverters.
      */
-    static inline const port_gate_map INVERTER_MAP = {
+    static constexpr const auto INVERTER_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
         // straight inverters
-        {{{port_position(2, 0)}, {port_position(2, 4)}}, STRAIGHT_INVERTER},
-        {{{port_position(4, 2)}, {port_position(0, 2)}}, rotate_90(STRAIGHT_INVERTER)},
-        {{{port_position(2, 4)}, {port_position(2, 0)}}, rotate_180(STRAIGHT_INVERTER)},
-        {{{port_position(0, 2)}, {port_position(4, 2)}}, rotate_270(STRAIGHT_INVERTER)},
+        {IN_N | OUT_S, STRAIGHT_INVERTER},
+        {IN_E | OUT_W, rotate_90(STRAIGHT_INVERTER)},
+        {IN_S | OUT_N, rotate_180(STRAIGHT_INVERTER)},
+        {IN_W | OUT_E, rotate_270(STRAIGHT_INVERTER)},
         // without outputs
-        {{{port_position(2, 0)}, {}}, STRAIGHT_INVERTER},
-        {{{port_position(4, 2)}, {}}, rotate_90(STRAIGHT_INVERTER)},
-        {{{port_position(2, 4)}, {}}, rotate_180(STRAIGHT_INVERTER)},
-        {{{port_position(0, 2)}, {}}, rotate_270(STRAIGHT_INVERTER)},
+        {IN_N, STRAIGHT_INVERTER},
+        {IN_E, rotate_90(STRAIGHT_INVERTER)},
+        {IN_S, rotate_180(STRAIGHT_INVERTER)},
+        {IN_W, rotate_270(STRAIGHT_INVERTER)},
         // without inputs
-        {{{}, {port_position(2, 4)}}, STRAIGHT_INVERTER},
-        {{{}, {port_position(0, 2)}}, rotate_90(STRAIGHT_INVERTER)},
-        {{{}, {port_position(2, 0)}}, rotate_180(STRAIGHT_INVERTER)},
-        {{{}, {port_position(4, 2)}}, rotate_270(STRAIGHT_INVERTER)},
+        {OUT_S, STRAIGHT_INVERTER},
+        {OUT_W, rotate_90(STRAIGHT_INVERTER)},
+        {OUT_N, rotate_180(STRAIGHT_INVERTER)},
+        {OUT_E, rotate_270(STRAIGHT_INVERTER)},
         // bent inverters
-        {{{port_position(2, 0)}, {port_position(4, 2)}}, BENT_INVERTER},
-        {{{port_position(4, 2)}, {port_position(2, 0)}}, BENT_INVERTER},
-        {{{port_position(4, 2)}, {port_position(2, 4)}}, rotate_90(BENT_INVERTER)},
-        {{{port_position(2, 4)}, {port_position(4, 2)}}, rotate_90(BENT_INVERTER)},
-        {{{port_position(0, 2)}, {port_position(2, 4)}}, rotate_180(BENT_INVERTER)},
-        {{{port_position(2, 4)}, {port_position(0, 2)}}, rotate_180(BENT_INVERTER)},
-        {{{port_position(2, 0)}, {port_position(0, 2)}}, rotate_270(BENT_INVERTER)},
-        {{{port_position(0, 2)}, {port_position(2, 0)}}, rotate_270(BENT_INVERTER)}};
+        {IN_N | OUT_E, BENT_INVERTER},
+        {IN_E | OUT_N, BENT_INVERTER},
+        {IN_E | OUT_S, rotate_90(BENT_INVERTER)},
+        {IN_S | OUT_E, rotate_90(BENT_INVERTER)},
+        {IN_W | OUT_S, rotate_180(BENT_INVERTER)},
+        {IN_S | OUT_W, rotate_180(BENT_INVERTER)},
+        {IN_N | OUT_W, rotate_270(BENT_INVERTER)},
+        {IN_W | OUT_N, rotate_270(BENT_INVERTER)},
+    });
     /**
      * Lookup table for conjunction rotations. Maps ports to corresponding AND gates.
      */
-    static inline const port_gate_map CONJUNCTION_MAP = {
-        {{{port_position(0, 2), port_position(2, 4)}, {port_position(4, 2)}}, CONJUNCTION},
-        {{{port_position(0, 2), port_position(4, 2)}, {port_position(2, 4)}}, CONJUNCTION},
-        {{{port_position(2, 4), port_position(4, 2)}, {port_position(0, 2)}}, CONJUNCTION},
-
-        {{{port_position(0, 2), port_position(2, 4)}, {port_position(2, 0)}}, rotate_90(CONJUNCTION)},
-        {{{port_position(0, 2), port_position(2, 0)}, {port_position(2, 4)}}, rotate_90(CONJUNCTION)},
-        {{{port_position(2, 4), port_position(2, 0)}, {port_position(0, 2)}}, rotate_90(CONJUNCTION)},
-
-        {{{port_position(0, 2), port_position(4, 2)}, {port_position(2, 0)}}, rotate_180(CONJUNCTION)},
-        {{{port_position(0, 2), port_position(2, 0)}, {port_position(4, 2)}}, rotate_180(CONJUNCTION)},
-        {{{port_position(4, 2), port_position(2, 0)}, {port_position(0, 2)}}, rotate_180(CONJUNCTION)},
-
-        {{{port_position(2, 4), port_position(4, 2)}, {port_position(2, 0)}}, rotate_270(CONJUNCTION)},
-        {{{port_position(2, 4), port_position(2, 0)}, {port_position(4, 2)}}, rotate_270(CONJUNCTION)},
-        {{{port_position(4, 2), port_position(2, 0)}, {port_position(2, 4)}}, rotate_270(CONJUNCTION)}};
+    static constexpr const auto CONJUNCTION_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
+        {IN_W | IN_S | OUT_E, CONJUNCTION},
+        {IN_W | IN_E | OUT_S, CONJUNCTION},
+        {IN_S | IN_E | OUT_W, CONJUNCTION},
+
+        {IN_W | IN_S | OUT_N, rotate_90(CONJUNCTION)},
+        {IN_W | IN_N | OUT_S, rotate_90(CONJUNCTION)},
+        {IN_S | IN_N | OUT_W, rotate_90(CONJUNCTION)},
+
+        {IN_W | IN_E | OUT_N, rotate_180(CONJUNCTION)},
+        {IN_W | IN_N | OUT_E, rotate_180(CONJUNCTION)},
+        {IN_E | IN_N | OUT_W, rotate_180(CONJUNCTION)},
+
+        {IN_S | IN_E | OUT_N, rotate_270(CONJUNCTION)},
+        {IN_S | IN_N | OUT_E, rotate_270(CONJUNCTION)},
+        {IN_E | IN_N | OUT_S, rotate_270(CONJUNCTION)},
+    });
     /**
      * Lookup table for disjunction rotations. Maps ports to corresponding OR gates.
      */
-    static inline const port_gate_map DISJUNCTION_MAP = {
-        {{{port_position(0, 2), port_position(2, 4)}, {port_position(4, 2)}}, DISJUNCTION},
-        {{{port_position(0, 2), port_position(4, 2)}, {port_position(2, 4)}}, DISJUNCTION},
-        {{{port_position(2, 4), port_position(4, 2)}, {port_position(0, 2)}}, DISJUNCTION},
-
-        {{{port_position(0, 2), port_position(2, 4)}, {port_position(2, 0)}}, rotate_90(DISJUNCTION)},
-        {{{port_position(0, 2), port_position(2, 0)}, {port_position(2, 4)}}, rotate_90(DISJUNCTION)},
-        {{{port_position(2, 4), port_position(2, 0)}, {port_position(0, 2)}}, rotate_90(DISJUNCTION)},
-
-        {{{port_position(0, 2), port_position(4, 2)}, {port_position(2, 0)}}, rotate_180(DISJUNCTION)},
-        {{{port_position(0, 2), port_position(2, 0)}, {port_position(4, 2)}}, rotate_180(DISJUNCTION)},
-        {{{port_position(4, 2), port_position(2, 0)}, {port_position(0, 2)}}, rotate_180(DISJUNCTION)},
-
-        {{{port_position(2, 4), port_position(4, 2)}, {port_position(2, 0)}}, rotate_270(DISJUNCTION)},
-        {{{port_position(2, 4), port_position(2, 0)}, {port_position(4, 2)}}, rotate_270(DISJUNCTION)},
-        {{{port_position(4, 2), port_position(2, 0)}, {port_position(2, 4)}}, rotate_270(DISJUNCTION)}};
+    static constexpr const auto DISJUNCTION_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
+        {IN_W | IN_S | OUT_E, DISJUNCTION},
+        {IN_W | IN_E | OUT_S, DISJUNCTION},
+        {IN_S | IN_E | OUT_W, DISJUNCTION},
+
+        {IN_W | IN_S | OUT_N, rotate_90(DISJUNCTION)},
+        {IN_W | IN_N | OUT_S, rotate_90(DISJUNCTION)},
+        {IN_S | IN_N | OUT_W, rotate_90(DISJUNCTION)},
+
+        {IN_W | IN_E | OUT_N, rotate_180(DISJUNCTION)},
+        {IN_W | IN_N | OUT_E, rotate_180(DISJUNCTION)},
+        {IN_E | IN_N | OUT_W, rotate_180(DISJUNCTION)},
+
+        {IN_S | IN_E | OUT_N, rotate_270(DISJUNCTION)},
+        {IN_S | IN_N | OUT_E, rotate_270(DISJUNCTION)},
+        {IN_E | IN_N | OUT_S, rotate_270(DISJUNCTION)},
+    });
     /**
      * Lookup table for fan-out rotations. Maps ports to corresponding fan-out gates.
      */
-    static inline const port_gate_map FANOUT_MAP = {
-        {{{port_position(4, 2)}, {port_position(0, 2), port_position(2, 4)}}, FAN_OUT_1_2},
-        {{{port_position(2, 4)}, {port_position(0, 2), port_position(4, 2)}}, FAN_OUT_1_2},
-        {{{port_position(0, 2)}, {port_position(2, 4), port_position(4, 2)}}, FAN_OUT_1_2},
-
-        {{{port_position(2, 0)}, {port_position(0, 2), port_position(2, 4)}}, rotate_90(FAN_OUT_1_2)},
-        {{{port_position(2, 4)}, {port_position(0, 2), port_position(2, 0)}}, rotate_90(FAN_OUT_1_2)},
-        {{{port_position(0, 2)}, {port_position(2, 4), port_position(2, 0)}}, rotate_90(FAN_OUT_1_2)},
-
-        {{{port_position(2, 0)}, {port_position(0, 2), port_position(4, 2)}}, rotate_180(FAN_OUT_1_2)},
-        {{{port_position(4, 2)}, {port_position(0, 2), port_position(2, 0)}}, rotate_180(FAN_OUT_1_2)},
-        {{{port_position(0, 2)}, {port_position(4, 2), port_position(2, 0)}}, rotate_180(FAN_OUT_1_2)},
-
-        {{{port_position(2, 0)}, {port_position(2, 4), port_position(4, 2)}}, rotate_270(FAN_OUT_1_2)},
-        {{{port_position(4, 2)}, {port_position(2, 4), port_position(2, 0)}}, rotate_270(FAN_OUT_1_2)},
-        {{{port_position(2, 4)}, {port_position(4, 2), port_position(2, 0)}}, rotate_270(FAN_OUT_1_2)}};
+    static constexpr const auto FANOUT_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
+        {IN_E | OUT_W | OUT_S, FAN_OUT_1_2},
+        {IN_S | OUT_W | OUT_E, FAN_OUT_1_2},
+        {IN_W | OUT_S | OUT_E, FAN_OUT_1_2},
+
+        {IN_N | OUT_W | OUT_S, rotate_90(FAN_OUT_1_2)},
+        {IN_S | OUT_W | OUT_N, rotate_90(FAN_OUT_1_2)},
+        {IN_W | OUT_S | OUT_N, rotate_90(FAN_OUT_1_2)},
+
+        {IN_N | OUT_W | OUT_E, rotate_180(FAN_OUT_1_2)},
+        {IN_E | OUT_W | OUT_N, rotate_180(FAN_OUT_1_2)},
+        {IN_W | OUT_E | OUT_N, rotate_180(FAN_OUT_1_2)},
+
+        {IN_N | OUT_S | OUT_E, rotate_270(FAN_OUT_1_2)},
+        {IN_E | OUT_S | OUT_N, rotate_270(FAN_OUT_1_2)},
+        {IN_S | OUT_E | OUT_N, rotate_270(FAN_OUT_1_2)},
+    });
 };
 
 }  // namespace fiction
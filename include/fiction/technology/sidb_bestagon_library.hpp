@@ -14,8 +14,8 @@
 #include "fiction/utils/truth_table_utils.hpp"
 
 #include <fmt/format.h>
-#include <phmap.h>
 
+#include <cstddef>
 #include <vector>
 
 namespace fiction
@@ -56,95 +56,94 @@ class sidb_bestagon_library : public fcn_gate_library<sidb_technology, 60, 46>
         static_assert(has_pointy_top_hex_orientation_v<GateLyt>, "Lyt must be a pointy-top hexagonal layout");
 
         const auto n = lyt.get_node(t);
-        const auto p = determine_port_routing(lyt, t);
+        const auto p = determine_port_mask(lyt, t);
 
-        try
+        if constexpr (fiction::has_is_fanout_v<GateLyt>)
         {
-            if constexpr (fiction::has_is_fanout_v<GateLyt>)
+            if (lyt.is_fanout(n))
             {
-                if (lyt.is_fanout(n))
+                if (lyt.fanout_size(n) == 2)
                 {
-                    if (lyt.fanout_size(n) == 2)
-                    {
-                        return FANOUT_MAP.at(p);
-                    }
+                    return look_up(FANOUT_TABLE, p, t);
                 }
             }
-            if constexpr (fiction::has_is_buf_v<GateLyt>)
+        }
+        if constexpr (fiction::has_is_buf_v<GateLyt>)
+        {
+            if (lyt.is_buf(n))
             {
-                if (lyt.is_buf(n))
+                if (lyt.is_ground_layer(t))
                 {
-                    if (lyt.is_ground_layer(t))
+                    // crossing case
+                    if (const auto at = lyt.above(t); (t != at) && lyt.is_wire_tile(at))
                     {
-                        // crossing case
-                        if (const auto at = lyt.above(t); (t != at) && lyt.is_wire_tile(at))
-                        {
-                            // two possible options: actual crossover and (parallel) hourglass wire
-                            const auto pa = determine_port_routing(lyt, at);
+                        // two possible options: actual crossover and (parallel) hourglass wire
+                        const auto pa = determine_port_mask(lyt, at);
 
-                            return CROSSING_MAP.at({p, pa});
+                        if (const auto* const g = CROSSING_TABLE.find(port_encoding::concatenate(p, pa));
+                            g != nullptr)
+                        {
+                            return *g;
                         }
-                        // regular wire: look-up in the wire_map
 
-                        return WIRE_MAP.at(p);
+                        throw unsupported_gate_orientation_exception(t, PORT_ENCODING.decode(p));
                     }
+                    // regular wire: look-up in the wire table
 
-                    return EMPTY_GATE;
+                    return look_up(WIRE_TABLE, p, t);
                 }
+
+                return EMPTY_GATE;
             }
-            if constexpr (fiction::has_is_inv_v<GateLyt>)
+        }
+        if constexpr (fiction::has_is_inv_v<GateLyt>)
+        {
+            if (lyt.is_inv(n))
             {
-                if (lyt.is_inv(n))
-                {
-                    return INVERTER_MAP.at(p);
-                }
+                return look_up(INVERTER_TABLE, p, t);
             }
-            if constexpr (mockturtle::has_is_and_v<GateLyt>)
+        }
+        if constexpr (mockturtle::has_is_and_v<GateLyt>)
+        {
+            if (lyt.is_and(n))
             {
-                if (lyt.is_and(n))
-                {
-                    return CONJUNCTION_MAP.at(p);
-                }
+                return look_up(CONJUNCTION_TABLE, p, t);
             }
-            if constexpr (mockturtle::has_is_or_v<GateLyt>)
+        }
+        if constexpr (mockturtle::has_is_or_v<GateLyt>)
+        {
+            if (lyt.is_or(n))
             {
-                if (lyt.is_or(n))
-                {
-                    return DISJUNCTION_MAP.at(p);
-                }
+                return look_up(DISJUNCTION_TABLE, p, t);
             }
-            if constexpr (fiction::has_is_nand_v<GateLyt>)
+        }
+        if constexpr (fiction::has_is_nand_v<GateLyt>)
+        {
+            if (lyt.is_nand(n))
             {
-                if (lyt.is_nand(n))
-                {
-                    return NEGATED_CONJUNCTION_MAP.at(p);
-                }
+                return look_up(NEGATED_CONJUNCTION_TABLE, p, t);
             }
-            if constexpr (fiction::has_is_nor_v<GateLyt>)
+        }
+        if constexpr (fiction::has_is_nor_v<GateLyt>)
+        {
+            if (lyt.is_nor(n))
             {
-                if (lyt.is_nor(n))
-                {
-                    return NEGATED_DISJUNCTION_MAP.at(p);
-                }
+                return look_up(NEGATED_DISJUNCTION_TABLE, p, t);
             }
-            if constexpr (mockturtle::has_is_xor_v<GateLyt>)
-            {
-                if (lyt.is_xor(n))
-                {
-                    return EXCLUSIVE_DISJUNCTION_MAP.at(p);
-                }
-            }
-            if constexpr (fiction::has_is_xnor_v<GateLyt>)
+        }
+        if constexpr (mockturtle::has_is_xor_v<GateLyt>)
+        {
+            if (lyt.is_xor(n))
             {
-                if (lyt.is_xnor(n))
-                {
-                    return NEGATED_EXCLUSIVE_DISJUNCTION_MAP.at(p);
-                }
+                return look_up(EXCLUSIVE_DISJUNCTION_TABLE, p, t);
             }
         }
-        catch (const std::out_of_range&)
+        if constexpr (fiction::has_is_xnor_v<GateLyt>)
         {
-            throw unsupported_gate_orientation_exception(t, p);
+            if (lyt.is_xnor(n))
+            {
+                return look_up(NEGATED_EXCLUSIVE_DISJUNCTION_TABLE, p, t);
+            }
         }
 
         throw unsupported_gate_type_exception(t);
@@ -295,29 +294,38 @@ class sidb_bestagon_library : public fcn_gate_library<sidb_technology, 60, 46>
     }
 
   private:
+    /**
+     * Determines the ports of the given tile as a compact port mask over the NW and NE input as well as the SE and SW
+     * output slots of `port_encoding`. Tiles without incoming or outgoing signals are assigned default ports.
+     *
+     * @tparam Lyt Pointy-top hexagonal gate-level layout type.
+     * @param lyt Layout that hosts tile `t`.
+     * @param t Tile whose ports are to be determined.
+     * @return Port mask of `t`.
+     */
     template <typename Lyt>
-    [[nodiscard]] static port_list<port_direction> determine_port_routing(const Lyt& lyt, const tile<Lyt>& t) noexcept
+    [[nodiscard]] static port_mask determine_port_mask(const Lyt& lyt, const tile<Lyt>& t) noexcept
     {
-        port_list<port_direction> p{};
+        port_mask p{0};
 
         // determine incoming connector ports
         if (lyt.has_north_eastern_incoming_signal(t))
         {
-            p.inp.emplace(port_direction::cardinal::NORTH_EAST);
+            p |= IN_NE;
         }
         if (lyt.has_north_western_incoming_signal(t))
         {
-            p.inp.emplace(port_direction::cardinal::NORTH_WEST);
+            p |= IN_NW;
         }
 
         // determine outgoing connector ports
         if (lyt.has_south_eastern_outgoing_signal(t))
         {
-            p.out.emplace(port_direction::cardinal::SOUTH_EAST);
+            p |= OUT_SE;
         }
         if (lyt.has_south_western_outgoing_signal(t))
         {
-            p.out.emplace(port_direction::cardinal::SOUTH_WEST);
+            p |= OUT_SW;
         }
 
         // gates without connector ports
@@ -327,28 +335,48 @@ class sidb_bestagon_library : public fcn_gate_library<sidb_technology, 60, 46>
         {
             if (lyt.has_no_incoming_signal(t))
             {
-                p.inp.emplace(port_direction::cardinal::NORTH_WEST);
+                p |= IN_NW;
             }
             if (lyt.has_no_outgoing_signal(t))
             {
-                p.out.emplace(port_direction::cardinal::SOUTH_EAST);
+                p |= OUT_SE;
             }
         }
         else  // 2-input functions
         {
             if (lyt.has_no_incoming_signal(t))
             {
-                p.inp.emplace(port_direction::cardinal::NORTH_WEST);
-                p.inp.emplace(port_direction::cardinal::NORTH_EAST);
+                p |= IN_NW | IN_NE;
             }
             if (lyt.has_no_outgoing_signal(t))
             {
-                p.out.emplace(port_direction::cardinal::SOUTH_EAST);
+                p |= OUT_SE;
             }
         }
 
         return p;
     }
+    /**
+     * Looks up the gate that realizes the given port mask in the given table.
+     *
+     * @tparam Table `port_gate_table` type.
+     * @tparam CoordinateType Type of the tile coordinates.
+     * @param table Table to search.
+     * @param p Port mask to look up.
+     * @param t Tile that is to be realized.
+     * @return Gate that is stored for `p` in `table`.
+     * @throws unsupported_gate_orientation_exception If `table` does not contain a gate for `p`.
+     */
+    template <typename Table, typename CoordinateType>
+    [[nodiscard]] static fcn_gate look_up(const Table& table, const port_mask p, const CoordinateType& t)
+    {
+        if (const auto* const g = table.find(p); g != nullptr)
+        {
+            return *g;
+        }
+
+        throw unsupported_gate_orientation_exception(t, PORT_ENCODING.decode(p));
+    }
 
     // clang-format off
 
@@ -1530,155 +1558,122 @@ class sidb_bestagon_library : public fcn_gate_library<sidb_technology, 60, 46>
 
     // clang-format on
 
-    using port_gate_map = phmap::flat_hash_map<port_list<port_direction>, fcn_gate>;
-    using double_port_gate_map =
-        phmap::flat_hash_map<std::pair<port_list<port_direction>, port_list<port_direction>>, fcn_gate>;
+    /**
+     * Port mask encoding over the NW and NE input as well as the SE and SW output ports.
+     */
+    using port_encoding = port_mask_encoding<port_direction, 2, 2>;
+    /**
+     * Assignment of the library's connector ports to port mask bits.
+     */
+    static constexpr const port_encoding PORT_ENCODING{
+        {{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)}},
+        {{port_direction(port_direction::cardinal::SOUTH_EAST), port_direction(port_direction::cardinal::SOUTH_WEST)}}};
+    /**
+     * Port mask bits of the individual connector ports.
+     */
+    static constexpr const port_mask IN_NW  = port_encoding::input(0);
+    static constexpr const port_mask IN_NE  = port_encoding::input(1);
+    static constexpr const port_mask OUT_SE = port_encoding::output(0);
+    static constexpr const port_mask OUT_SW = port_encoding::output(1);
+    /**
+     * Number of bits of the port masks that are used as keys.
+     */
+    static constexpr const std::size_t KEY_BITS = port_encoding::num_bits;
     /**
      * Lookup table for wire mirroring. Maps ports to corresponding wires.
      */
-    static inline const port_gate_map WIRE_MAP = {
+    static constexpr const auto WIRE_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
         // primary inputs
-        {{{}, {port_direction(port_direction::cardinal::SOUTH_WEST)}}, STRAIGHT_WIRE},
-        {{{}, {port_direction(port_direction::cardinal::SOUTH_EAST)}}, DIAGONAL_WIRE},
+        {OUT_SW, STRAIGHT_WIRE},
+        {OUT_SE, DIAGONAL_WIRE},
         // primary outputs
-        {{{port_direction(port_direction::cardinal::NORTH_WEST)}, {}}, DIAGONAL_WIRE},
-        {{{port_direction(port_direction::cardinal::NORTH_EAST)}, {}}, MIRRORED_STRAIGHT_WIRE},
+        {IN_NW, DIAGONAL_WIRE},
+        {IN_NE, MIRRORED_STRAIGHT_WIRE},
         // straight wire
-        {{{port_direction(port_direction::cardinal::NORTH_WEST)},
-          {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         STRAIGHT_WIRE},
-        {{{port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-         MIRRORED_STRAIGHT_WIRE},
+        {IN_NW | OUT_SW, STRAIGHT_WIRE},
+        {IN_NE | OUT_SE, MIRRORED_STRAIGHT_WIRE},
         // diagonal wire
-        {{{port_direction(port_direction::cardinal::NORTH_WEST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-         DIAGONAL_WIRE},
-        {{{port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         MIRRORED_DIAGONAL_WIRE},
+        {IN_NW | OUT_SE, DIAGONAL_WIRE},
+        {IN_NE | OUT_SW, MIRRORED_DIAGONAL_WIRE},
         // empty gate (for crossing layer)
-        {{{}, {}}, EMPTY_GATE},
-    };
+        {0, EMPTY_GATE},
+    });
     /**
-     * Lookup table for wire crossings and hourglass wires. Maps ports to corresponding crossovers.
+     * Lookup table for wire crossings and hourglass wires. Maps ports of the ground and the crossing layer tile to
+     * corresponding crossovers.
      */
-    static inline const double_port_gate_map CROSSING_MAP = {
-        {{{{port_direction(port_direction::cardinal::NORTH_WEST)},
-           {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-          {{port_direction(port_direction::cardinal::NORTH_EAST)},
-           {port_direction(port_direction::cardinal::SOUTH_EAST)}}},
-         HOURGLASS_DOUBLE_WIRE},
-        {{{{port_direction(port_direction::cardinal::NORTH_EAST)},
-           {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-          {{port_direction(port_direction::cardinal::NORTH_WEST)},
-           {port_direction(port_direction::cardinal::SOUTH_WEST)}}},
-         HOURGLASS_DOUBLE_WIRE},
-        {{{{port_direction(port_direction::cardinal::NORTH_WEST)},
-           {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-          {{port_direction(port_direction::cardinal::NORTH_EAST)},
-           {port_direction(port_direction::cardinal::SOUTH_WEST)}}},
-         CROSSING_WIRE},
-        {{{{port_direction(port_direction::cardinal::NORTH_EAST)},
-           {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-          {{port_direction(port_direction::cardinal::NORTH_WEST)},
-           {port_direction(port_direction::cardinal::SOUTH_EAST)}}},
-         CROSSING_WIRE},
-    };
+    static constexpr const auto CROSSING_TABLE = make_port_gate_table<2 * KEY_BITS, fcn_gate>({
+        {port_encoding::concatenate(IN_NW | OUT_SW, IN_NE | OUT_SE), HOURGLASS_DOUBLE_WIRE},
+        {port_encoding::concatenate(IN_NE | OUT_SE, IN_NW | OUT_SW), HOURGLASS_DOUBLE_WIRE},
+        {port_encoding::concatenate(IN_NW | OUT_SE, IN_NE | OUT_SW), CROSSING_WIRE},
+        {port_encoding::concatenate(IN_NE | OUT_SW, IN_NW | OUT_SE), CROSSING_WIRE},
+    });
     /**
      * Lookup table for inverter mirroring. Maps ports to corresponding inverters.
      */
-    static inline const port_gate_map INVERTER_MAP = {
+    static constexpr const auto INVERTER_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
         // straight inverters
-        {{{port_direction(port_direction::cardinal::NORTH_WEST)},
-          {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         STRAIGHT_INVERTER},
-        {{{port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-         MIRRORED_STRAIGHT_INVERTER},
+        {IN_NW | OUT_SW, STRAIGHT_INVERTER},
+        {IN_NE | OUT_SE, MIRRORED_STRAIGHT_INVERTER},
         // diagonal inverters
-        {{{port_direction(port_direction::cardinal::NORTH_WEST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-         DIAGONAL_INVERTER},
-        {{{port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         MIRRORED_DIAGONAL_INVERTER},
+        {IN_NW | OUT_SE, DIAGONAL_INVERTER},
+        {IN_NE | OUT_SW, MIRRORED_DIAGONAL_INVERTER},
         // without inputs
-        {{{}, {port_direction(port_direction::cardinal::SOUTH_WEST)}}, STRAIGHT_INVERTER},
-        {{{}, {port_direction(port_direction::cardinal::SOUTH_EAST)}}, DIAGONAL_INVERTER},
+        {OUT_SW, STRAIGHT_INVERTER},
+        {OUT_SE, DIAGONAL_INVERTER},
         // without outputs
-        {{{port_direction(port_direction::cardinal::NORTH_WEST)}, {}}, DIAGONAL_INVERTER},
-        {{{port_direction(port_direction::cardinal::NORTH_EAST)}, {}}, MIRRORED_STRAIGHT_INVERTER}};
+        {IN_NW, DIAGONAL_INVERTER},
+        {IN_NE, MIRRORED_STRAIGHT_INVERTER},
+    });
     /**
      * Lookup table for conjunction mirroring. Maps ports to corresponding AND gates.
      */
-    static inline const port_gate_map CONJUNCTION_MAP = {
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-         CONJUNCTION},
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         MIRRORED_CONJUNCTION}};
+    static constexpr const auto CONJUNCTION_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
+        {IN_NW | IN_NE | OUT_SE, CONJUNCTION},
+        {IN_NW | IN_NE | OUT_SW, MIRRORED_CONJUNCTION},
+    });
     /**
      * Lookup table for disjunction mirroring. Maps ports to corresponding OR gates.
      */
-    static inline const port_gate_map DISJUNCTION_MAP = {
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-         DISJUNCTION},
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         MIRRORED_DISJUNCTION}};
+    static constexpr const auto DISJUNCTION_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
+        {IN_NW | IN_NE | OUT_SE, DISJUNCTION},
+        {IN_NW | IN_NE | OUT_SW, MIRRORED_DISJUNCTION},
+    });
     /**
      * Lookup table for negated conjunction mirroring. Maps ports to corresponding NAND gates.
      */
-    static inline const port_gate_map NEGATED_CONJUNCTION_MAP = {
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-         NEGATED_CONJUNCTION},
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         MIRRORED_NEGATED_CONJUNCTION}};
+    static constexpr const auto NEGATED_CONJUNCTION_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
+        {IN_NW | IN_NE | OUT_SE, NEGATED_CONJUNCTION},
+        {IN_NW | IN_NE | OUT_SW, MIRRORED_NEGATED_CONJUNCTION},
+    });
     /**
      * Lookup table for negated disjunction mirroring. Maps ports to corresponding NOR gates.
      */
-    static inline const port_gate_map NEGATED_DISJUNCTION_MAP = {
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-         NEGATED_DISJUNCTION},
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         MIRRORED_NEGATED_DISJUNCTION}};
+    static constexpr const auto NEGATED_DISJUNCTION_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
+        {IN_NW | IN_NE | OUT_SE, NEGATED_DISJUNCTION},
+        {IN_NW | IN_NE | OUT_SW, MIRRORED_NEGATED_DISJUNCTION},
+    });
     /**
      * Lookup table for exclusive disjunction mirroring. Maps ports to corresponding XOR gates.
      */
-    static inline const port_gate_map EXCLUSIVE_DISJUNCTION_MAP = {
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-         EXCLUSIVE_DISJUNCTION},
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         MIRRORED_EXCLUSIVE_DISJUNCTION}};
+    static constexpr const auto EXCLUSIVE_DISJUNCTION_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
+        {IN_NW | IN_NE | OUT_SE, EXCLUSIVE_DISJUNCTION},
+        {IN_NW | IN_NE | OUT_SW, MIRRORED_EXCLUSIVE_DISJUNCTION},
+    });
     /**
      * Lookup table for negated exclusive disjunction mirroring. Maps ports to corresponding XNOR gates.
      */
-    static inline const port_gate_map NEGATED_EXCLUSIVE_DISJUNCTION_MAP = {
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST)}},
-         NEGATED_EXCLUSIVE_DISJUNCTION},
-        {{{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         MIRRORED_NEGATED_EXCLUSIVE_DISJUNCTION}};
+    static constexpr const auto NEGATED_EXCLUSIVE_DISJUNCTION_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
+        {IN_NW | IN_NE | OUT_SE, NEGATED_EXCLUSIVE_DISJUNCTION},
+        {IN_NW | IN_NE | OUT_SW, MIRRORED_NEGATED_EXCLUSIVE_DISJUNCTION},
+    });
     /**
      * Lookup table for fanout mirroring. Maps ports to corresponding fan-out gates.
      */
-    static inline const port_gate_map FANOUT_MAP = {
-        {{{port_direction(port_direction::cardinal::NORTH_WEST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST), port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         FANOUT_1_2},
-        {{{port_direction(port_direction::cardinal::NORTH_EAST)},
-          {port_direction(port_direction::cardinal::SOUTH_EAST), port_direction(port_direction::cardinal::SOUTH_WEST)}},
-         MIRRORED_FANOUT_1_2}};
+    static constexpr const auto FANOUT_TABLE = make_port_gate_table<KEY_BITS, fcn_gate>({
+        {IN_NW | OUT_SE | OUT_SW, FANOUT_1_2},
+        {IN_NE | OUT_SE | OUT_SW, MIRRORED_FANOUT_1_2},
+    });
 };
 
 }  // namespace fiction
@@ -755,6 +755,21 @@ template <class Lyt>
 inline constexpr bool is_gate_level_layout_v = is_gate_level_layout<Lyt>::value;
 #pragma endregion
 
+#pragma region is_gate_level_layout_builder
+template <class Builder, class = void>
+struct is_gate_level_layout_builder : std::false_type
+{};
+
+template <class Builder>
+struct is_gate_level_layout_builder<Builder, std::void_t<typename Builder::tile, typename Builder::signal,
+                                                        decltype(std::declval<Builder>().num_pending()),
+                                                        decltype(std::declval<Builder>().finalize())>> : std::true_type
+{};
+
+template <class Builder>
+inline constexpr bool is_gate_level_layout_builder_v = is_gate_level_layout_builder<Builder>::value;
+#pragma endregion
+
 #pragma region has_is_gate_tile
 template <class Lyt, class = void>
 struct has_is_gate_tile : std::false_type
@@ -83,6 +83,15 @@ using cart_gate_clk_lyt = gate_level_layout<
     synchronization_element_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>>;
 using cart_gate_clk_lyt_ptr = std::shared_ptr<cart_gate_clk_lyt>;
 
+/**
+ * Same as `cart_gate_clk_lyt`, but the assignment of nodes to tiles is stored in dense arrays. Suited for large layouts
+ * whose size is known up front, e.g., those generated by `orthogonal`.
+ */
+using dense_cart_gate_clk_lyt = gate_level_layout<
+    synchronization_element_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>,
+    dense_tile_storage>;
+using dense_cart_gate_clk_lyt_ptr = std::shared_ptr<dense_cart_gate_clk_lyt>;
+
 using cart_odd_row_gate_clk_lyt =
     gate_level_layout<clocked_layout<tile_based_layout<shifted_cartesian_layout<offset::ucoord_t, odd_row_cartesian>>>>;
 using cart_odd_row_gate_clk_lyt_ptr = std::shared_ptr<cart_odd_row_gate_clk_lyt>;
@@ -70,7 +70,7 @@ template <typename Lyt, typename Ntk>
 /**
  * Place 0-input gates.
  *
- * @tparam Lyt Gate-level layout type.
+ * @tparam Lyt Gate-level layout type or `gate_level_layout_builder` thereof.
  * @tparam Ntk Logic network type.
  * @param lyt Gate-level layout in which to place a 0-input gate.
  * @param t Tile in `lyt` to place the gate onto.
@@ -82,7 +82,8 @@ template <typename Lyt, typename Ntk>
 [[nodiscard]] mockturtle::signal<Lyt> place(Lyt& lyt, const tile<Lyt>& t, const Ntk& ntk,
                                             const mockturtle::node<Ntk>& n) noexcept
 {
-    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout type");
+    static_assert(is_gate_level_layout_v<Lyt> || is_gate_level_layout_builder_v<Lyt>,
+                  "Lyt is neither a gate-level layout type nor a builder thereof");
     static_assert(mockturtle::is_network_type_v<Ntk>, "Ntk is not a network type");
 
     if constexpr (mockturtle::has_is_pi_v<Ntk>)
@@ -107,7 +108,7 @@ template <typename Lyt, typename Ntk>
 /**
  * Place 1-input gates.
  *
- * @tparam Lyt Gate-level layout type.
+ * @tparam Lyt Gate-level layout type or `gate_level_layout_builder` thereof.
  * @tparam Ntk Logic network type.
  * @param lyt Gate-level layout in which to place a 1-input gate.
  * @param t Tile in `lyt` to place the gate onto.
@@ -120,7 +121,8 @@ template <typename Lyt, typename Ntk>
 [[nodiscard]] mockturtle::signal<Lyt> place(Lyt& lyt, const tile<Lyt>& t, const Ntk& ntk,
                                             const mockturtle::node<Ntk>& n, const mockturtle::signal<Lyt>& a) noexcept
 {
-    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout type");
+    static_assert(is_gate_level_layout_v<Lyt> || is_gate_level_layout_builder_v<Lyt>,
+                  "Lyt is neither a gate-level layout type nor a builder thereof");
     static_assert(mockturtle::is_network_type_v<Ntk>, "Ntk is not a network type");
 
     if constexpr (has_is_inv_v<Ntk>)
@@ -146,7 +148,7 @@ template <typename Lyt, typename Ntk>
 /**
  * Place 2-input gates.
  *
- * @tparam Lyt Gate-level layout type.
+ * @tparam Lyt Gate-level layout type or `gate_level_layout_builder` thereof.
  * @tparam Ntk Logic network type.
  * @param lyt Gate-level layout in which to place a 2-input gate.
  * @param t Tile in `lyt` to place the gate onto.
@@ -163,7 +165,8 @@ template <typename Lyt, typename Ntk>
 place(Lyt& lyt, const tile<Lyt>& t, const Ntk& ntk, const mockturtle::node<Ntk>& n, const mockturtle::signal<Lyt>& a,
       const mockturtle::signal<Lyt>& b, const std::optional<bool>& c = std::nullopt) noexcept
 {
-    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout type");
+    static_assert(is_gate_level_layout_v<Lyt> || is_gate_level_layout_builder_v<Lyt>,
+                  "Lyt is neither a gate-level layout type nor a builder thereof");
     static_assert(mockturtle::is_network_type_v<Ntk>, "Ntk is not a network type");
 
     if constexpr (mockturtle::has_is_and_v<Ntk>)
@@ -235,7 +238,7 @@ place(Lyt& lyt, const tile<Lyt>& t, const Ntk& ntk, const mockturtle::node<Ntk>&
 /**
  * Place 3-input gates.
  *
- * @tparam Lyt Gate-level layout type.
+ * @tparam Lyt Gate-level layout type or `gate_level_layout_builder` thereof.
  * @tparam Ntk Logic network type.
  * @param lyt Gate-level layout in which to place a 3-input gate.
  * @param t Tile in `lyt` to place the gate onto.
@@ -251,7 +254,8 @@ template <typename Lyt, typename Ntk>
                                             const mockturtle::node<Ntk>& n, const mockturtle::signal<Lyt>& a,
                                             const mockturtle::signal<Lyt>& b, const mockturtle::signal<Lyt>& c) noexcept
 {
-    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout type");
+    static_assert(is_gate_level_layout_v<Lyt> || is_gate_level_layout_builder_v<Lyt>,
+                  "Lyt is neither a gate-level layout type nor a builder thereof");
     static_assert(mockturtle::is_network_type_v<Ntk>, "Ntk is not a network type");
 
     if constexpr (mockturtle::has_is_maj_v<Ntk>)
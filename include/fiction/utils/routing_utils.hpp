@@ -8,8 +8,11 @@
 #include "fiction/traits.hpp"
 
 #include <mockturtle/traits.hpp>
+#include <phmap.h>
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <functional>
 #include <set>
 #include <vector>
@@ -122,6 +125,98 @@ class path_set : public std::set<Path>
     using base::base;
 };
 
+/**
+ * Assigns dense, non-negative indices to the coordinates of a layout, e.g., to address per-coordinate search state in
+ * flat arrays or indexed priority queues instead of hash maps. Offset coordinates are indexed arithmetically in z, y, x
+ * order, which requires them to be within the layout bounds. All other coordinate types are indexed in the order of
+ * their first look-up.
+ *
+ * @tparam Lyt Coordinate layout type.
+ */
+template <typename Lyt>
+class dense_coordinate_index
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param lyt Layout whose coordinates are to be indexed.
+     */
+    explicit dense_coordinate_index(const Lyt& lyt) noexcept : layout{lyt} {}
+    /**
+     * Returns the index of the given coordinate.
+     *
+     * @param c Coordinate whose index is desired.
+     * @return Dense index of `c`.
+     */
+    [[nodiscard]] std::size_t operator()(const coordinate<Lyt>& c)
+    {
+        if constexpr (has_offset_ucoord_v<Lyt>)
+        {
+            return at(c);
+        }
+        else
+        {
+            return indices.try_emplace(c, indices.size()).first->second;
+        }
+    }
+    /**
+     * Returns the index of the given coordinate without modifying this object. Hence, it can be called concurrently. In
+     * contrast to the call operator, non-offset coordinates must have been indexed before.
+     *
+     * @param c Coordinate whose index is desired.
+     * @return Dense index of `c`.
+     */
+    [[nodiscard]] std::size_t at(const coordinate<Lyt>& c) const noexcept
+    {
+        if constexpr (has_offset_ucoord_v<Lyt>)
+        {
+            assert(layout.is_within_bounds(c) && "offset coordinates have to be within the layout bounds");
+
+            return (static_cast<std::size_t>(c.z) * (static_cast<std::size_t>(layout.y()) + 1) +
+                    static_cast<std::size_t>(c.y)) *
+                       (static_cast<std::size_t>(layout.x()) + 1) +
+                   static_cast<std::size_t>(c.x);
+        }
+        else
+        {
+            const auto it = indices.find(c);
+
+            assert(it != indices.cend() && "the coordinate has not been indexed");
+
+            return it->second;
+        }
+    }
+
+    /**
+     * Returns an upper bound on all indices, i.e., the number of coordinates within the layout bounds for offset
+     * coordinates and the number of coordinates that have been indexed so far for all other coordinate types.
+     *
+     * @return All indices returned by this object are smaller than this number.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        if constexpr (has_offset_ucoord_v<Lyt>)
+        {
+            return (static_cast<std::size_t>(layout.x()) + 1) * (static_cast<std::size_t>(layout.y()) + 1) *
+                   (static_cast<std::size_t>(layout.z()) + 1);
+        }
+        else
+        {
+            return indices.size();
+        }
+    }
+
+  private:
+    /**
+     * The indexed layout.
+     */
+    const Lyt& layout;
+    /**
+     * Indices of non-offset coordinates in the order of their first look-up.
+     */
+    phmap::flat_hash_map<coordinate<Lyt>, std::size_t> indices{};
+};
 /**
  * Checks whether a given coordinate `successor` hosts a crossable wire when coming from coordinate `src` in a given
  * layout. A wire is said to be crossable if a potential cross-over would not result in running along the same
@@ -5,10 +5,15 @@
 #ifndef FICTION_STL_UTILS_HPP
 #define FICTION_STL_UTILS_HPP
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <queue>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -155,6 +160,276 @@ class searchable_priority_queue : public std::priority_queue<T, Container, Compa
     }
 };
 
+/**
+ * An addressable priority queue that is implemented as a d-ary heap. Each element is associated with a caller-provided
+ * key from a dense range of non-negative integers, e.g., coordinate indices. A position map from keys to heap slots
+ * allows for \f$ O(1) \f$ membership tests and \f$ O(\log_d n) \f$ priority decreases (decrease-key), which
+ * `searchable_priority_queue` can only provide via a linear search and without restoring the heap property.
+ *
+ * Unlike `std::priority_queue`, the element whose priority is ranked first by `Compare` is on top, i.e., the default
+ * `std::less` yields a min-heap.
+ *
+ * @tparam T The type of the stored elements.
+ * @tparam Priority The type of the priorities.
+ * @tparam Compare A Compare type providing a strict weak ordering on priorities.
+ * @tparam Arity Number of children per heap node. Higher arities lead to shallower heaps and faster priority decreases
+ * at the cost of more comparisons per removal.
+ */
+template <typename T, typename Priority, typename Compare = std::less<Priority>, std::size_t Arity = 4>
+class indexed_priority_queue
+{
+  public:
+    static_assert(Arity >= 2, "Arity must be at least 2");
+    /**
+     * Standard constructor.
+     *
+     * @param comp Comparator instance.
+     */
+    explicit indexed_priority_queue(const Compare& comp = Compare()) : compare{comp} {}
+    /**
+     * Checks whether the queue is empty.
+     *
+     * @return `true` iff the queue contains no elements.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return heap.empty();
+    }
+    /**
+     * Returns the number of elements in the queue.
+     *
+     * @return Number of stored elements.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return heap.size();
+    }
+    /**
+     * Checks whether an element with the given key is stored in the queue.
+     *
+     * @param key Key to check.
+     * @return `true` iff an element with key `key` is contained in the queue.
+     */
+    [[nodiscard]] bool contains(const std::size_t key) const noexcept
+    {
+        return key < position.size() && position[key] != NONE;
+    }
+    /**
+     * Returns the element with the highest-ranked priority. The queue must not be empty.
+     *
+     * @return Top element.
+     */
+    [[nodiscard]] const T& top() const noexcept
+    {
+        assert(!empty() && "the queue must not be empty");
+
+        return heap.front().value;
+    }
+    /**
+     * Returns the priority of the top element. The queue must not be empty.
+     *
+     * @return Priority of the top element.
+     */
+    [[nodiscard]] const Priority& top_priority() const noexcept
+    {
+        assert(!empty() && "the queue must not be empty");
+
+        return heap.front().priority;
+    }
+    /**
+     * Returns the priority of the element with the given key. The key must be contained in the queue.
+     *
+     * @param key Key of the element whose priority is desired.
+     * @return Priority of the element with key `key`.
+     */
+    [[nodiscard]] const Priority& priority(const std::size_t key) const noexcept
+    {
+        assert(contains(key) && "the key must be contained in the queue");
+
+        return heap[position[key]].priority;
+    }
+    /**
+     * Inserts a new element into the queue. The key must not be contained in the queue yet.
+     *
+     * @param key Key of the new element.
+     * @param value Element to insert.
+     * @param prio Priority of the new element.
+     */
+    void push(const std::size_t key, const T& value, const Priority& prio)
+    {
+        assert(!contains(key) && "the key is already contained in the queue");
+
+        if (key >= position.size())
+        {
+            position.resize(key + 1, NONE);
+        }
+
+        position[key] = heap.size();
+        heap.push_back({value, prio, key});
+
+        sift_up(heap.size() - 1);
+    }
+    /**
+     * Removes the top element from the queue. The queue must not be empty.
+     */
+    void pop() noexcept
+    {
+        assert(!empty() && "the queue must not be empty");
+
+        position[heap.front().key] = NONE;
+
+        if (heap.size() > 1)
+        {
+            heap.front()               = std::move(heap.back());
+            position[heap.front().key] = 0;
+            heap.pop_back();
+
+            sift_down(0);
+        }
+        else
+        {
+            heap.pop_back();
+        }
+    }
+    /**
+     * Improves the priority of the element with the given key. The key must be contained in the queue and the new
+     * priority must not be ranked behind the current one.
+     *
+     * @param key Key of the element whose priority is to be improved.
+     * @param prio New priority.
+     */
+    void decrease_key(const std::size_t key, const Priority& prio) noexcept
+    {
+        assert(contains(key) && "the key must be contained in the queue");
+        assert(!compare(heap[position[key]].priority, prio) &&
+               "the new priority must not be ranked behind the old one");
+
+        heap[position[key]].priority = prio;
+
+        sift_up(position[key]);
+    }
+    /**
+     * Removes all elements from the queue. Allocated memory is retained for reuse.
+     */
+    void clear() noexcept
+    {
+        for (const auto& e : heap)
+        {
+            position[e.key] = NONE;
+        }
+
+        heap.clear();
+    }
+    /**
+     * Reserves memory for the given number of keys and elements.
+     *
+     * @param num_keys Number of distinct keys, i.e., the largest expected key + 1.
+     */
+    void reserve(const std::size_t num_keys)
+    {
+        position.reserve(num_keys);
+        heap.reserve(num_keys);
+    }
+
+  private:
+    /**
+     * A stored element together with its priority and key.
+     */
+    struct entry
+    {
+        T value;
+
+        Priority priority;
+
+        std::size_t key;
+    };
+    /**
+     * Marks keys that are not contained in the queue.
+     */
+    static constexpr const std::size_t NONE = std::numeric_limits<std::size_t>::max();
+    /**
+     * The d-ary heap.
+     */
+    std::vector<entry> heap{};
+    /**
+     * Maps each key to the heap slot of its element or to `NONE`.
+     */
+    std::vector<std::size_t> position{};
+    /**
+     * Priority comparator.
+     */
+    Compare compare;
+    /**
+     * Moves the element at the given heap slot towards the root until the heap property is restored.
+     *
+     * @param i Heap slot.
+     */
+    void sift_up(std::size_t i) noexcept
+    {
+        auto e = std::move(heap[i]);
+
+        while (i > 0)
+        {
+            const auto parent = (i - 1) / Arity;
+
+            if (!compare(e.priority, heap[parent].priority))
+            {
+                break;
+            }
+
+            heap[i]               = std::move(heap[parent]);
+            position[heap[i].key] = i;
+            i                     = parent;
+        }
+
+        heap[i]               = std::move(e);
+        position[heap[i].key] = i;
+    }
+    /**
+     * Moves the element at the given heap slot towards the leaves until the heap property is restored.
+     *
+     * @param i Heap slot.
+     */
+    void sift_down(std::size_t i) noexcept
+    {
+        auto e = std::move(heap[i]);
+
+        while (true)
+        {
+            const auto first_child = i * Arity + 1;
+
+            if (first_child >= heap.size())
+            {
+                break;
+            }
+
+            // determine the child with the highest-ranked priority
+            auto       best_child = first_child;
+            const auto last_child = std::min(first_child + Arity, heap.size());
+
+            for (auto c = first_child + 1; c < last_child; ++c)
+            {
+                if (compare(heap[c].priority, heap[best_child].priority))
+                {
+                    best_child = c;
+                }
+            }
+
+            if (!compare(heap[best_child].priority, e.priority))
+            {
+                break;
+            }
+
+            heap[i]               = std::move(heap[best_child]);
+            position[heap[i].key] = i;
+            i                     = best_child;
+        }
+
+        heap[i]               = std::move(e);
+        position[heap[i].key] = i;
+    }
+};
+
 }  // namespace fiction
 
 #endif  // FICTION_STL_UTILS_HPP
@@ -11,6 +11,7 @@
 #include <fiction/layouts/coordinates.hpp>
 #include <fiction/layouts/gate_level_layout.hpp>
 
+#include <algorithm>
 #include <vector>
 
 using namespace fiction;
@@ -159,6 +160,26 @@ TEST_CASE("EPG on 3x3 layouts", "[generate-edge-intersection-graph]")
                 CHECK(graph.size_edges() == 0);     // paths are NOT mutual exclusive due to crossings
             }
         }
+        SECTION("(0,0) to (2,0) and (1,0) to (1,1)")
+        {
+            // the second path starts in an intermediate coordinate of the first one
+            const auto check = [&layout, &st](const std::vector<routing_objective<gate_lyt>>& objectives)
+            {
+                const auto graph = generate_edge_intersection_graph(layout, objectives, {}, &st);
+
+                CHECK(graph.size_vertices() == 2);
+                CHECK(graph.size_edges() == 1);  // the intersection does not depend on the order of objectives
+            };
+
+            SECTION("through path first")
+            {
+                check({{{0, 0}, {2, 0}}, {{1, 0}, {1, 1}}});
+            }
+            SECTION("branching path first")
+            {
+                check({{{1, 0}, {1, 1}}, {{0, 0}, {2, 0}}});
+            }
+        }
     }
 }
 
@@ -253,3 +274,103 @@ TEST_CASE("EPG on 4x4 layouts with obstruction", "[generate-edge-intersection-gr
         }
     }
 }
+
+TEST_CASE("EPG with path limit and crossings", "[generate-edge-intersection-graph]")
+{
+    using gate_lyt = gate_level_layout<clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+    generate_edge_intersection_graph_stats st{};
+
+    SECTION("Non-disjoint paths with path limit")
+    {
+        const gate_lyt layout{{1, 1}, twoddwave_clocking<gate_lyt>()};
+
+        // (0,0) --> (1,1), (1,0) --> (1,1)
+        const std::vector<routing_objective<gate_lyt>> objectives{{{0, 0}, {1, 1}}, {{1, 0}, {1, 1}}};
+
+        generate_edge_intersection_graph_params ps{};
+        ps.path_limit = 2;
+
+        const auto graph = generate_edge_intersection_graph(layout, objectives, ps, &st);
+
+        CHECK(st.cliques.size() == 2);
+
+        CHECK(graph.size_vertices() == 3);
+        CHECK(graph.size_edges() == 2);  // same as without path limit
+    }
+    SECTION("Crossing paths")
+    {
+        const gate_lyt layout{{2, 2}, twoddwave_clocking<gate_lyt>()};
+
+        // (1,0) --> (1,2), (0,1) --> (2,1), which cross in (1,1)
+        const std::vector<routing_objective<gate_lyt>> objectives{{{1, 0}, {1, 2}}, {{0, 1}, {2, 1}}};
+
+        generate_edge_intersection_graph_params ps{};
+
+        const auto check = [&layout, &objectives, &ps, &st](const std::size_t num_edges)
+        {
+            const auto graph = generate_edge_intersection_graph(layout, objectives, ps, &st);
+
+            CHECK(graph.size_vertices() == 2);
+            CHECK(graph.size_edges() == num_edges);
+        };
+
+        SECTION("Without crossings")
+        {
+            check(1);
+
+            ps.path_limit = 1;
+            check(1);
+        }
+        SECTION("With crossings")
+        {
+            ps.crossings = true;
+            check(0);
+
+            ps.path_limit = 1;
+            check(0);
+        }
+    }
+}
+
+TEST_CASE("EPG with multiple threads", "[generate-edge-intersection-graph]")
+{
+    using gate_lyt = gate_level_layout<clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+
+    const gate_lyt layout{{4, 4}, use_clocking<gate_lyt>()};
+
+    const std::vector<routing_objective<gate_lyt>> objectives{
+        {{0, 0}, {3, 3}}, {{0, 3}, {4, 4}}, {{1, 0}, {4, 2}}, {{0, 1}, {2, 4}}, {{2, 0}, {2, 0}}};
+
+    const auto check = [&layout, &objectives](generate_edge_intersection_graph_params ps)
+    {
+        generate_edge_intersection_graph_stats seq_st{};
+        generate_edge_intersection_graph_stats par_st{};
+
+        const auto seq_graph = generate_edge_intersection_graph(layout, objectives, ps, &seq_st);
+
+        ps.num_threads = 4;
+        const auto par_graph = generate_edge_intersection_graph(layout, objectives, ps, &par_st);
+
+        // the resulting graph does not depend on the number of threads
+        CHECK(par_graph.size_vertices() == seq_graph.size_vertices());
+        CHECK(par_graph.size_edges() == seq_graph.size_edges());
+        CHECK(par_st.cliques == seq_st.cliques);
+        CHECK(par_st.number_of_unroutable_objectives == seq_st.number_of_unroutable_objectives);
+
+        std::for_each(seq_graph.begin_edges(), seq_graph.end_edges(),
+                      [&par_graph](const auto& e) { CHECK(par_graph.find_edge(e.first) != par_graph.end_edges()); });
+    };
+
+    SECTION("All paths")
+    {
+        check({});
+    }
+    SECTION("With path limit")
+    {
+        generate_edge_intersection_graph_params ps{};
+        ps.path_limit = 3;
+        ps.crossings  = true;
+
+        check(ps);
+    }
+}
@@ -485,3 +485,252 @@ TEST_CASE("A* path finding with the A* distance functor (don't do this!)", "[A*]
         }
     }
 }
+
+TEST_CASE("A* with inlined distance and cost functions", "[A*]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using coord_path = layout_coordinate_path<clk_lyt>;
+
+    SECTION("Function objects")
+    {
+        const clk_lyt layout{{9, 9}, res_clocking<clk_lyt>()};
+
+        const auto check = [&layout](const auto& dist_fn)
+        {
+            const auto path = a_star<coord_path>(layout, {{0, 0}, {9, 9}}, dist_fn, unit_cost_fn<uint32_t>{});
+
+            CHECK(path.size() == 19);
+            CHECK(path.source() == coordinate<clk_lyt>{0, 0});
+            CHECK(path.target() == coordinate<clk_lyt>{9, 9});
+        };
+
+        check(manhattan_distance_fn<>{});
+        check(euclidean_distance_fn<>{});
+        check(manhattan_distance_functor<clk_lyt>{});
+    }
+    SECTION("Lambdas")
+    {
+        const clk_lyt layout{{3, 3}, use_clocking<clk_lyt>()};
+
+        uint64_t num_cost_calls = 0;
+
+        const auto path = a_star<coord_path>(
+            layout, {{0, 0}, {3, 3}}, [](const auto&, const auto&, const auto&) { return 0.0; },
+            [&num_cost_calls](const auto&, const auto&)
+            {
+                ++num_cost_calls;
+                return 2.0;
+            });
+
+        CHECK(path.size() == 7);
+        CHECK(num_cost_calls > 0);
+    }
+    SECTION("2DDWave distance")
+    {
+        const clk_lyt layout{{9, 9}, twoddwave_clocking<clk_lyt>()};
+
+        SECTION("(0,0) to (9,9)")  // path of length 19
+        {
+            const auto path = a_star<coord_path>(layout, {{0, 0}, {9, 9}}, twoddwave_distance_fn<>{});
+
+            CHECK(path.size() == 19);
+            CHECK(path.source() == coordinate<clk_lyt>{0, 0});
+            CHECK(path.target() == coordinate<clk_lyt>{9, 9});
+        }
+        SECTION("(5,5) to (1,1)")  // unreachable target
+        {
+            CHECK(a_star<coord_path>(layout, {{5, 5}, {1, 1}}, twoddwave_distance_fn<>{}).empty());
+        }
+    }
+}
+
+TEST_CASE("Bidirectional and anytime A* on clocked layouts with obstruction", "[A*]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using obst_lyt   = obstruction_layout<clk_lyt>;
+    using coord_path = layout_coordinate_path<obst_lyt>;
+
+    const auto check_all_pairs = [](const obst_lyt& layout)
+    {
+        layout.foreach_ground_coordinate(
+            [&layout](const auto& source)
+            {
+                layout.foreach_ground_coordinate(
+                    [&layout, &source](const auto& target)
+                    {
+                        const auto forward = a_star<coord_path>(layout, {source, target});
+
+                        a_star_params ps{};
+                        ps.bidirectional = true;
+
+                        const auto bidirectional = a_star<coord_path>(layout, {source, target}, manhattan_distance_fn{},
+                                                                      unit_cost_fn{}, ps);
+
+                        CHECK(bidirectional.size() == forward.size());
+
+                        ps.bidirectional    = false;
+                        ps.heuristic_weight = 3.0;
+
+                        const auto weighted = a_star<coord_path>(layout, {source, target}, manhattan_distance_fn{},
+                                                                 unit_cost_fn{}, ps);
+
+                        CHECK(weighted.empty() == forward.empty());
+                        CHECK(weighted.size() >= forward.size());
+                        CHECK(static_cast<double>(weighted.size()) <= 3.0 * static_cast<double>(forward.size()));
+
+                        ps.num_refinements = 2;
+
+                        CHECK(a_star<coord_path>(layout, {source, target}, manhattan_distance_fn{}, unit_cost_fn{}, ps)
+                                  .size() == forward.size());
+
+                        ps.bidirectional = true;
+
+                        const auto anytime = a_star<coord_path>(layout, {source, target}, manhattan_distance_fn{},
+                                                                unit_cost_fn{}, ps);
+
+                        CHECK(anytime.size() == forward.size());
+
+                        if (!anytime.empty())
+                        {
+                            CHECK(anytime.source() == source);
+                            CHECK(anytime.target() == target);
+                        }
+                    });
+            });
+    };
+
+    SECTION("USE")
+    {
+        obst_lyt layout{clk_lyt{{5, 5}, use_clocking<clk_lyt>()}};
+
+        layout.obstruct_coordinate({1, 1});
+        layout.obstruct_coordinate({3, 2});
+        layout.obstruct_coordinate({4, 4});
+        layout.obstruct_connection({0, 0}, {1, 0});
+
+        check_all_pairs(layout);
+    }
+    SECTION("RES")
+    {
+        obst_lyt layout{clk_lyt{{5, 5}, res_clocking<clk_lyt>()}};
+
+        layout.obstruct_coordinate({2, 2});
+        layout.obstruct_coordinate({0, 3});
+        layout.obstruct_connection({4, 1}, {4, 2});
+
+        check_all_pairs(layout);
+    }
+    SECTION("2DDWave")
+    {
+        obst_lyt layout{clk_lyt{{5, 5}, twoddwave_clocking<clk_lyt>()}};
+
+        layout.obstruct_coordinate({1, 2});
+        layout.obstruct_coordinate({3, 3});
+
+        check_all_pairs(layout);
+    }
+}
+
+TEST_CASE("Bidirectional and anytime A* on long routes", "[A*]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using obst_lyt   = obstruction_layout<clk_lyt>;
+    using coord_path = layout_coordinate_path<obst_lyt>;
+
+    obst_lyt layout{clk_lyt{{99, 99}, use_clocking<clk_lyt>()}};
+
+    // walls with alternating gaps force a meandering route
+    for (uint64_t x = 4; x < 99; x += 8)
+    {
+        for (uint64_t y = 0; y <= 99; ++y)
+        {
+            if ((x % 16 == 4) ? y < 90 : y > 9)
+            {
+                layout.obstruct_coordinate({x, y});
+            }
+        }
+    }
+
+    const auto forward = a_star<coord_path>(layout, {{0, 0}, {99, 99}});
+
+    REQUIRE(!forward.empty());
+
+    a_star_params ps{};
+
+    SECTION("Bidirectional")
+    {
+        ps.bidirectional = true;
+
+        const auto path = a_star<coord_path>(layout, {{0, 0}, {99, 99}}, manhattan_distance_fn{}, unit_cost_fn{}, ps);
+
+        CHECK(path.size() == forward.size());
+        CHECK(path.source() == coordinate<obst_lyt>{0, 0});
+        CHECK(path.target() == coordinate<obst_lyt>{99, 99});
+    }
+    SECTION("Weighted")
+    {
+        ps.heuristic_weight = 2.0;
+
+        const auto path = a_star<coord_path>(layout, {{0, 0}, {99, 99}}, manhattan_distance_fn{}, unit_cost_fn{}, ps);
+
+        CHECK(path.size() >= forward.size());
+        CHECK(path.size() - 1 <= 2 * (forward.size() - 1));
+    }
+    SECTION("Anytime")
+    {
+        ps.heuristic_weight = 2.0;
+        ps.num_refinements  = 3;
+
+        CHECK(a_star<coord_path>(layout, {{0, 0}, {99, 99}}, manhattan_distance_fn{}, unit_cost_fn{}, ps).size() ==
+              forward.size());
+
+        ps.bidirectional = true;
+
+        CHECK(a_star<coord_path>(layout, {{0, 0}, {99, 99}}, manhattan_distance_fn{}, unit_cost_fn{}, ps).size() ==
+              forward.size());
+    }
+}
+
+TEST_CASE("Bidirectional A* with crossings", "[A*]")
+{
+    using gate_lyt   = gate_level_layout<clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+    using obst_lyt   = obstruction_layout<gate_lyt>;
+    using coord_path = layout_coordinate_path<obst_lyt>;
+
+    using dist = manhattan_distance_functor<obstruction_layout<gate_lyt>, uint64_t>;
+    using cost = unit_cost_functor<obstruction_layout<gate_lyt>, uint8_t>;
+
+    a_star_params params{};
+    params.crossings     = true;
+    params.bidirectional = true;
+
+    const gate_lyt layout{{3, 3, 1}, twoddwave_clocking<gate_lyt>()};  // create a crossing layer
+
+    obstruction_layout obstr_lyt{layout};
+
+    // create two paths as obstruction
+    const auto pi1 = obstr_lyt.create_pi("obstruction PI 1", {1, 0});  // obstructs 1 coordinate
+    const auto w11 = obstr_lyt.create_buf(pi1, {1, 1});                // obstruction that can be crossed over
+    const auto w12 = obstr_lyt.create_buf(w11, {1, 2});                // obstruction that can be crossed over
+    obstr_lyt.create_po(w12, "obstruction PO", {1, 3});                // obstructs 1 coordinate
+
+    const auto pi2 = obstr_lyt.create_pi("obstruction PI 1", {2, 0});  // obstructs 1 coordinate
+    const auto w21 = obstr_lyt.create_buf(pi2, {2, 1});                // obstruction that can be crossed over
+    const auto w22 = obstr_lyt.create_buf(w21, {2, 2});                // obstruction that can be crossed over
+    obstr_lyt.create_po(w22, "obstruction PO", {2, 3});                // obstructs 1 coordinate
+
+    SECTION("Bidirectional")
+    {
+        const auto path = a_star<coord_path>(obstr_lyt, {{0, 0}, {3, 3}}, dist(), cost(), params);
+
+        CHECK((path == coord_path{{{0, 0}, {0, 1}, {1, 1, 1}, {2, 1, 1}, {3, 1}, {3, 2}, {3, 3}}} ||
+               path == coord_path{{{0, 0}, {0, 1}, {0, 2}, {1, 2, 1}, {2, 2, 1}, {3, 2}, {3, 3}}}));
+    }
+    SECTION("Bidirectional anytime")
+    {
+        params.heuristic_weight = 2.0;
+        params.num_refinements  = 2;
+
+        CHECK(a_star<coord_path>(obstr_lyt, {{0, 0}, {3, 3}}, dist(), cost(), params).size() == 7);
+    }
+}
@@ -0,0 +1,194 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/path_finding/a_star.hpp>
+#include <fiction/algorithms/path_finding/clocked_distance_oracle.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/layouts/obstruction_layout.hpp>
+#include <fiction/utils/routing_utils.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+using namespace fiction;
+
+template <typename Lyt, typename Dist>
+void check_all_pairs(const Lyt& layout, const clocked_distance_oracle<Lyt, Dist>& oracle)
+{
+    layout.foreach_ground_coordinate(
+        [&layout, &oracle](const auto& source)
+        {
+            layout.foreach_ground_coordinate(
+                [&layout, &oracle, &source](const auto& target)
+                { CHECK(oracle.distance(source, target) == a_star_distance<Lyt, Dist>(layout, source, target)); });
+        });
+}
+
+TEST_CASE("Clocked distance oracle on regularly clocked layouts", "[clocked-distance-oracle]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+    const auto check = [](const auto& scheme)
+    {
+        for (const auto& size : {aspect_ratio<clk_lyt>{0, 0}, aspect_ratio<clk_lyt>{2, 1}, aspect_ratio<clk_lyt>{5, 5},
+                                 aspect_ratio<clk_lyt>{9, 6}})
+        {
+            const clk_lyt layout{size, scheme};
+
+            const clocked_distance_oracle<clk_lyt> oracle{layout};
+            CHECK(oracle.is_periodic());
+
+            check_all_pairs(layout, oracle);
+
+            CHECK(oracle.stats().num_tables <= 16);
+            CHECK(oracle.stats().num_table_queries > 0);
+        }
+    };
+
+    SECTION("2DDWave")
+    {
+        check(twoddwave_clocking<clk_lyt>());
+        check(twoddwave_clocking<clk_lyt>(num_clks::THREE));
+    }
+    SECTION("USE")
+    {
+        check(use_clocking<clk_lyt>());
+    }
+    SECTION("RES")
+    {
+        check(res_clocking<clk_lyt>());
+    }
+    SECTION("ESR")
+    {
+        check(esr_clocking<clk_lyt>());
+    }
+    SECTION("ROW")
+    {
+        check(row_clocking<clk_lyt>());
+    }
+    SECTION("COLUMNAR")
+    {
+        check(columnar_clocking<clk_lyt>(num_clks::THREE));
+    }
+}
+
+TEST_CASE("Clocked distance oracle table usage", "[clocked-distance-oracle]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+    SECTION("Monotone scheme")
+    {
+        const clk_lyt layout{{19, 19}, twoddwave_clocking<clk_lyt>()};
+
+        const clocked_distance_oracle<clk_lyt> oracle{layout};
+        check_all_pairs(layout, oracle);
+
+        // all queries are answered by tables
+        CHECK(oracle.stats().num_tables == 16);
+        CHECK(oracle.stats().num_fallback_queries == 0);
+        CHECK(oracle.stats().num_bfs == 0);
+    }
+    SECTION("Interior queries")
+    {
+        const clk_lyt layout{{19, 19}, use_clocking<clk_lyt>()};
+
+        const clocked_distance_oracle<clk_lyt> oracle{layout};
+
+        CHECK(oracle.distance({8, 8}, {11, 11}) == a_star_distance(layout, {8, 8}, {11, 11}));
+        CHECK(oracle.distance({11, 11}, {8, 8}) == a_star_distance(layout, {11, 11}, {8, 8}));
+        CHECK(oracle.distance({9, 8}, {10, 8}) == a_star_distance(layout, {9, 8}, {10, 8}));
+
+        CHECK(oracle.stats().num_table_queries == 3);
+        CHECK(oracle.stats().num_bfs == 0);
+    }
+    SECTION("Copies share their tables")
+    {
+        const clk_lyt layout{{9, 9}, res_clocking<clk_lyt>()};
+
+        const clocked_distance_oracle<clk_lyt> oracle{layout};
+        const auto                             copy = oracle;
+
+        static_cast<void>(oracle.distance({4, 4}, {5, 5}));
+        static_cast<void>(copy.distance({4, 4}, {6, 6}));
+
+        CHECK(oracle.stats().num_tables == 1);
+        CHECK(copy.stats().num_table_queries == 2);
+    }
+}
+
+TEST_CASE("Clocked distance oracle with breadth-first search fallback", "[clocked-distance-oracle]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+    SECTION("Irregular clocking")
+    {
+        clk_lyt layout{{5, 5}, use_clocking<clk_lyt>()};
+        layout.assign_clock_number({2, 2}, 3);
+
+        const clocked_distance_oracle<clk_lyt> oracle{layout};
+        CHECK(!oracle.is_periodic());
+
+        check_all_pairs(layout, oracle);
+
+        CHECK(oracle.stats().num_table_queries == 0);
+        CHECK(oracle.stats().num_bfs == 36);
+    }
+    SECTION("Obstructions")
+    {
+        using obst_lyt = obstruction_layout<clk_lyt>;
+
+        obst_lyt layout{clk_lyt{{5, 5}, twoddwave_clocking<clk_lyt>()}};
+
+        layout.obstruct_coordinate({1, 1});
+        layout.obstruct_coordinate({3, 0});
+        layout.obstruct_connection({0, 2}, {0, 3});
+
+        clocked_distance_oracle<obst_lyt> oracle{layout};
+        CHECK(!oracle.is_periodic());
+
+        check_all_pairs(layout, oracle);
+
+        // obstructed coordinates can be reached but not passed
+        CHECK(oracle.distance({0, 0}, {1, 1}) == 2);
+        CHECK(oracle.distance({0, 0}, {3, 1}) == 4);
+        CHECK(oracle.distance({0, 0}, {4, 0}) == std::numeric_limits<uint64_t>::max());
+
+        // obstruction changes require clearing the cache
+        layout.clear_obstructed_coordinate({3, 0});
+        oracle.clear_cache();
+
+        CHECK(oracle.distance({0, 0}, {4, 0}) == 4);
+    }
+    SECTION("Floating-point distances")
+    {
+        const clk_lyt layout{{3, 3}, twoddwave_clocking<clk_lyt>()};
+
+        const clocked_distance_oracle<clk_lyt, double> oracle{layout};
+
+        CHECK(oracle.distance({0, 0}, {3, 3}) == 6.0);
+        CHECK(std::isinf(oracle.distance({3, 3}, {0, 0})));
+    }
+}
+
+TEST_CASE("A* with a clocked distance oracle as heuristic", "[clocked-distance-oracle]")
+{
+    using clk_lyt    = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using coord_path = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt layout{{9, 9}, esr_clocking<clk_lyt>()};
+
+    const clocked_distance_oracle<clk_lyt> oracle{layout};
+
+    const auto path = a_star<coord_path>(layout, {{0, 0}, {9, 9}}, oracle);
+
+    CHECK(path.size() == oracle.distance({0, 0}, {9, 9}) + 1);
+    CHECK(path.source() == coordinate<clk_lyt>{0, 0});
+    CHECK(path.target() == coordinate<clk_lyt>{9, 9});
+}
@@ -9,6 +9,8 @@
 #include <fiction/layouts/coordinates.hpp>
 
 #include <cmath>
+#include <cstdint>
+#include <type_traits>
 
 using namespace fiction;
 
@@ -98,6 +100,23 @@ TEST_CASE("Unit cost functor", "[cost]")
     }
 }
 
+TEST_CASE("Unit cost function object", "[cost]")
+{
+    using layout = cartesian_layout<cube::coord_t>;
+
+    constexpr unit_cost_fn<> cost{};
+
+    static_assert(std::is_same_v<cost_type<layout, unit_cost_fn<>>, uint8_t>);
+    static_assert(std::is_same_v<cost_type<layout, unit_cost_fn<uint32_t>>, uint32_t>);
+    static_assert(std::is_same_v<cost_type<layout, random_cost_functor<layout>>, double>);
+
+    static_assert(cost(coordinate<layout>{0, 0}, coordinate<layout>{4, 4}) == 1);
+
+    CHECK(cost(coordinate<layout>{0, 0}, coordinate<layout>{0, 0}) == 1);
+    CHECK(cost(coordinate<layout>{-4, -3}, coordinate<layout>{1, -1}) == 1);
+    CHECK(cost(coordinate<layout>{0, 0, 1}, coordinate<layout>{8, 9, 0}) == 1);
+}
+
 TEST_CASE("Random cost", "[distance]")
 {
     SECTION("Unsigned Cartesian layout")
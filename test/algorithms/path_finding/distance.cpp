@@ -13,7 +13,9 @@
 #include <fiction/layouts/coordinates.hpp>
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
 
 using namespace fiction;
 
@@ -111,6 +113,89 @@ TEST_CASE("Manhattan distance functor", "[distance]")
     }
 }
 
+TEST_CASE("2DDWave distance", "[distance]")
+{
+    using cart_lyt = cartesian_layout<offset::ucoord_t>;
+
+    const cart_lyt layout{};
+
+    CHECK(twoddwave_distance<cart_lyt>(layout, {0, 0}, {0, 0}) == 0);
+    CHECK(twoddwave_distance<cart_lyt>(layout, {0, 0}, {0, 1}) == 1);
+    CHECK(twoddwave_distance<cart_lyt>(layout, {0, 0}, {1, 1}) == 2);
+    CHECK(twoddwave_distance<cart_lyt>(layout, {1, 2}, {3, 3}) == 3);
+    CHECK(twoddwave_distance<cart_lyt>(layout, {0, 0}, {4, 4}) == 8);
+
+    // targets that are not located to the south-east are unreachable
+    CHECK(twoddwave_distance<cart_lyt>(layout, {4, 4}, {0, 0}) == std::numeric_limits<uint64_t>::max());
+    CHECK(twoddwave_distance<cart_lyt>(layout, {1, 0}, {0, 1}) == std::numeric_limits<uint64_t>::max());
+    CHECK(twoddwave_distance<cart_lyt>(layout, {0, 1}, {1, 0}) == std::numeric_limits<uint64_t>::max());
+
+    // ignore z-axis
+    CHECK(twoddwave_distance<cart_lyt>(layout, {0, 0, 1}, {8, 9, 0}) == 17);
+
+    const twoddwave_distance_functor<cart_lyt> distance{};
+
+    CHECK(distance(layout, {1, 2}, {3, 3}) == 3);
+    CHECK(distance(layout, {3, 3}, {1, 2}) == std::numeric_limits<uint64_t>::max());
+}
+
+TEST_CASE("Distance function objects", "[distance]")
+{
+    using cart_lyt = cartesian_layout<offset::ucoord_t>;
+    using cube_lyt = cartesian_layout<cube::coord_t>;
+
+    const cart_lyt layout{};
+    const cube_lyt signed_layout{};
+
+    SECTION("Manhattan")
+    {
+        constexpr manhattan_distance_fn<> distance{};
+
+        static_assert(std::is_same_v<distance_type<cart_lyt, manhattan_distance_fn<>>, uint64_t>);
+
+        CHECK(distance(layout, {1, 2}, {3, 3}) == manhattan_distance<cart_lyt>(layout, {1, 2}, {3, 3}));
+        CHECK(distance(layout, {4, 4}, {0, 0}) == 8);
+        CHECK(distance(signed_layout, {-4, -3}, {1, -1}) == 7);
+    }
+    SECTION("Euclidean")
+    {
+        using namespace Catch::Matchers;
+
+        constexpr euclidean_distance_fn<> distance{};
+
+        static_assert(std::is_same_v<distance_type<cart_lyt, euclidean_distance_fn<>>, double>);
+
+        CHECK_THAT(distance(layout, {0, 0}, {1, 1}), WithinAbs(std::sqrt(2), 0.00001));
+        CHECK_THAT(distance(signed_layout, {-2, -8}, {-6, -4}), WithinAbs(std::sqrt(32), 0.00001));
+    }
+    SECTION("2DDWave")
+    {
+        constexpr twoddwave_distance_fn<uint32_t> distance{};
+
+        static_assert(std::is_same_v<distance_type<cart_lyt, twoddwave_distance_fn<uint32_t>>, uint32_t>);
+
+        CHECK(distance(layout, {1, 2}, {3, 3}) == 3);
+        CHECK(distance(layout, {3, 3}, {1, 2}) == std::numeric_limits<uint32_t>::max());
+        CHECK(is_infinite_distance(distance(layout, {3, 3}, {1, 2})));
+    }
+    SECTION("Type-erased functors")
+    {
+        static_assert(std::is_same_v<distance_type<cart_lyt, manhattan_distance_functor<cart_lyt>>, uint64_t>);
+        static_assert(std::is_same_v<distance_type<cart_lyt, euclidean_distance_functor<cart_lyt, float>>, float>);
+    }
+}
+
+TEST_CASE("Infinite distances", "[distance]")
+{
+    CHECK(is_infinite_distance(std::numeric_limits<uint8_t>::max()));
+    CHECK(is_infinite_distance(std::numeric_limits<uint64_t>::max()));
+    CHECK(is_infinite_distance(std::numeric_limits<double>::infinity()));
+
+    CHECK(!is_infinite_distance(uint64_t{0}));
+    CHECK(!is_infinite_distance(std::numeric_limits<double>::max()));
+    CHECK(!is_infinite_distance(42.0));
+}
+
 TEST_CASE("Euclidean distance", "[distance]")
 {
     using namespace Catch::Matchers;
@@ -310,3 +395,25 @@ TEST_CASE("a_star distance functor", "[distance]")
         }
     }
 }
+
+TEST_CASE("A* distance function object", "[distance]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+    const clk_lyt layout{{9, 4, 1}, twoddwave_clocking<clk_lyt>()};
+
+    SECTION("Default heuristic")
+    {
+        const a_star_distance_fn<> distance{};
+
+        CHECK(distance(layout, {0, 0}, {1, 1}) == 2);
+        CHECK(distance(layout, {9, 1}, {6, 2}) == std::numeric_limits<uint64_t>::max());
+    }
+    SECTION("2DDWave heuristic")
+    {
+        const a_star_distance_fn<double, twoddwave_distance_fn<>> distance{};
+
+        CHECK_THAT(distance(layout, {0, 0}, {9, 4}), Catch::Matchers::WithinAbs(13.0, 0.00001));
+        CHECK(std::isinf(distance(layout, {9, 1}, {6, 2})));
+    }
+}
@@ -12,6 +12,10 @@
 #include <fiction/layouts/gate_level_layout.hpp>
 #include <fiction/layouts/obstruction_layout.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
 using namespace fiction;
 
 TEST_CASE("Enumerate all paths on 2x2 clocked layouts", "[enumerate-all-paths]")
@@ -295,3 +299,95 @@ TEST_CASE("Enumerate all paths on 4x4 gate-level layouts with connection obstruc
         }
     }
 }
+
+TEST_CASE("Enumerate all paths with a visitor", "[enumerate-all-paths]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt layout{{3, 3}, twoddwave_clocking<clk_lyt>()};
+
+    SECTION("Visit all paths")
+    {
+        const auto collection = enumerate_all_clocking_paths<path>(layout, {{0, 0}, {3, 3}});
+
+        std::size_t num_paths = 0;
+
+        foreach_clocking_path<path>(layout, {{0, 0}, {3, 3}},
+                                    [&collection, &num_paths](const path& p)
+                                    {
+                                        CHECK(collection.contains(p));
+                                        ++num_paths;
+                                    });
+
+        CHECK(num_paths == 20);
+    }
+    SECTION("Early termination")
+    {
+        std::size_t num_paths = 0;
+
+        foreach_clocking_path<path>(layout, {{0, 0}, {3, 3}},
+                                    [&num_paths](const path&)
+                                    {
+                                        ++num_paths;
+                                        return num_paths < 3;  // stop after the third path
+                                    });
+
+        CHECK(num_paths == 3);
+    }
+}
+
+TEST_CASE("Enumerate all paths with bounds", "[enumerate-all-paths]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    SECTION("Maximum number of paths")
+    {
+        const clk_lyt layout{{3, 3}, twoddwave_clocking<clk_lyt>()};
+
+        enumerate_all_clocking_paths_params ps{};
+
+        ps.max_num_paths = 5;
+        CHECK(enumerate_all_clocking_paths<path>(layout, {{0, 0}, {3, 3}}, ps).size() == 5);
+
+        ps.max_num_paths = 0;
+        CHECK(enumerate_all_clocking_paths<path>(layout, {{0, 0}, {3, 3}}, ps).empty());
+    }
+    SECTION("Maximum path length")
+    {
+        const clk_lyt layout{{3, 3}, use_clocking<clk_lyt>()};
+
+        const auto all_paths = enumerate_all_clocking_paths<path>(layout, {{0, 0}, {3, 3}});
+
+        enumerate_all_clocking_paths_params ps{};
+
+        for (uint64_t l = 1; l <= 16; ++l)
+        {
+            ps.max_path_length = l;
+
+            const auto bounded_paths = enumerate_all_clocking_paths<path>(layout, {{0, 0}, {3, 3}}, ps);
+
+            // exactly the paths that are not longer than l are enumerated
+            CHECK(bounded_paths.size() == static_cast<std::size_t>(std::count_if(
+                                              all_paths.cbegin(), all_paths.cend(),
+                                              [l](const auto& p) { return p.size() <= l; })));
+        }
+    }
+    SECTION("Long-distance objective")
+    {
+        const clk_lyt layout{{2999, 1}, twoddwave_clocking<clk_lyt>()};
+
+        std::size_t num_paths = 0;
+
+        // the paths are consumed without being stored and the search depth is not limited by the call stack
+        foreach_clocking_path<path>(layout, {{0, 0}, {2999, 1}},
+                                    [&num_paths](const path& p)
+                                    {
+                                        CHECK(p.size() == 3001);
+                                        ++num_paths;
+                                    });
+
+        CHECK(num_paths == 3000);
+    }
+}
@@ -289,4 +289,21 @@ TEST_CASE("JPS on 10x10 clocked layouts with varying distance functions", "[JPS]
             }
         }
     }
+    SECTION("2DDWave")
+    {
+        const clk_lyt layout{{9, 9}, twoddwave_clocking<clk_lyt>()};
+
+        SECTION("(0,0) to (9,9) without obstruction")  // path of length 19
+        {
+            const auto path = jump_point_search<coord_path>(layout, {{0, 0}, {9, 9}}, twoddwave_distance_fn<>{});
+
+            CHECK(path.size() == 19);
+            CHECK(path.source() == coordinate<clk_lyt>{0, 0});
+            CHECK(path.target() == coordinate<clk_lyt>{9, 9});
+        }
+        SECTION("(5,5) to (1,1)")  // unreachable target
+        {
+            CHECK(jump_point_search<coord_path>(layout, {{5, 5}, {1, 1}}, twoddwave_distance_fn<>{}).empty());
+        }
+    }
 }
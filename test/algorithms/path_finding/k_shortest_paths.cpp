@@ -4,6 +4,9 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <fiction/algorithms/path_finding/cost.hpp>
+#include <fiction/algorithms/path_finding/distance.hpp>
+#include <fiction/algorithms/path_finding/enumerate_all_paths.hpp>
 #include <fiction/algorithms/path_finding/k_shortest_paths.hpp>
 #include <fiction/layouts/cartesian_layout.hpp>
 #include <fiction/layouts/clocked_layout.hpp>
@@ -12,6 +15,12 @@
 #include <fiction/layouts/gate_level_layout.hpp>
 #include <fiction/layouts/obstruction_layout.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
 using namespace fiction;
 
 TEST_CASE("Yen's algorithm on 2x2 clocked layouts", "[k-shortest-paths]")
@@ -566,3 +575,156 @@ TEST_CASE("Yen's algorithm on 4x4 gate-level layouts with connection obstruction
         }
     }
 }
+
+TEST_CASE("Yen's algorithm with custom distance and cost functions", "[k-shortest-paths]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt layout{{3, 3}, twoddwave_clocking<clk_lyt>()};
+
+    SECTION("2DDWave distance")
+    {
+        const auto collection =
+            yen_k_shortest_paths<path>(layout, {{0, 0}, {3, 3}}, 25, {}, twoddwave_distance_fn<>{});
+
+        CHECK(collection.size() == 20);  // 20 valid paths
+    }
+    SECTION("Type-erased functors")
+    {
+        const auto collection = yen_k_shortest_paths<path>(layout, {{0, 0}, {3, 3}}, 5, {},
+                                                           manhattan_distance_functor<clk_lyt>(),
+                                                           unit_cost_functor<clk_lyt>());
+
+        CHECK(collection.size() == 5);
+    }
+    SECTION("Costs that penalize a coordinate")
+    {
+        const auto cost = [](const auto&, const auto& tgt) { return tgt == coordinate<clk_lyt>{1, 0} ? 10.0 : 1.0; };
+
+        const auto collection =
+            yen_k_shortest_paths<path>(layout, {{0, 0}, {3, 3}}, 20, {}, manhattan_distance_fn<>{}, cost);
+
+        REQUIRE(collection.size() == 20);
+
+        // the 10 paths that avoid the expensive coordinate come first
+        for (auto i = 0u; i < 10; ++i)
+        {
+            CHECK(std::find(collection[i].cbegin(), collection[i].cend(), coordinate<clk_lyt>{1, 0}) ==
+                  collection[i].cend());
+        }
+        for (auto i = 10u; i < 20; ++i)
+        {
+            CHECK(std::find(collection[i].cbegin(), collection[i].cend(), coordinate<clk_lyt>{1, 0}) !=
+                  collection[i].cend());
+        }
+    }
+}
+
+TEST_CASE("Yen's algorithm finds the cheapest paths", "[k-shortest-paths]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    obstruction_layout<clk_lyt> layout{clk_lyt{{5, 5}, use_clocking<clk_lyt>()}};
+
+    layout.obstruct_coordinate({2, 2});
+    layout.obstruct_coordinate({1, 4});
+    layout.obstruct_connection({3, 1}, {3, 2});
+
+    const auto path_lengths = [](const auto& collection)
+    {
+        std::vector<std::size_t> lengths{};
+        std::transform(collection.cbegin(), collection.cend(), std::back_inserter(lengths),
+                       [](const auto& p) { return p.size(); });
+        std::sort(lengths.begin(), lengths.end());
+
+        return lengths;
+    };
+
+    for (const auto& objective : std::vector<routing_objective<obstruction_layout<clk_lyt>>>{
+             {{0, 0}, {5, 5}}, {{0, 0}, {3, 0}}, {{1, 0}, {4, 5}}, {{5, 0}, {0, 5}}})
+    {
+        // reference: the lengths of all paths in ascending order
+        const auto all_lengths = path_lengths(enumerate_all_clocking_paths<path>(layout, objective));
+
+        for (const auto k : {1u, 5u, 15u, 40u})
+        {
+            yen_k_shortest_paths_params ps{};
+
+            const auto sequential = yen_k_shortest_paths<path>(layout, objective, k, ps);
+
+            ps.num_threads        = 4;
+            const auto concurrent = yen_k_shortest_paths<path>(layout, objective, k, ps);
+
+            // there is no cheaper path than the ones found
+            const auto num_paths        = std::min(static_cast<std::size_t>(k), all_lengths.size());
+            const auto expected_lengths = std::vector<std::size_t>(
+                all_lengths.cbegin(), all_lengths.cbegin() + static_cast<int64_t>(num_paths));
+
+            CHECK(path_lengths(sequential) == expected_lengths);
+
+            // the result does not depend on the number of threads
+            CHECK(concurrent == sequential);
+
+            // the temporary obstructions are not visible in the layout
+            CHECK(!layout.is_obstructed_coordinate(objective.source));
+        }
+    }
+}
+
+TEST_CASE("Yen's algorithm with bidirectional A* finds the cheapest paths", "[k-shortest-paths]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    obstruction_layout<clk_lyt> layout{clk_lyt{{8, 8}, twoddwave_clocking<clk_lyt>()}};
+
+    for (const auto& c : std::vector<coordinate<clk_lyt>>{
+             {0, 0}, {3, 0}, {5, 0}, {0, 1}, {5, 2}, {7, 2}, {1, 3}, {8, 3}, {6, 4}, {3, 6}, {5, 6}, {7, 6}, {2, 8}})
+    {
+        layout.obstruct_coordinate(c);
+    }
+
+    // non-uniform costs such that the spur paths are considerably more expensive than their reverse tree estimation
+    const auto cost = [](const auto&, const auto& tgt) { return static_cast<double>((3 * tgt.x + 5 * tgt.y) % 4 + 1); };
+
+    const auto path_costs = [&cost](const auto& collection)
+    {
+        std::vector<double> costs{};
+        std::transform(collection.cbegin(), collection.cend(), std::back_inserter(costs),
+                       [&cost](const auto& p)
+                       {
+                           double c = 0.0;
+                           for (auto it = p.cbegin(); it + 1 < p.cend(); ++it)
+                           {
+                               c += cost(*it, *(it + 1));
+                           }
+
+                           return c;
+                       });
+        std::sort(costs.begin(), costs.end());
+
+        return costs;
+    };
+
+    const routing_objective<obstruction_layout<clk_lyt>> objective{{1, 0}, {6, 5}};
+
+    // reference: the costs of all paths in ascending order
+    const auto all_costs = path_costs(enumerate_all_clocking_paths<path>(layout, objective));
+
+    for (const auto k : {1u, 3u, 10u, 30u})
+    {
+        yen_k_shortest_paths_params ps{};
+        ps.astar_params.bidirectional = true;
+
+        const auto collection = yen_k_shortest_paths<path>(layout, objective, k, ps, manhattan_distance_fn<>{}, cost);
+
+        // there is no cheaper path than the ones found
+        const auto num_paths      = std::min(static_cast<std::size_t>(k), all_costs.size());
+        const auto expected_costs =
+            std::vector<double>(all_costs.cbegin(), all_costs.cbegin() + static_cast<int64_t>(num_paths));
+
+        CHECK(path_costs(collection) == expected_costs);
+    }
+}
@@ -0,0 +1,92 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/path_finding/a_star.hpp>
+#include <fiction/algorithms/path_finding/search_state.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/utils/routing_utils.hpp>
+
+#include <cstdint>
+
+using namespace fiction;
+
+TEST_CASE("Path search state", "[search-state]")
+{
+    using state_t = path_search_state<offset::ucoord_t, uint64_t>;
+
+    state_t state{};
+    state.prepare(16);
+
+    CHECK(state.open_list.empty());
+    CHECK(!state.is_closed(3));
+    CHECK(state.g(3) == 0);
+
+    state.set_g(3, 7);
+    state.set_origin(3, {1, 0});
+    state.close(3);
+    state.open_list.push(5, {1, 1}, 4);
+
+    CHECK(state.is_closed(3));
+    CHECK(state.g(3) == 7);
+    CHECK(state.origin(3) == offset::ucoord_t{1, 0});
+
+    // keys beyond the prepared range are allocated on demand
+    state.set_g(42, 2);
+    CHECK(state.g(42) == 2);
+    CHECK(!state.is_closed(42));
+
+    // preparing a new search invalidates all entries
+    state.prepare(16);
+
+    CHECK(state.open_list.empty());
+    CHECK(!state.open_list.contains(5));
+    CHECK(!state.is_closed(3));
+    CHECK(state.g(3) == 0);
+    CHECK(state.g(42) == 0);
+}
+
+TEST_CASE("Search state pool", "[search-state]")
+{
+    using state_t = path_search_state<offset::ucoord_t, double>;
+    using pool_t  = search_state_pool<state_t>;
+
+    const state_t* first = nullptr;
+
+    {
+        auto outer = pool_t::acquire();
+        first      = &*outer;
+
+        // nested acquisitions obtain distinct states
+        auto inner = pool_t::acquire();
+        CHECK(&*inner != first);
+    }
+
+    // released states are reused
+    auto h1 = pool_t::acquire();
+    auto h2 = pool_t::acquire();
+
+    CHECK((&*h1 == first || &*h2 == first));
+}
+
+TEST_CASE("Repeated A* searches reuse pooled state", "[search-state]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt small{{3, 3}, twoddwave_clocking<clk_lyt>()};
+    const clk_lyt large{{9, 9}, twoddwave_clocking<clk_lyt>()};
+
+    for (auto i = 0u; i < 3; ++i)
+    {
+        // alternating layout sizes must not leak state between searches
+        CHECK(a_star<path>(large, {{0, 0}, {9, 9}}).size() == 19);
+        CHECK(a_star<path>(small, {{0, 0}, {3, 3}}).size() == 7);
+        CHECK(a_star<path>(small, {{3, 3}, {0, 0}}).empty());
+        CHECK(a_star_distance(large, {0, 0}, {5, 2}) == 7);
+    }
+}
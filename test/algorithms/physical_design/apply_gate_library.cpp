@@ -0,0 +1,92 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+#include "utils/blueprints/network_blueprints.hpp"
+
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/gate_level_layout.hpp>
+#include <fiction/layouts/hexagonal_layout.hpp>
+#include <fiction/layouts/tile_based_layout.hpp>
+#include <fiction/networks/technology_network.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/qca_one_library.hpp>
+#include <fiction/technology/sidb_bestagon_library.hpp>
+#include <fiction/types.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+
+using namespace fiction;
+
+template <typename CellLyt1, typename CellLyt2>
+void check_identical_cells(const CellLyt1& lyt1, const CellLyt2& lyt2)
+{
+    CHECK(lyt1.num_cells() == lyt2.num_cells());
+    CHECK(lyt1.num_pis() == lyt2.num_pis());
+    CHECK(lyt1.num_pos() == lyt2.num_pos());
+    CHECK(lyt1.get_layout_name() == lyt2.get_layout_name());
+
+    lyt1.foreach_cell(
+        [&lyt1, &lyt2](const auto& c)
+        {
+            CHECK(lyt1.get_cell_type(c) == lyt2.get_cell_type(c));
+            CHECK(lyt1.get_cell_mode(c) == lyt2.get_cell_mode(c));
+            CHECK(lyt1.get_cell_name(c) == lyt2.get_cell_name(c));
+        });
+}
+
+TEST_CASE("Parallel application of gate libraries", "[apply-gate-library]")
+{
+    apply_gate_library_params ps{};
+    ps.num_threads = 4ul;
+
+    SECTION("QCA ONE")
+    {
+        using chunked_qca_cell_clk_lyt = cell_level_layout<qca_technology, clocked_layout<cartesian_layout<>>,
+                                                           chunked_cell_storage>;
+
+        const auto check = [&ps](const auto& ntk)
+        {
+            const auto gate_lyt = orthogonal<cart_gate_clk_lyt>(ntk);
+
+            const auto sequential = apply_gate_library<qca_cell_clk_lyt, qca_one_library>(gate_lyt);
+            const auto parallel   = apply_gate_library<qca_cell_clk_lyt, qca_one_library>(gate_lyt, ps);
+            const auto chunked    = apply_gate_library<chunked_qca_cell_clk_lyt, qca_one_library>(gate_lyt, ps);
+
+            check_identical_cells(sequential, parallel);
+            check_identical_cells(sequential, chunked);
+        };
+
+        check(blueprints::maj4_network<mockturtle::aig_network>());
+        check(blueprints::unbalanced_and_inv_network<mockturtle::aig_network>());
+    }
+    SECTION("Bestagon")
+    {
+        using gate_layout =
+            gate_level_layout<clocked_layout<tile_based_layout<hexagonal_layout<offset::ucoord_t, even_row_hex>>>>;
+        using sidb_layout = cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+
+        const auto gate_lyt = blueprints::row_clocked_and_xor_gate_layout<gate_layout>();
+
+        const auto sequential = apply_gate_library<sidb_layout, sidb_bestagon_library>(gate_lyt);
+        const auto parallel   = apply_gate_library<sidb_layout, sidb_bestagon_library>(gate_lyt, ps);
+
+        check_identical_cells(sequential, parallel);
+    }
+    SECTION("More threads than tiles")
+    {
+        ps.num_threads = 64ul;
+
+        const auto gate_lyt = orthogonal<cart_gate_clk_lyt>(blueprints::and_or_network<technology_network>());
+
+        check_identical_cells(apply_gate_library<qca_cell_clk_lyt, qca_one_library>(gate_lyt),
+                              apply_gate_library<qca_cell_clk_lyt, qca_one_library>(gate_lyt, ps));
+    }
+}
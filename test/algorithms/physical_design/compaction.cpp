@@ -0,0 +1,152 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/network_blueprints.hpp"
+#include "utils/equivalence_checking_utils.hpp"
+
+#include <fiction/algorithms/physical_design/compaction.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/algorithms/verification/design_rule_violations.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/networks/technology_network.hpp>
+#include <fiction/types.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/mig.hpp>
+
+#include <sstream>
+
+using namespace fiction;
+
+template <typename Lyt>
+void check_drvs(const Lyt& lyt)
+{
+    gate_level_drv_params ps{};
+    std::stringstream     ss{};
+    ps.out = &ss;
+    gate_level_drv_stats st{};
+    gate_level_drvs(lyt, ps, &st);
+
+    REQUIRE(st.drvs == 0);
+}
+
+TEST_CASE("Compaction of straight wire lines", "[compaction]")
+{
+    using gate_layout = cart_gate_clk_lyt;
+
+    gate_layout layout{{3, 1, 0}, twoddwave_clocking<gate_layout>()};
+
+    const auto x1 = layout.create_pi("x1", {0, 0});
+    const auto x2 = layout.create_pi("x2", {0, 1});
+    const auto w1 = layout.create_buf(layout.create_buf(x1, {1, 0}), {2, 0});
+    const auto w2 = layout.create_buf(x2, {1, 1});
+    const auto a  = layout.create_and(w1, w2, {2, 1});
+    layout.create_po(a, "f", {3, 1});
+
+    // restrict the compaction to line removal
+    compaction_params ps{};
+    ps.relocate_gates = false;
+
+    compaction_stats st{};
+    const auto       compact_layout = compaction(layout, ps, &st);
+
+    // column 1 only hosts horizontal wire segments; all rows host PIs
+    CHECK(st.num_rounds == 1);
+    CHECK(st.num_removed_columns == 1);
+    CHECK(st.num_removed_rows == 0);
+    CHECK(st.num_removed_wires == 2);
+    CHECK(st.x_size == 3);
+    CHECK(st.y_size == 2);
+
+    CHECK(compact_layout.is_and(compact_layout.get_node({1, 1})));
+    CHECK(compact_layout.is_wire(compact_layout.get_node({1, 0})));
+    CHECK(compact_layout.is_po_tile({2, 1}));
+
+    check_drvs(compact_layout);
+    check_eq(layout, compact_layout);
+
+    CHECK(compact_layout.get_input_name(0) == "x1");
+    CHECK(compact_layout.get_input_name(1) == "x2");
+    CHECK(compact_layout.get_output_name(0) == "f");
+}
+
+TEST_CASE("Compaction of orthogonal layouts", "[compaction]")
+{
+    using gate_layout = cart_gate_clk_lyt;
+
+    const auto check = [](const auto& ntk)
+    {
+        const auto layout = orthogonal<gate_layout>(ntk);
+
+        compaction_stats st{};
+        const auto       compact_layout = compaction(layout, {}, &st);
+
+        CHECK(st.x_size == compact_layout.x() + 1);
+        CHECK(st.y_size == compact_layout.y() + 1);
+        CHECK(st.x_size * st.y_size <= (layout.x() + 1) * (layout.y() + 1));
+        CHECK(compact_layout.num_gates() == layout.num_gates());
+
+        // relocated gates are re-routed with new wire segments
+        if (st.num_relocated_gates == 0)
+        {
+            CHECK(st.x_size <= layout.x() + 1);
+            CHECK(st.y_size <= layout.y() + 1);
+            CHECK(compact_layout.num_wires() + st.num_removed_wires == layout.num_wires());
+        }
+
+        check_drvs(compact_layout);
+        check_eq(ntk, compact_layout);
+    };
+
+    check(blueprints::unbalanced_and_inv_network<mockturtle::aig_network>());
+    check(blueprints::maj1_network<mockturtle::aig_network>());
+    check(blueprints::maj4_network<mockturtle::aig_network>());
+    check(blueprints::se_coloring_corner_case_network<technology_network>());
+    check(blueprints::fanout_substitution_corner_case_network<technology_network>());
+    check(blueprints::nary_operation_network<technology_network>());
+    check(blueprints::clpl<technology_network>());
+    check(blueprints::half_adder_network<mockturtle::mig_network>());
+    check(blueprints::full_adder_network<mockturtle::mig_network>());
+}
+
+TEST_CASE("Gate relocation strictly reduces the area of orthogonal layouts", "[compaction]")
+{
+    using gate_layout = cart_gate_clk_lyt;
+
+    const auto check = [](const auto& ntk)
+    {
+        const auto layout = orthogonal<gate_layout>(ntk);
+
+        compaction_params lines_ps{};
+        lines_ps.relocate_gates = false;
+
+        compaction_stats lines_st{};
+        const auto       lines_layout = compaction(layout, lines_ps, &lines_st);
+
+        compaction_stats st{};
+        const auto       compact_layout = compaction(layout, {}, &st);
+
+        CHECK(st.num_relocated_gates > 0);
+        CHECK(st.x_size * st.y_size < (layout.x() + 1) * (layout.y() + 1));
+        CHECK(st.x_size * st.y_size < lines_st.x_size * lines_st.y_size);
+        CHECK(compact_layout.num_gates() == layout.num_gates());
+
+        check_drvs(lines_layout);
+        check_drvs(compact_layout);
+        check_eq(ntk, compact_layout);
+    };
+
+    check(blueprints::unbalanced_and_inv_network<technology_network>());
+    check(blueprints::and_or_network<technology_network>());
+    check(blueprints::se_coloring_corner_case_network<technology_network>());
+    check(blueprints::fanout_substitution_corner_case_network<technology_network>());
+    check(blueprints::clpl<technology_network>());
+    check(blueprints::half_adder_network<technology_network>());
+    check(blueprints::mux21_network<technology_network>());
+    check(blueprints::nand_xnor_network<technology_network>());
+    check(blueprints::inverter_network<technology_network>());
+    check(blueprints::full_adder_network<mockturtle::aig_network>());
+}
@@ -675,6 +675,190 @@ TEST_CASE("Exact physical design timeout", "[exact]")
     CHECK(!layout.has_value());
 }
 
+TEST_CASE("Exact physical design in best-effort mode", "[exact]")
+{
+    const auto half_adder = blueprints::half_adder_network<mockturtle::aig_network>();
+
+    SECTION("Heuristic fallback on timeout")
+    {
+        auto best_effort_config        = twoddwave(crossings(configuration<cart_gate_clk_lyt>()));
+        best_effort_config.timeout     = 1u;
+        best_effort_config.best_effort = true;
+
+        exact_physical_design_stats stats{};
+
+        const auto layout = exact<cart_gate_clk_lyt>(half_adder, best_effort_config, &stats);
+
+        // the heuristic layout is returned instead of no layout at all
+        REQUIRE(layout.has_value());
+
+        CHECK(stats.is_fallback);
+        CHECK(!stats.is_optimal);
+
+        check_drvs(*layout);
+        check_eq(half_adder, *layout);
+    }
+    SECTION("Exact result within the heuristic bounds")
+    {
+        auto best_effort_config        = twoddwave(crossings(configuration<cart_gate_clk_lyt>()));
+        best_effort_config.best_effort = true;
+
+        exact_physical_design_stats stats{};
+
+        const auto layout = exact<cart_gate_clk_lyt>(half_adder, best_effort_config, &stats);
+
+        REQUIRE(layout.has_value());
+
+        CHECK(stats.is_optimal);
+        CHECK(!stats.is_fallback);
+
+        const auto heuristic_layout = orthogonal<cart_gate_clk_lyt>(half_adder);
+
+        CHECK(layout->x() <= heuristic_layout.x());
+        CHECK(layout->y() <= heuristic_layout.y());
+
+        check_eq(half_adder, *layout);
+    }
+}
+
+TEST_CASE("Exact physical design with directional border I/Os under 2DDWave clocking", "[exact]")
+{
+    const auto half_adder = blueprints::half_adder_network<mockturtle::aig_network>();
+
+    auto directional_config                  = twoddwave(crossings(border_io(configuration<cart_gate_clk_lyt>())));
+    directional_config.directional_border_io = true;
+
+    const auto layout = generate_layout<cart_gate_clk_lyt>(half_adder, directional_config);
+
+    check_eq(half_adder, layout);
+
+    // inputs enter the layout from the north or west and outputs leave it to the south or east
+    layout.foreach_pi(
+        [&layout](const auto& pi)
+        {
+            const auto t = layout.get_tile(pi);
+            CHECK((layout.is_at_northern_border(t) || layout.is_at_western_border(t)));
+        });
+    layout.foreach_po(
+        [&layout](const auto& po)
+        {
+            const auto t = layout.get_tile(layout.get_node(po));
+            CHECK((layout.is_at_southern_border(t) || layout.is_at_eastern_border(t)));
+        });
+}
+
+TEST_CASE("Exact physical design memory limit", "[exact]")
+{
+    const auto half_adder = blueprints::half_adder_network<mockturtle::aig_network>();
+
+    auto memory_config         = twoddwave(crossings(configuration<cart_gate_clk_lyt>()));
+    memory_config.memory_limit = 0ul;  // any solver allocation exceeds the limit
+
+    SECTION("Search is aborted")
+    {
+        exact_physical_design_stats stats{};
+
+        const auto layout = exact<cart_gate_clk_lyt>(half_adder, memory_config, &stats);
+
+        CHECK(!layout.has_value());
+        CHECK(stats.is_memory_limit_exceeded);
+        CHECK(!stats.is_optimal);
+    }
+    SECTION("Heuristic fallback")
+    {
+        memory_config.best_effort = true;
+
+        exact_physical_design_stats stats{};
+
+        const auto layout = exact<cart_gate_clk_lyt>(half_adder, memory_config, &stats);
+
+        REQUIRE(layout.has_value());
+
+        CHECK(stats.is_memory_limit_exceeded);
+        CHECK(stats.is_fallback);
+        CHECK(!stats.is_optimal);
+
+        check_drvs(*layout);
+        check_eq(half_adder, *layout);
+    }
+    SECTION("Multiple threads")
+    {
+        memory_config.best_effort = true;
+        memory_config.num_threads = 2ul;
+
+        exact_physical_design_stats stats{};
+
+        const auto layout = exact<cart_gate_clk_lyt>(half_adder, memory_config, &stats);
+
+        REQUIRE(layout.has_value());
+
+        CHECK(stats.is_memory_limit_exceeded);
+        CHECK(!stats.is_optimal);
+
+        check_eq(half_adder, *layout);
+    }
+    SECTION("Sufficient memory")
+    {
+        memory_config.memory_limit = 16384ul;
+
+        exact_physical_design_stats stats{};
+
+        const auto layout = exact<cart_gate_clk_lyt>(half_adder, memory_config, &stats);
+
+        REQUIRE(layout.has_value());
+
+        CHECK(!stats.is_memory_limit_exceeded);
+        CHECK(stats.is_optimal);
+    }
+}
+
+TEST_CASE("Exact physical design SMT profiling", "[exact]")
+{
+    auto profiling_config = twoddwave(crossings(configuration<cart_gate_clk_lyt>()));
+
+    SECTION("Disabled by default")
+    {
+        exact_physical_design_stats stats{};
+
+        const auto layout =
+            exact<cart_gate_clk_lyt>(blueprints::and_or_network<mockturtle::aig_network>(), profiling_config, &stats);
+
+        REQUIRE(layout.has_value());
+
+        CHECK(stats.constraint_profile.empty());
+        CHECK(stats.smt_profile()["constraints"].empty());
+    }
+
+    profiling_config.smt_profiling = true;
+
+    exact_physical_design_stats stats{};
+
+    const auto layout =
+        exact<cart_gate_clk_lyt>(blueprints::and_or_network<mockturtle::aig_network>(), profiling_config, &stats);
+
+    REQUIRE(layout.has_value());
+
+    // constraint families that are generated for every instance
+    for (const auto& family : {"restrict_tile_elements", "restrict_vertices", "define_gate_fanout_tiles",
+                               "define_gate_fanin_tiles", "define_wire_fanout_tiles", "define_wire_fanin_tiles"})
+    {
+        REQUIRE(stats.constraint_profile.count(family) == 1);
+        CHECK(stats.constraint_profile.at(family).num_expressions > 0);
+        CHECK(stats.constraint_profile.at(family).num_assertions > 0);
+    }
+
+    // 2DDWave is a linear scheme, hence, no cycle constraints are generated
+    CHECK(stats.constraint_profile.count("eliminate_cycles") == 0);
+
+    CHECK(!stats.solver_statistics.empty());
+
+    const auto profile = stats.smt_profile();
+
+    CHECK(profile.contains("constraints"));
+    CHECK(profile.contains("solver statistics"));
+    CHECK(profile["constraints"].size() == stats.constraint_profile.size());
+}
+
 TEST_CASE("Name conservation after exact physical design", "[exact]")
 {
     auto maj = blueprints::maj1_network<mockturtle::names_view<mockturtle::mig_network>>();
@@ -0,0 +1,117 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#if (FICTION_Z3_SOLVER)
+
+#include "utils/blueprints/network_blueprints.hpp"
+#include "utils/equivalence_checking_utils.hpp"
+
+#include <fiction/algorithms/physical_design/hierarchical_exact.hpp>
+#include <fiction/algorithms/verification/design_rule_violations.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/networks/technology_network.hpp>
+#include <fiction/types.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/networks/mig.hpp>
+
+#include <memory>
+#include <sstream>
+
+using namespace fiction;
+
+template <typename Lyt>
+void check_drvs(const Lyt& lyt)
+{
+    gate_level_drv_params ps{};
+    std::stringstream     ss{};
+    ps.out = &ss;
+    gate_level_drv_stats st{};
+    gate_level_drvs(lyt, ps, &st);
+
+    REQUIRE(st.drvs == 0);
+}
+
+template <typename Lyt>
+hierarchical_exact_params<Lyt> hierarchical_configuration(const uint32_t max_partition_size) noexcept
+{
+    hierarchical_exact_params<Lyt> ps{};
+    ps.exact_ps.crossings = true;
+    ps.max_partition_size = max_partition_size;
+    ps.num_threads        = 2ul;
+
+    return ps;
+}
+
+TEST_CASE("Hierarchical exact physical design", "[hierarchical-exact]")
+{
+    using gate_layout = cart_gate_clk_lyt;
+
+    SECTION("Single partition")
+    {
+        const auto ntk = blueprints::and_or_network<technology_network>();
+
+        hierarchical_exact_stats st{};
+        const auto layout = hierarchical_exact<gate_layout>(ntk, hierarchical_configuration<gate_layout>(16u), &st);
+
+        REQUIRE(layout.has_value());
+
+        CHECK(st.num_partitions == 1);
+        CHECK(st.cut_size == 0);
+
+        check_drvs(*layout);
+        check_eq(ntk, *layout);
+    }
+    SECTION("Multiple partitions")
+    {
+        const auto check = [](const auto& ntk)
+        {
+            hierarchical_exact_stats st{};
+            const auto layout = hierarchical_exact<gate_layout>(ntk, hierarchical_configuration<gate_layout>(2u), &st);
+
+            REQUIRE(layout.has_value());
+
+            CHECK(st.num_partitions > 1);
+            CHECK(st.cut_size > 0);
+            CHECK(st.partition_stats.size() == st.num_partitions);
+            CHECK(st.x_size == layout->x() + 1);
+            CHECK(st.y_size == layout->y() + 1);
+
+            check_drvs(*layout);
+            check_eq(ntk, *layout);
+        };
+
+        check(blueprints::half_adder_network<mockturtle::aig_network>());
+        check(blueprints::full_adder_network<mockturtle::mig_network>());
+        check(blueprints::mux21_network<technology_network>());
+    }
+    SECTION("Global synchronization is not supported")
+    {
+        const auto ntk = blueprints::full_adder_network<mockturtle::mig_network>();
+
+        auto ps                   = hierarchical_configuration<gate_layout>(2u);
+        ps.exact_ps.desynchronize = false;
+
+        // the combination is rejected instead of silently overriding the parameter
+        CHECK(!hierarchical_exact<gate_layout>(ntk, ps).has_value());
+    }
+    SECTION("Unsupported clocking scheme")
+    {
+        auto ps            = hierarchical_configuration<gate_layout>(2u);
+        ps.exact_ps.scheme = std::make_shared<clocking_scheme<coordinate<gate_layout>>>(use_clocking<gate_layout>());
+
+        CHECK(!hierarchical_exact<gate_layout>(blueprints::and_or_network<technology_network>(), ps).has_value());
+    }
+}
+
+#else   // FICTION_Z3_SOLVER
+
+TEST_CASE("Hierarchical exact physical design", "[hierarchical-exact]")
+{
+    CHECK(true);  // workaround for empty test case
+}
+
+#endif  // FICTION_Z3_SOLVER
@@ -0,0 +1,146 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+#include "utils/equivalence_checking_utils.hpp"
+
+#include <fiction/algorithms/physical_design/negotiated_congestion_routing.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/routing_utils.hpp>
+
+using namespace fiction;
+
+template <typename Spec, typename Impl>
+void check_negotiated_congestion_routing(const Spec& spec, Impl& impl,
+                                         const std::vector<routing_objective<Impl>>& objectives,
+                                         negotiated_congestion_routing_params        ps = {})
+{
+    negotiated_congestion_routing_stats st{};
+
+    const auto success = negotiated_congestion_routing(impl, objectives, ps, &st);
+
+    CHECK(success);
+
+    check_eq(spec, impl);
+
+    // the last iteration has to be free of overuse
+    REQUIRE(!st.iterations.empty());
+    CHECK(st.iterations.front().num_rerouted_objectives == objectives.size());
+    CHECK(st.iterations.back().num_overused_resources == 0);
+    CHECK(st.iterations.back().total_overuse == 0);
+}
+
+template <typename Lyt>
+void check_blueprint(Lyt (*blueprint)(), negotiated_congestion_routing_params ps = {})
+{
+    const auto spec_layout = blueprint();
+    auto       impl_layout = blueprint();
+
+    const auto objectives = extract_routing_objectives(impl_layout);
+
+    // remove the wire routing from the implementation
+    clear_routing(impl_layout);
+
+    SECTION("Sequential")
+    {
+        check_negotiated_congestion_routing(spec_layout, impl_layout, objectives, ps);
+    }
+    SECTION("Parallel")
+    {
+        ps.num_threads = 4ul;
+        check_negotiated_congestion_routing(spec_layout, impl_layout, objectives, ps);
+    }
+}
+
+TEST_CASE("Simple wire connection", "[negotiated-congestion-routing]")
+{
+    check_blueprint(blueprints::straight_wire_gate_layout<cart_gate_clk_lyt>);
+}
+
+TEST_CASE("Two paths wire connections", "[negotiated-congestion-routing]")
+{
+    check_blueprint(blueprints::unbalanced_and_layout<cart_gate_clk_lyt>);
+}
+
+TEST_CASE("Three paths wire connections", "[negotiated-congestion-routing]")
+{
+    check_blueprint(blueprints::three_wire_paths_gate_layout<cart_gate_clk_lyt>);
+}
+
+TEST_CASE("Direct gate connections", "[negotiated-congestion-routing]")
+{
+    check_blueprint(blueprints::xor_maj_gate_layout<cart_gate_clk_lyt>);
+}
+
+TEST_CASE("Routing with crossings", "[negotiated-congestion-routing]")
+{
+    negotiated_congestion_routing_params ps{};
+    ps.crossings = true;
+
+    check_blueprint(blueprints::crossing_layout<cart_gate_clk_lyt>, ps);
+}
+
+TEST_CASE("Partial routing", "[negotiated-congestion-routing]")
+{
+    auto spec_layout = blueprints::use_and_gate_layout<cart_gate_clk_lyt>();
+    auto impl_layout = blueprints::use_and_gate_layout<cart_gate_clk_lyt>();
+
+    auto objectives = extract_routing_objectives(impl_layout);
+    objectives.push_back({{0, 3}, {3, 0}});  // additional unsatisfiable objective
+
+    // remove the wire routing from the implementation
+    clear_routing(impl_layout);
+
+    negotiated_congestion_routing_params ps{};
+
+    SECTION("Without partial routing")
+    {
+        const auto num_wires = impl_layout.num_wires();
+
+        // routing should fail and leave the layout untouched
+        CHECK(!negotiated_congestion_routing(impl_layout, objectives, ps));
+        CHECK(impl_layout.num_wires() == num_wires);
+    }
+    SECTION("With partial routing")
+    {
+        ps.conduct_partial_routing = true;
+
+        negotiated_congestion_routing_stats st{};
+
+        CHECK(negotiated_congestion_routing(impl_layout, objectives, ps, &st));
+        CHECK(st.number_of_unsatisfied_objectives == 1);
+
+        check_eq(spec_layout, impl_layout);
+    }
+}
+
+TEST_CASE("Routing failure", "[negotiated-congestion-routing]")
+{
+    cart_gate_clk_lyt layout{{3, 4, 1}, twoddwave_clocking<cart_gate_clk_lyt>()};
+
+    const auto x1 = layout.create_pi("x1", {0, 1});
+    const auto x2 = layout.create_pi("x2", {1, 0});
+
+    layout.create_pi("x3", {0, 2});
+    layout.create_and(x1, x2, {1, 3});
+
+    // both objectives have to enter the AND gate from the same tile
+    const std::vector<routing_objective<cart_gate_clk_lyt>> objectives{{{0, 1}, {1, 3}}, {{1, 0}, {1, 3}}};
+
+    negotiated_congestion_routing_params ps{};
+    ps.crossings      = true;
+    ps.max_iterations = 10ul;
+
+    negotiated_congestion_routing_stats st{};
+
+    // routing should fail
+    CHECK(!negotiated_congestion_routing(layout, objectives, ps, &st));
+    CHECK(st.number_of_unsatisfied_objectives == 2);
+
+    // the overuse could not be resolved in any iteration
+    CHECK(st.iterations.size() == 10);
+    CHECK(st.iterations.back().total_overuse > 0);
+}
@@ -4,8 +4,6 @@
 
 #include <catch2/catch_test_macros.hpp>
 
-#if (MUGEN)
-
 #include "utils/blueprints/network_blueprints.hpp"
 #include "utils/equivalence_checking_utils.hpp"
 
@@ -87,6 +85,22 @@ one_pass_synthesis_params<Lyt>&& async(const std::size_t t, one_pass_synthesis_p
     return std::move(ps);
 }
 
+template <typename Lyt>
+one_pass_synthesis_params<Lyt>&& native(one_pass_synthesis_params<Lyt>&& ps) noexcept
+{
+    ps.engine = one_pass_synthesis_engine::BILL;
+
+    return std::move(ps);
+}
+
+template <typename Lyt>
+one_pass_synthesis_params<Lyt>&& workers(const std::size_t w, one_pass_synthesis_params<Lyt>&& ps) noexcept
+{
+    ps.num_workers = w;
+
+    return std::move(ps);
+}
+
 void check_stats(const one_pass_synthesis_stats& st) noexcept
 {
     CHECK(std::chrono::duration_cast<std::chrono::milliseconds>(st.time_total).count() > 0);
@@ -126,6 +140,8 @@ void check(const Ntk& ntk, const one_pass_synthesis_params<Lyt>& ps)
     apply_gate_library(layout);
 }
 
+#if (MUGEN)
+
 TEST_CASE("One-pass synthesis", "[one-pass]")
 {
     SECTION("2DDWave clocking")
@@ -169,6 +185,39 @@ TEST_CASE("One-pass synthesis", "[one-pass]")
               res(crossings(async(2, configuration<cart_gate_clk_lyt>()))));
     }
 #endif
+#if !defined(_WIN32)
+    SECTION("Parallel aspect ratios")
+    {
+        const auto ntk = blueprints::and_or_network<mockturtle::mig_network>();
+
+        check(ntk, use(crossings(workers(4, configuration<cart_gate_clk_lyt>()))));
+
+        // the parallel exploration must not yield larger layouts than the sequential one
+        one_pass_synthesis_stats sequential_stats{}, parallel_stats{};
+
+        const auto sequential = one_pass_synthesis<cart_gate_clk_lyt>(
+            ntk, twoddwave(crossings(configuration<cart_gate_clk_lyt>())), &sequential_stats);
+        const auto parallel = one_pass_synthesis<cart_gate_clk_lyt>(
+            ntk, twoddwave(crossings(workers(4, configuration<cart_gate_clk_lyt>()))), &parallel_stats);
+
+        CHECK(sequential_stats.x_size * sequential_stats.y_size == parallel_stats.x_size * parallel_stats.y_size);
+
+        // the layout that is transferred from the worker has the same I/O names
+        REQUIRE(sequential.has_value());
+        REQUIRE(parallel.has_value());
+        REQUIRE(sequential->num_pis() == parallel->num_pis());
+        REQUIRE(sequential->num_pos() == parallel->num_pos());
+
+        for (auto i = 0u; i < sequential->num_pis(); ++i)
+        {
+            CHECK(sequential->get_input_name(i) == parallel->get_input_name(i));
+        }
+        for (auto i = 0u; i < sequential->num_pos(); ++i)
+        {
+            CHECK(sequential->get_output_name(i) == parallel->get_output_name(i));
+        }
+    }
+#endif
 }
 
 TEST_CASE("One-pass synthesis timeout", "[one-pass]")
@@ -204,11 +253,60 @@ TEST_CASE("Name conservation after one-pass synthesis", "[one-pass]")
     CHECK(layout->get_output_name(0) == "f");
 }
 
-#else   // MUGEN
+#endif  // MUGEN
 
-TEST_CASE("One-pass synthesis", "[one-pass]")
+TEST_CASE("Native one-pass synthesis", "[one-pass]")
 {
-    CHECK(true);  // workaround for empty test case
+    SECTION("2DDWave clocking")
+    {
+        check(blueprints::and_or_network<mockturtle::mig_network>(),
+              native(twoddwave(crossings(configuration<cart_gate_clk_lyt>()))));
+    }
+    SECTION("USE clocking")
+    {
+        check(blueprints::and_or_network<mockturtle::mig_network>(),
+              native(use(crossings(configuration<cart_gate_clk_lyt>()))));
+    }
+    SECTION("RES clocking")
+    {
+        check(blueprints::and_or_network<mockturtle::mig_network>(),
+              native(res(crossings(configuration<cart_gate_clk_lyt>()))));
+    }
+    SECTION("Planar")
+    {
+        check(blueprints::unbalanced_and_inv_network<mockturtle::aig_network>(),
+              native(twoddwave(configuration<cart_gate_clk_lyt>())));
+    }
+    SECTION("MAJ network")
+    {
+        check(blueprints::maj1_network<mockturtle::mig_network>(),
+              native(res(maj(configuration<cart_gate_clk_lyt>()))));
+    }
+    SECTION("Multi-output network")
+    {
+        check(blueprints::multi_output_and_network<mockturtle::aig_network>(),
+              native(twoddwave(crossings(configuration<cart_gate_clk_lyt>()))));
+    }
+#if !defined(_WIN32)
+    SECTION("Parallel aspect ratios")
+    {
+        check(blueprints::and_or_network<mockturtle::mig_network>(),
+              native(use(crossings(workers(4, configuration<cart_gate_clk_lyt>())))));
+    }
+#endif
+    SECTION("Timeout")
+    {
+        auto timeout_config    = native(use(configuration<cart_gate_clk_lyt>()));
+        timeout_config.timeout = 1u;
+        // without AND and OR gates, the specification cannot be realized on any aspect ratio such that the exploration
+        // is guaranteed to run into the timeout regardless of the machine's speed
+        timeout_config.enable_and = false;
+        timeout_config.enable_or  = false;
+
+        const auto layout =
+            one_pass_synthesis<cart_gate_clk_lyt>(blueprints::and_or_network<mockturtle::mig_network>(),
+                                                  timeout_config);
+
+        CHECK(!layout.has_value());
+    }
 }
-
-#endif  // MUGEN
@@ -8,7 +8,9 @@
 #include "utils/equivalence_checking_utils.hpp"
 
 #include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/algorithms/physical_design/hexagonalization.hpp>
 #include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/algorithms/verification/design_rule_violations.hpp>
 #include <fiction/layouts/cartesian_layout.hpp>
 #include <fiction/layouts/cell_level_layout.hpp>
 #include <fiction/layouts/clocked_layout.hpp>
@@ -16,12 +18,15 @@
 #include <fiction/layouts/tile_based_layout.hpp>
 #include <fiction/networks/technology_network.hpp>
 #include <fiction/technology/qca_one_library.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/network_utils.hpp>
 
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/mig.hpp>
 #include <mockturtle/views/fanout_view.hpp>
 #include <mockturtle/views/names_view.hpp>
 
+#include <sstream>
 #include <type_traits>
 
 using namespace fiction;
@@ -32,6 +37,24 @@ TEST_CASE("East-south coloring", "[orthogonal]")
     {
         auto container = detail::east_south_edge_coloring(ntk);
         CHECK(detail::is_east_south_colored(container.color_ntk));
+
+        // the parallel coloring has to yield the exact same result
+        auto parallel_container = detail::east_south_edge_coloring(ntk, 4ul);
+        CHECK(detail::is_east_south_colored(parallel_container.color_ntk));
+
+        ntk.foreach_node(
+            [&](const auto& n)
+            {
+                CHECK(container.color_ntk.color(n) == parallel_container.color_ntk.color(n));
+
+                foreach_incoming_edge(ntk, n,
+                                      [&](const auto& e)
+                                      {
+                                          const mockturtle::edge<decltype(container.color_ntk)> ce{e.source, e.target};
+                                          CHECK(container.color_ntk.edge_color(ce) ==
+                                                parallel_container.color_ntk.edge_color(ce));
+                                      });
+            });
     };
 
     check(mockturtle::fanout_view{
@@ -51,6 +74,20 @@ TEST_CASE("East-south coloring", "[orthogonal]")
         fanout_substitution<technology_network>(blueprints::half_adder_network<mockturtle::mig_network>())});
     check(mockturtle::fanout_view{
         fanout_substitution<technology_network>(blueprints::full_adder_network<mockturtle::mig_network>())});
+
+    SECTION("Deep network")
+    {
+        mockturtle::aig_network aig{};
+
+        auto a = aig.create_pi();
+        for (auto i = 0u; i < 50000u; ++i)
+        {
+            a = aig.create_and(a, aig.create_pi());
+        }
+        aig.create_po(a);
+
+        check(mockturtle::fanout_view{fanout_substitution<technology_network>(aig)});
+    }
 }
 
 void check_stats(const orthogonal_physical_design_stats& st) noexcept
@@ -95,6 +132,10 @@ TEST_CASE("Layout equivalence", "[algorithms]")
 
         check_ortho_equiv_all<gate_layout>();
     }
+    SECTION("Cartesian layouts with dense tile storage")
+    {
+        check_ortho_equiv_all<dense_cart_gate_clk_lyt>();
+    }
     SECTION("Hexagonal layouts")
     {
         SECTION("odd row")
@@ -174,3 +215,89 @@ TEST_CASE("Name conservation after orthogonal physical design", "[orthogonal]")
     // PO names
     CHECK(layout.get_output_name(0) == "f");
 }
+
+TEST_CASE("Native hexagonal orthogonal physical design", "[orthogonal]")
+{
+    const auto check = [](const auto& ntk)
+    {
+        const auto hex_layout = orthogonal<hex_even_row_gate_clk_lyt>(ntk);
+
+        CHECK(hex_layout.is_clocking_scheme(clock_name::ROW));
+
+        // the result has to coincide with the one of the detour via a Cartesian layout
+        const auto detour_layout = hexagonalization(orthogonal<cart_gate_clk_lyt>(ntk));
+
+        CHECK(hex_layout.x() == detour_layout.x());
+        CHECK(hex_layout.y() == detour_layout.y());
+        CHECK(hex_layout.num_gates() == detour_layout.num_gates());
+        CHECK(hex_layout.num_wires() == detour_layout.num_wires());
+
+        hex_layout.foreach_node(
+            [&hex_layout, &detour_layout](const auto& n)
+            {
+                if (!hex_layout.is_constant(n))
+                {
+                    const auto t = hex_layout.get_tile(n);
+                    CHECK(hex_layout.node_function(n) == detour_layout.node_function(detour_layout.get_node(t)));
+                }
+            });
+
+        gate_level_drv_params ps{};
+        std::stringstream     ss{};
+        ps.out = &ss;
+        gate_level_drv_stats st{};
+        gate_level_drvs(hex_layout, ps, &st);
+
+        CHECK(st.drvs == 0);
+
+        check_eq(ntk, hex_layout);
+    };
+
+    check(blueprints::unbalanced_and_inv_network<mockturtle::aig_network>());
+    check(blueprints::maj1_network<mockturtle::aig_network>());
+    check(blueprints::maj4_network<mockturtle::aig_network>());
+    check(blueprints::se_coloring_corner_case_network<technology_network>());
+    check(blueprints::fanout_substitution_corner_case_network<technology_network>());
+    check(blueprints::clpl<technology_network>());
+    check(blueprints::half_adder_network<mockturtle::mig_network>());
+}
+
+TEST_CASE("Orthogonal physical design with dense tile storage", "[orthogonal]")
+{
+    const auto check = [](const auto& ntk)
+    {
+        orthogonal_physical_design_stats dense_st{}, sparse_st{};
+
+        const auto dense_layout  = orthogonal<dense_cart_gate_clk_lyt>(ntk, {}, &dense_st);
+        const auto sparse_layout = orthogonal<cart_gate_clk_lyt>(ntk, {}, &sparse_st);
+
+        // the storage policy must not affect the placement
+        CHECK(dense_st.x_size == sparse_st.x_size);
+        CHECK(dense_st.y_size == sparse_st.y_size);
+        CHECK(dense_st.num_gates == sparse_st.num_gates);
+        CHECK(dense_st.num_wires == sparse_st.num_wires);
+        CHECK(dense_layout.size() == sparse_layout.size());
+
+        dense_layout.foreach_node(
+            [&dense_layout, &sparse_layout](const auto& n)
+            {
+                if (!dense_layout.is_constant(n))
+                {
+                    const auto t = dense_layout.get_tile(n);
+
+                    CHECK(sparse_layout.get_node(t) == n);
+                    CHECK(dense_layout.node_function(n) == sparse_layout.node_function(n));
+                    CHECK(dense_layout.incoming_data_flow(t) == sparse_layout.incoming_data_flow(t));
+                }
+            });
+
+        check_eq(ntk, dense_layout);
+    };
+
+    check(blueprints::maj4_network<mockturtle::aig_network>());
+    check(blueprints::se_coloring_corner_case_network<technology_network>());
+    check(blueprints::fanout_substitution_corner_case_network<technology_network>());
+    check(blueprints::nary_operation_network<technology_network>());
+    check(blueprints::clpl<technology_network>());
+    check(blueprints::full_adder_network<mockturtle::mig_network>());
+}
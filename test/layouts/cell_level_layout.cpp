@@ -12,7 +12,9 @@
 #include <fiction/traits.hpp>
 #include <fiction/types.hpp>
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 using namespace fiction;
 
@@ -185,6 +187,87 @@ TEST_CASE("Cell type assignment", "[cell-level-layout]")
     CHECK(layout.get_cell_name({2, 4}).empty());
 }
 
+TEST_CASE("Chunked cell storage", "[cell-level-layout]")
+{
+    SECTION("Cartesian coordinates")
+    {
+        using cell_layout = cell_level_layout<qca_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>,
+                                              chunked_cell_storage>;
+
+        CHECK(is_cell_level_layout_v<cell_layout>);
+
+        cell_layout layout{cell_layout::aspect_ratio{9, 9}, "chunks", 5, 5};
+
+        CHECK(layout.is_empty());
+
+        // assign cells out of spatial order and across multiple clock zones
+        layout.assign_cell_type({7, 6}, qca_technology::cell_type::OUTPUT);
+        layout.assign_cell_type({6, 1}, qca_technology::cell_type::NORMAL);
+        layout.assign_cell_type({2, 2}, qca_technology::cell_type::NORMAL);
+        layout.assign_cell_type({0, 2}, qca_technology::cell_type::INPUT);
+        layout.assign_cell_type({2, 2}, qca_technology::cell_type::CONST_1);
+
+        CHECK(!layout.is_empty());
+        CHECK(layout.num_cells() == 4);
+        CHECK(layout.num_pis() == 1);
+        CHECK(layout.num_pos() == 1);
+
+        CHECK(layout.get_cell_type({2, 2}) == qca_technology::cell_type::CONST_1);
+        CHECK(layout.get_cell_type({6, 1}) == qca_technology::cell_type::NORMAL);
+        CHECK(layout.is_empty_cell({1, 2}));
+        CHECK(layout.is_empty_cell({9, 9}));
+
+        // cells are iterated in spatial order
+        std::vector<cell<cell_layout>> cells{};
+        layout.foreach_cell([&cells](const auto& c) { cells.push_back(c); });
+
+        CHECK(cells == std::vector<cell<cell_layout>>{{0, 2}, {2, 2}, {6, 1}, {7, 6}});
+
+        // erasing all cells of a clock zone releases it
+        layout.assign_cell_type({6, 1}, qca_technology::cell_type::EMPTY);
+        layout.assign_cell_type({6, 1}, qca_technology::cell_type::EMPTY);
+
+        CHECK(layout.num_cells() == 3);
+        CHECK(layout.is_empty_cell({6, 1}));
+
+        layout.assign_cell_type({0, 2}, qca_technology::cell_type::EMPTY);
+        layout.assign_cell_type({2, 2}, qca_technology::cell_type::EMPTY);
+        layout.assign_cell_type({7, 6}, qca_technology::cell_type::EMPTY);
+
+        CHECK(layout.is_empty());
+        CHECK(layout.num_pis() == 0);
+        CHECK(layout.num_pos() == 0);
+
+        uint32_t counter = 0;
+        layout.foreach_cell([&counter](const auto&) { ++counter; });
+
+        CHECK(counter == 0);
+    }
+    SECTION("Negative coordinates")
+    {
+        using cell_layout =
+            cell_level_layout<qca_technology, clocked_layout<cartesian_layout<cube::coord_t>>, chunked_cell_storage>;
+
+        cell_layout layout{cell_layout::aspect_ratio{9, 9}, "chunks", 5, 5};
+
+        layout.assign_cell_type({-1, -1}, qca_technology::cell_type::NORMAL);
+        layout.assign_cell_type({-5, -5}, qca_technology::cell_type::NORMAL);
+        layout.assign_cell_type({0, 0}, qca_technology::cell_type::NORMAL);
+
+        CHECK(layout.num_cells() == 3);
+        CHECK(layout.get_cell_type({-1, -1}) == qca_technology::cell_type::NORMAL);
+        CHECK(layout.get_cell_type({-5, -5}) == qca_technology::cell_type::NORMAL);
+        CHECK(layout.get_cell_type({0, 0}) == qca_technology::cell_type::NORMAL);
+        CHECK(layout.is_empty_cell({-6, -6}));
+        CHECK(layout.is_empty_cell({4, 4}));
+
+        std::vector<cell<cell_layout>> cells{};
+        layout.foreach_cell([&cells](const auto& c) { cells.push_back(c); });
+
+        CHECK(cells == std::vector<cell<cell_layout>>{{-5, -5}, {-1, -1}, {0, 0}});
+    }
+}
+
 TEST_CASE("Cell mode assignment", "[cell-level-layout]")
 {
     using cell_layout = cell_level_layout<qca_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>;
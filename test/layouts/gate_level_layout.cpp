@@ -2,6 +2,7 @@
 // Created by marcel on 31.03.21.
 //
 
+#include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "utils/blueprints/layout_blueprints.hpp"
@@ -17,6 +18,7 @@
 #include <mockturtle/traits.hpp>
 
 #include <type_traits>
+#include <vector>
 
 using namespace fiction;
 
@@ -1156,6 +1158,57 @@ TEST_CASE("Clear tiles", "[gate-level-layout]")
     CHECK(layout.num_pos() == 1);
 }
 
+using scanned_fanout_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+using listed_fanout_layout  = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>,
+                                               sparse_tile_storage, fanout_list_storage>;
+
+TEMPLATE_TEST_CASE("Fanout maintenance", "[gate-level-layout]", scanned_fanout_layout, listed_fanout_layout)
+{
+    using gate_layout = TestType;
+
+    auto layout = blueprints::and_or_gate_layout<gate_layout>();
+
+    const auto x1 = layout.get_node({2, 0});
+    const auto x2 = layout.get_node({1, 1});
+    const auto f1 = layout.get_node({0, 0});
+
+    CHECK(layout.fanout_size(x1) == 2);
+    CHECK(layout.fanout_size(x2) == 2);
+    CHECK(layout.fanout_size(layout.get_node({1, 0})) == 1);
+    CHECK(layout.fanout_size(layout.get_node({2, 1})) == 1);
+
+    // removing the AND gate removes it from its children's fanouts
+    layout.clear_tile({1, 0});
+
+    CHECK(layout.fanout_size(x1) == 1);
+    CHECK(layout.fanout_size(x2) == 1);
+    CHECK(layout.outgoing_data_flow({2, 0}) == std::vector<tile<gate_layout>>{{2, 1}});
+
+    // a node placed on the cleared tile inherits the PO that still points to it
+    const auto x1_signal = static_cast<mockturtle::signal<gate_layout>>(tile<gate_layout>{2, 0});
+    const auto b         = layout.get_node(layout.create_buf(x1_signal, {1, 0}));
+
+    CHECK(layout.fanout_size(x1) == 2);
+    CHECK(layout.fanout_size(b) == 1);
+
+    // removing the PO's children removes it from the buffer's fanouts
+    layout.move_node(f1, {0, 0}, {});
+
+    CHECK(layout.fanout_size(b) == 0);
+    CHECK(layout.has_no_outgoing_signal({1, 0}));
+
+    // connecting it again restores the fanout
+    layout.connect(static_cast<mockturtle::signal<gate_layout>>(tile<gate_layout>{1, 0}), f1);
+
+    CHECK(layout.fanout_size(b) == 1);
+    CHECK(layout.is_outgoing_signal({1, 0}, static_cast<mockturtle::signal<gate_layout>>(tile<gate_layout>{0, 0})));
+
+    // fanouts are subject to clocking
+    layout.assign_clock_number({0, 0}, static_cast<typename gate_layout::clock_number_t>(0));
+
+    CHECK(layout.fanout_size(b) == 0);
+}
+
 TEST_CASE("Gate-level cardinal operations", "[gate-level-layout]")
 {
     using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
@@ -1194,3 +1247,183 @@ TEST_CASE("Gate-level cardinal operations", "[gate-level-layout]")
     CHECK(layout.has_western_incoming_signal({3, 1}));
     CHECK(layout.has_western_incoming_signal({3, 2}));
 }
+
+TEST_CASE("Dense tile storage", "[gate-level-layout]")
+{
+    using sparse_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+    using dense_layout =
+        gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>, dense_tile_storage>;
+
+    CHECK(fiction::is_gate_level_layout_v<dense_layout>);
+
+    auto sparse = blueprints::and_or_gate_layout<sparse_layout>();
+    auto dense  = blueprints::and_or_gate_layout<dense_layout>();
+
+    const auto check_equal_assignment = [&sparse, &dense]
+    {
+        CHECK(sparse.size() == dense.size());
+        CHECK(sparse.num_gates() == dense.num_gates());
+        CHECK(sparse.num_wires() == dense.num_wires());
+
+        dense.foreach_coordinate(
+            [&sparse, &dense](const auto& t)
+            {
+                CHECK(sparse.get_node(t) == dense.get_node(t));
+                CHECK(sparse.is_empty_tile(t) == dense.is_empty_tile(t));
+            });
+
+        dense.foreach_node([&sparse, &dense](const auto& n) { CHECK(sparse.get_tile(n) == dense.get_tile(n)); });
+    };
+
+    CHECK(dense.get_node(dense.get_constant(false)) == 0);
+    CHECK(dense.get_node(dense.get_constant(true)) == 1);
+    CHECK(dense.is_constant(dense.get_node(dense.get_constant(true))));
+
+    check_equal_assignment();
+
+    SECTION("Move nodes")
+    {
+        const auto move = [](auto& lyt)
+        {
+            using lyt_t = std::decay_t<decltype(lyt)>;
+
+            lyt.move_node(lyt.get_node({2, 1}), {3, 0}, {});
+            lyt.move_node(lyt.get_node({1, 0}), {2, 1},
+                          {{static_cast<mockturtle::signal<lyt_t>>(tile<lyt_t>{2, 0}),
+                            static_cast<mockturtle::signal<lyt_t>>(tile<lyt_t>{1, 1})}});
+        };
+
+        move(sparse);
+        move(dense);
+
+        check_equal_assignment();
+    }
+    SECTION("Clear tiles")
+    {
+        sparse.clear_tile({1, 0});
+        dense.clear_tile({1, 0});
+
+        sparse.clear_tile({0, 0});
+        dense.clear_tile({0, 0});
+
+        CHECK(dense.is_empty_tile({1, 0}));
+        CHECK(dense.num_pos() == 1);
+
+        check_equal_assignment();
+    }
+    SECTION("Resize")
+    {
+        // shrinking moves (3,1) outside the bounding box
+        sparse.resize({2, 1, 0});
+        dense.resize({2, 1, 0});
+
+        CHECK(dense.is_po_tile({3, 1}));
+
+        sparse.resize({5, 5, 1});
+        dense.resize({5, 5, 1});
+
+        sparse.create_buf(sparse.make_signal(sparse.get_node({2, 1})), {2, 2});
+        dense.create_buf(dense.make_signal(dense.get_node({2, 1})), {2, 2});
+
+        check_equal_assignment();
+    }
+}
+
+TEST_CASE("Bulk construction", "[gate-level-layout]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    const auto reference = blueprints::and_or_gate_layout<gate_layout>();
+
+    gate_layout layout{{3, 1, 0}, open_clocking<gate_layout>()};
+    reference.foreach_coordinate([&reference, &layout](const auto& t)
+                                 { layout.assign_clock_number(t, reference.get_clock_number(t)); });
+
+    gate_level_layout_builder<gate_layout> builder{layout};
+    builder.reserve(6);
+
+    // create the POs' children out of order since they are only resolved upon finalization
+    const auto x1 = builder.create_pi("x1", {2, 0});
+    const auto x2 = builder.create_pi("x2", {1, 1});
+    const auto a  = builder.create_and(x1, x2, {1, 0});
+    builder.create_po(a, "f1", {0, 0});
+    builder.create_po(static_cast<mockturtle::signal<gate_layout>>(tile<gate_layout>{2, 1}), "f2", {3, 1});
+    builder.create_or(x2, x1, {2, 1});
+
+    CHECK(builder.num_pending() == 6);
+    CHECK(layout.size() == 2);
+
+    builder.finalize();
+
+    CHECK(builder.num_pending() == 0);
+
+    CHECK(layout.size() == reference.size());
+    CHECK(layout.num_pis() == 2);
+    CHECK(layout.num_pos() == 2);
+    CHECK(layout.num_gates() == 2);
+    CHECK(layout.num_wires() == 4);
+
+    CHECK(layout.get_name(layout.pi_at(0)) == "x1");
+    CHECK(layout.get_name(layout.pi_at(1)) == "x2");
+    CHECK(layout.get_output_name(0) == "f1");
+    CHECK(layout.get_output_name(1) == "f2");
+
+    reference.foreach_node(
+        [&reference, &layout](const auto& n)
+        {
+            const auto t = reference.get_tile(n);
+
+            CHECK(reference.node_function(n) == layout.node_function(layout.get_node(t)));
+            CHECK(reference.fanin_size(n) == layout.fanin_size(layout.get_node(t)));
+            CHECK(reference.fanout_size(n) == layout.fanout_size(layout.get_node(t)));
+            CHECK(reference.incoming_data_flow(t) == layout.incoming_data_flow(t));
+            CHECK(reference.outgoing_data_flow(t) == layout.outgoing_data_flow(t));
+        });
+}
+
+TEST_CASE("Bulk construction of wire runs", "[gate-level-layout]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    gate_layout reference{{3, 3, 1}, twoddwave_clocking<gate_layout>()};
+
+    const auto x1 = reference.create_pi("x1", {0, 0});
+    const auto w1 = reference.create_buf(reference.create_buf(reference.create_buf(x1, {1, 0}), {2, 0}), {3, 0});
+    const auto w2 = reference.create_buf(reference.create_buf(w1, {3, 1}), {3, 2});
+    reference.create_po(w2, "f", {3, 3});
+
+    gate_layout layout{{3, 3, 1}, twoddwave_clocking<gate_layout>()};
+
+    gate_level_layout_builder<gate_layout> builder{layout};
+
+    const auto pi  = builder.create_pi("x1", {0, 0});
+    const auto run = builder.create_wire_run(pi, {{1, 0}, {2, 0}, {3, 0}, {3, 1}, {3, 2}});
+
+    CHECK(run == static_cast<mockturtle::signal<gate_layout>>(tile<gate_layout>{3, 2}));
+
+    // an empty run does not create any nodes
+    CHECK(builder.create_wire_run(run, {}) == run);
+
+    builder.create_po(run, "f", {3, 3});
+
+    CHECK(builder.num_pending() == 7);
+
+    builder.finalize();
+
+    CHECK(layout.size() == reference.size());
+    CHECK(layout.num_wires() == reference.num_wires());
+    CHECK(layout.get_output_name(0) == "f");
+
+    reference.foreach_node(
+        [&reference, &layout](const auto& n)
+        {
+            if (!reference.is_constant(n))
+            {
+                const auto t = reference.get_tile(n);
+
+                CHECK(layout.get_node(t) == n);
+                CHECK(reference.fanout_size(n) == layout.fanout_size(n));
+                CHECK(reference.incoming_data_flow(t) == layout.incoming_data_flow(t));
+            }
+        });
+}
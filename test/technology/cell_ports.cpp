@@ -103,3 +103,28 @@ TEST_CASE("Port lists", "[cell-ports]")
         CHECK(p_list_w_sw == port_list<port_direction>{{p_w}, {p_sw}});
     }
 }
+
+TEST_CASE("Port masks", "[cell-ports]")
+{
+    using encoding = port_mask_encoding<port_direction, 2, 2>;
+
+    constexpr const encoding enc{
+        {{port_direction(port_direction::cardinal::NORTH_WEST), port_direction(port_direction::cardinal::NORTH_EAST)}},
+        {{port_direction(port_direction::cardinal::SOUTH_EAST), port_direction(port_direction::cardinal::SOUTH_WEST)}}};
+
+    static_assert(encoding::num_bits == 4);
+    static_assert(encoding::input(0) == 0b0001);
+    static_assert(encoding::input(1) == 0b0010);
+    static_assert(encoding::output(0) == 0b0100);
+    static_assert(encoding::output(1) == 0b1000);
+    static_assert(encoding::concatenate(0b0101, 0b1010) == 0b1010'0101);
+
+    CHECK(enc.decode(0) == port_list<port_direction>{});
+    CHECK(enc.decode(encoding::input(1) | encoding::output(0)) ==
+          port_list<port_direction>{{port_direction(port_direction::cardinal::NORTH_EAST)},
+                                    {port_direction(port_direction::cardinal::SOUTH_EAST)}});
+    CHECK(enc.decode(encoding::input(0) | encoding::input(1) | encoding::output(1)) ==
+          port_list<port_direction>{{port_direction(port_direction::cardinal::NORTH_WEST),
+                                     port_direction(port_direction::cardinal::NORTH_EAST)},
+                                    {port_direction(port_direction::cardinal::SOUTH_WEST)}});
+}
@@ -153,3 +153,43 @@ TEST_CASE("Cell marking", "[fcn-gate-library]")
                                           port_position(1, 1), qca_technology::cell_mark::EMPTY),
                          port_position(1, 2), qca_technology::cell_mark::EMPTY) == empty);
 }
+
+TEST_CASE("Port gate tables", "[fcn-gate-library]")
+{
+    using lib_t = fcn_gate_library<qca_technology, 3, 3>;
+
+    // clang-format off
+
+    constexpr const typename lib_t::fcn_gate wire{
+        lib_t::cell_list_to_gate<char>({{{' ', 'x', ' '},
+                                         {' ', 'x', ' '},
+                                         {' ', 'x', ' '}}})};
+
+    constexpr const typename lib_t::fcn_gate bent_wire{
+        lib_t::cell_list_to_gate<char>({{{' ', 'x', ' '},
+                                         {' ', 'x', 'x'},
+                                         {' ', ' ', ' '}}})};
+
+    // clang-format on
+
+    // rotated gates can be stored in tables that are generated at compile time
+    constexpr const auto table = make_port_gate_table<4, typename lib_t::fcn_gate>({
+        {0b0001, wire},
+        {0b0010, lib_t::rotate_90(wire)},
+        {0b0101, bent_wire},
+        {0b1010, lib_t::rotate_180(bent_wire)},
+    });
+
+    static_assert(table.find(0b0001) != nullptr);
+    static_assert(table.find(0b0011) == nullptr);
+
+    CHECK(*table.find(0b0001) == wire);
+    CHECK(*table.find(0b0010) == lib_t::rotate_90(wire));
+    CHECK(*table.find(0b0101) == bent_wire);
+    CHECK(*table.find(0b1010) == lib_t::rotate_180(bent_wire));
+
+    CHECK(table.find(0b0000) == nullptr);
+    CHECK(table.find(0b1111) == nullptr);
+    // port masks that exceed the key bits are not contained
+    CHECK(table.find(0b1'0001) == nullptr);
+}
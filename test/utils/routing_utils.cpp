@@ -6,10 +6,14 @@
 
 #include "utils/blueprints/layout_blueprints.hpp"
 
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/coordinates.hpp>
 #include <fiction/types.hpp>
 #include <fiction/utils/routing_utils.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <numeric>
 #include <vector>
 
 using namespace fiction;
@@ -141,3 +145,36 @@ TEST_CASE("Clear routing", "[routing-utils]")
         CHECK(layout.is_empty_tile({2, 2}));
     }
 }
+
+TEST_CASE("Dense coordinate index", "[routing-utils]")
+{
+    SECTION("Offset coordinates")
+    {
+        const cart_gate_clk_lyt layout{{3, 2, 1}};
+
+        dense_coordinate_index<cart_gate_clk_lyt> index{layout};
+
+        std::vector<std::size_t> indices{};
+        layout.foreach_coordinate([&index, &indices](const auto& c) { indices.push_back(index(c)); });
+
+        // coordinates are enumerated in z, y, x order, which corresponds to their indices
+        std::vector<std::size_t> expected(layout.area() * (layout.z() + 1));
+        std::iota(expected.begin(), expected.end(), std::size_t{0});
+
+        CHECK(indices == expected);
+        CHECK(index({3, 2, 1}) == expected.size() - 1);
+    }
+    SECTION("Cube coordinates")
+    {
+        using cube_lyt = cartesian_layout<cube::coord_t>;
+
+        const cube_lyt layout{{2, 2}};
+
+        dense_coordinate_index<cube_lyt> index{layout};
+
+        CHECK(index({1, 1}) == 0);
+        CHECK(index({-1, 0}) == 1);
+        CHECK(index({1, 1}) == 0);
+        CHECK(index({2, 0}) == 2);
+    }
+}
@@ -10,6 +10,8 @@
 #include <fiction/utils/stl_utils.hpp>
 
 #include <array>
+#include <cstdint>
+#include <functional>
 #include <iterator>
 #include <vector>
 
@@ -76,3 +78,83 @@ TEST_CASE("Test find_first_two_of with layout_coordinate_paths", "[first_first_t
     CHECK(it3 == p1.begin());
     CHECK(it4 == std::next(p2.begin(), 1));
 }
+
+TEST_CASE("Indexed priority queue", "[indexed-priority-queue]")
+{
+    SECTION("Min-heap")
+    {
+        indexed_priority_queue<char, int> queue{};
+
+        CHECK(queue.empty());
+        CHECK(!queue.contains(0));
+
+        queue.push(4, 'e', 40);
+        queue.push(0, 'a', 10);
+        queue.push(2, 'c', 30);
+        queue.push(7, 'h', 20);
+        queue.push(5, 'f', 50);
+
+        CHECK(queue.size() == 5);
+        CHECK(queue.contains(2));
+        CHECK(!queue.contains(1));
+        CHECK(!queue.contains(42));
+        CHECK(queue.priority(2) == 30);
+
+        CHECK(queue.top() == 'a');
+        CHECK(queue.top_priority() == 10);
+
+        // move 'f' to the top
+        queue.decrease_key(5, 5);
+
+        CHECK(queue.priority(5) == 5);
+        CHECK(queue.top() == 'f');
+
+        std::vector<char> order{};
+        while (!queue.empty())
+        {
+            order.push_back(queue.top());
+            queue.pop();
+        }
+
+        CHECK(order == std::vector<char>{'f', 'a', 'h', 'c', 'e'});
+        CHECK(!queue.contains(5));
+
+        // keys can be reused after their removal
+        queue.push(5, 'f', 1);
+        CHECK(queue.top() == 'f');
+    }
+    SECTION("Max-heap")
+    {
+        indexed_priority_queue<uint64_t, uint64_t, std::greater<uint64_t>, 2> queue{};
+
+        for (uint64_t i = 0; i < 100; ++i)
+        {
+            queue.push(i, i, i % 10);
+        }
+
+        queue.decrease_key(42, 100);
+
+        CHECK(queue.top() == 42);
+        queue.pop();
+
+        uint64_t previous = queue.top_priority();
+        while (!queue.empty())
+        {
+            CHECK(queue.top_priority() <= previous);
+            previous = queue.top_priority();
+            queue.pop();
+        }
+    }
+    SECTION("Clear")
+    {
+        indexed_priority_queue<int, double> queue{};
+
+        queue.push(3, 3, 0.5);
+        queue.push(1, 1, 0.25);
+        queue.clear();
+
+        CHECK(queue.empty());
+        CHECK(!queue.contains(1));
+        CHECK(!queue.contains(3));
+    }
+}